@@ -0,0 +1,62 @@
+﻿#include "AmbientOcclusionVolume.h"
+#include <omp.h>
+#include "SummedVolumeTable.h"
+
+/** 近傍の平均密度を求める半径（ボクセル）と、その重み */
+static const int NUM_SCALES = 4;
+static const int SCALE_RADIUS[NUM_SCALES] = { 1, 2, 4, 8 };
+static const float SCALE_WEIGHT[NUM_SCALES] = { 0.4f, 0.3f, 0.2f, 0.1f };
+
+/**
+ * 各ボクセルの周囲の平均密度から、局所的なアンビエントオクルージョンを近似する。
+ * 半径の異なる複数のボックスの平均密度を累積和テーブルから求め、重み付きで足し合わせたものを遮蔽率とし、
+ * 最大密度で正規化して、1から引いた値（環境光が届く割合）を出力する。
+ * シェーダでは、サンプル毎に光線を飛ばす代わりに、この値を1回フェッチするだけでよい。
+ *
+ * @param width					幅
+ * @param height				高さ
+ * @param depth					奥行き
+ * @param data					3Dデータ
+ * @param visibility [OUT]		環境光が届く割合 [0, 1]
+ */
+void AmbientOcclusionVolume::compute(int width, int height, int depth, const float* data, std::vector<float>& visibility) {
+	int num = width * height * depth;
+
+	// 最大密度を求める（OpenMP 2.0にはmaxのreductionが無いので、スレッド毎に求める）
+	std::vector<float> threadMax(omp_get_max_threads(), 0.0f);
+	#pragma omp parallel for
+	for (int i = 0; i < num; ++i) {
+		float& maxVal = threadMax[omp_get_thread_num()];
+		if (data[i] > maxVal) maxVal = data[i];
+	}
+	float maxVal = 0.0f;
+	for (int i = 0; i < (int)threadMax.size(); ++i) {
+		if (threadMax[i] > maxVal) maxVal = threadMax[i];
+	}
+
+	visibility.assign(num, 1.0f);
+	if (maxVal <= 0.0f) return;
+
+	// 任意の半径のボックスの平均を定数時間で求められるように、累積和テーブルを作成する
+	SummedVolumeTable table;
+	table.build(width, height, depth, data);
+
+	#pragma omp parallel for
+	for (int z = 0; z < depth; ++z) {
+		for (int y = 0; y < height; ++y) {
+			for (int x = 0; x < width; ++x) {
+				float occlusion = 0.0f;
+				for (int s = 0; s < NUM_SCALES; ++s) {
+					int r = SCALE_RADIUS[s];
+					occlusion += table.average(x - r, y - r, z - r, x + r + 1, y + r + 1, z + r + 1) * SCALE_WEIGHT[s];
+				}
+				visibility[((size_t)z * height + y) * width + x] = 1.0f - occlusion / maxVal;
+			}
+		}
+	}
+
+	#pragma omp parallel for
+	for (int i = 0; i < num; ++i) {
+		if (visibility[i] < 0.0f) visibility[i] = 0.0f;
+	}
+}
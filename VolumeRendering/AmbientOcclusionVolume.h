@@ -0,0 +1,11 @@
+#pragma once
+
+#include <vector>
+
+class AmbientOcclusionVolume {
+protected:
+	AmbientOcclusionVolume() {}
+
+public:
+	static void compute(int width, int height, int depth, const float* data, std::vector<float>& visibility);
+};
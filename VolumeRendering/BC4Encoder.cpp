@@ -0,0 +1,222 @@
+﻿#include "BC4Encoder.h"
+#include <emmintrin.h>
+#include <math.h>
+
+/**
+ * 指定したサイズの3Dデータを、スライス毎にBC4(RGTC1)で圧縮した時のバイト数を返却する。
+ * 4x4テクセルのブロック毎に8バイトを使う。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @return			圧縮後のバイト数
+ */
+int BC4Encoder::compressedSize(int width, int height, int depth) {
+	return ((width + 3) / 4) * ((height + 3) / 4) * depth * 8;
+}
+
+/**
+ * 3Dデータを、スライス毎にBC4(RGTC1)ブロックへ圧縮する。
+ * 各値にscaleを掛けて[0, 1]に正規化してから量子化するので、scaleには通常、最大値の逆数を指定する。
+ * スライス単位で全コアに分散して処理する。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @param data		3Dデータ
+ * @param scale		正規化のためのスケール
+ * @param blocks [OUT]	圧縮後のブロック（GL_TEXTURE_2D_ARRAYのレイヤ順）
+ */
+void BC4Encoder::encode(int width, int height, int depth, const float* data, float scale, std::vector<unsigned char>& blocks) {
+	int blocksX = (width + 3) / 4;
+	int blocksY = (height + 3) / 4;
+	blocks.resize(compressedSize(width, height, depth));
+
+	__m128 vscale = _mm_set1_ps(scale);
+
+	#pragma omp parallel for schedule(dynamic)
+	for (int z = 0; z < depth; ++z) {
+		float texels[16];
+		const float* slice = data + (size_t)z * width * height;
+
+		for (int by = 0; by < blocksY; ++by) {
+			for (int bx = 0; bx < blocksX; ++bx) {
+				int x0 = bx * 4;
+				int y0 = by * 4;
+
+				if (x0 + 4 <= width && y0 + 4 <= height) {
+					// ブロック全体がスライス内にあるので、各行の4テクセルをまとめて読み込む
+					for (int j = 0; j < 4; ++j) {
+						_mm_storeu_ps(texels + j * 4, _mm_mul_ps(_mm_loadu_ps(slice + (y0 + j) * width + x0), vscale));
+					}
+				} else {
+					// 端のブロックは、スライス外のテクセルを端の値で埋める
+					for (int j = 0; j < 4; ++j) {
+						int y = y0 + j < height ? y0 + j : height - 1;
+						for (int i = 0; i < 4; ++i) {
+							int x = x0 + i < width ? x0 + i : width - 1;
+							texels[j * 4 + i] = slice[y * width + x] * scale;
+						}
+					}
+				}
+
+				encodeBlock(texels, &blocks[(((size_t)z * blocksY + by) * blocksX + bx) * 8]);
+			}
+		}
+	}
+}
+
+/**
+ * BC4ブロックを展開して、3Dデータに戻す。PSNRの計算用。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @param blocks	圧縮されたブロック
+ * @param scale		圧縮時に指定したスケール
+ * @param data [OUT]	展開後の3Dデータ（width * height * depth個の領域を確保しておくこと）
+ */
+void BC4Encoder::decode(int width, int height, int depth, const std::vector<unsigned char>& blocks, float scale, float* data) {
+	int blocksX = (width + 3) / 4;
+	int blocksY = (height + 3) / 4;
+	float invScale = scale > 0.0f ? 1.0f / scale : 0.0f;
+
+	#pragma omp parallel for schedule(dynamic)
+	for (int z = 0; z < depth; ++z) {
+		float texels[16];
+		float* slice = data + (size_t)z * width * height;
+
+		for (int by = 0; by < blocksY; ++by) {
+			for (int bx = 0; bx < blocksX; ++bx) {
+				decodeBlock(&blocks[(((size_t)z * blocksY + by) * blocksX + bx) * 8], texels);
+
+				for (int j = 0; j < 4 && by * 4 + j < height; ++j) {
+					for (int i = 0; i < 4 && bx * 4 + i < width; ++i) {
+						slice[(by * 4 + j) * width + bx * 4 + i] = texels[j * 4 + i] * invScale;
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+ * 元の3Dデータと展開後の3Dデータから、PSNR[dB]を計算する。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @param original	元の3Dデータ
+ * @param decoded	展開後の3Dデータ
+ * @param peak		値の最大値
+ * @return			PSNR（誤差がない場合は無限大）
+ */
+double BC4Encoder::computePSNR(int width, int height, int depth, const float* original, const float* decoded, float peak) {
+	int num = width * height * depth;
+	double sum = 0.0;
+
+	#pragma omp parallel for reduction(+:sum)
+	for (int i = 0; i < num; ++i) {
+		double diff = original[i] - decoded[i];
+		sum += diff * diff;
+	}
+
+	double mse = sum / num;
+	if (mse <= 0.0) return HUGE_VAL;
+
+	return 10.0 * log10((double)peak * peak / mse);
+}
+
+/**
+ * 4x4テクセルを1つのBC4ブロック（8バイト）に圧縮する。
+ * 最大値、最小値を端点とし、red0 > red1の8段階モードを使う。
+ *
+ * @param texels		[0, 1]に正規化された16テクセル（行順）
+ * @param block [OUT]	8バイトのブロック
+ */
+void BC4Encoder::encodeBlock(const float* texels, unsigned char* block) {
+	__m128 row0 = _mm_loadu_ps(texels);
+	__m128 row1 = _mm_loadu_ps(texels + 4);
+	__m128 row2 = _mm_loadu_ps(texels + 8);
+	__m128 row3 = _mm_loadu_ps(texels + 12);
+
+	// 16テクセルの最小値、最大値を求める
+	__m128 vmin = _mm_min_ps(_mm_min_ps(row0, row1), _mm_min_ps(row2, row3));
+	__m128 vmax = _mm_max_ps(_mm_max_ps(row0, row1), _mm_max_ps(row2, row3));
+	vmin = _mm_min_ps(vmin, _mm_shuffle_ps(vmin, vmin, _MM_SHUFFLE(2, 3, 0, 1)));
+	vmin = _mm_min_ps(vmin, _mm_shuffle_ps(vmin, vmin, _MM_SHUFFLE(1, 0, 3, 2)));
+	vmax = _mm_max_ps(vmax, _mm_shuffle_ps(vmax, vmax, _MM_SHUFFLE(2, 3, 0, 1)));
+	vmax = _mm_max_ps(vmax, _mm_shuffle_ps(vmax, vmax, _MM_SHUFFLE(1, 0, 3, 2)));
+
+	int red0 = (int)(_mm_cvtss_f32(vmax) * 255.0f + 0.5f);
+	int red1 = (int)(_mm_cvtss_f32(vmin) * 255.0f + 0.5f);
+	if (red0 > 255) red0 = 255;
+	if (red1 < 0) red1 = 0;
+	if (red1 > red0) red1 = red0;
+
+	block[0] = (unsigned char)red0;
+	block[1] = (unsigned char)red1;
+	for (int i = 2; i < 8; ++i) block[i] = 0;
+
+	// 全テクセルが同じ値なら、インデックスは全て0（= red0）でよい
+	if (red0 == red1) return;
+
+	// red0からred1までを7等分した何段階目かを求める
+	__m128 vred0 = _mm_set1_ps((float)red0);
+	__m128 v255 = _mm_set1_ps(255.0f);
+	__m128 vfactor = _mm_set1_ps(7.0f / (red0 - red1));
+	__m128 vzero = _mm_setzero_ps();
+	__m128 vseven = _mm_set1_ps(7.0f);
+	__m128 rows[4] = { row0, row1, row2, row3 };
+	int steps[16];
+	for (int j = 0; j < 4; ++j) {
+		__m128 s = _mm_mul_ps(_mm_sub_ps(vred0, _mm_mul_ps(rows[j], v255)), vfactor);
+		s = _mm_min_ps(_mm_max_ps(s, vzero), vseven);
+		_mm_storeu_si128((__m128i*)(steps + j * 4), _mm_cvtps_epi32(s));
+	}
+
+	// 段階をBC4のインデックスに変換し、3ビットずつ詰める
+	// （0段階目 = red0 = index 0、7段階目 = red1 = index 1、その間はindex 2〜7）
+	unsigned long long bits = 0;
+	for (int i = 0; i < 16; ++i) {
+		unsigned long long index = steps[i] == 0 ? 0 : (steps[i] == 7 ? 1 : steps[i] + 1);
+		bits |= index << (3 * i);
+	}
+	for (int i = 0; i < 6; ++i) {
+		block[2 + i] = (unsigned char)((bits >> (8 * i)) & 0xff);
+	}
+}
+
+/**
+ * BC4ブロック（8バイト）を4x4テクセルに展開する。
+ *
+ * @param block			8バイトのブロック
+ * @param texels [OUT]	[0, 1]の16テクセル（行順）
+ */
+void BC4Encoder::decodeBlock(const unsigned char* block, float* texels) {
+	float red0 = block[0] / 255.0f;
+	float red1 = block[1] / 255.0f;
+
+	float palette[8];
+	palette[0] = red0;
+	palette[1] = red1;
+	if (block[0] > block[1]) {
+		for (int i = 1; i <= 6; ++i) {
+			palette[i + 1] = ((7 - i) * red0 + i * red1) / 7.0f;
+		}
+	} else {
+		for (int i = 1; i <= 4; ++i) {
+			palette[i + 1] = ((5 - i) * red0 + i * red1) / 5.0f;
+		}
+		palette[6] = 0.0f;
+		palette[7] = 1.0f;
+	}
+
+	unsigned long long bits = 0;
+	for (int i = 0; i < 6; ++i) {
+		bits |= (unsigned long long)block[2 + i] << (8 * i);
+	}
+	for (int i = 0; i < 16; ++i) {
+		texels[i] = palette[(bits >> (3 * i)) & 7];
+	}
+}
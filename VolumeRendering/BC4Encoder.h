@@ -0,0 +1,18 @@
+#pragma once
+
+#include <vector>
+
+class BC4Encoder {
+protected:
+	BC4Encoder() {}
+
+public:
+	static int compressedSize(int width, int height, int depth);
+	static void encode(int width, int height, int depth, const float* data, float scale, std::vector<unsigned char>& blocks);
+	static void decode(int width, int height, int depth, const std::vector<unsigned char>& blocks, float scale, float* data);
+	static double computePSNR(int width, int height, int depth, const float* original, const float* decoded, float peak);
+
+private:
+	static void encodeBlock(const float* texels, unsigned char* block);
+	static void decodeBlock(const unsigned char* block, float* texels);
+};
@@ -0,0 +1,139 @@
+﻿#include "BlueNoise.h"
+#include <math.h>
+
+// void-and-clusterで使うガウシアンの標準偏差
+#define CLUSTER_SIGMA	1.5f
+
+// 初期パターンに置く点の割合
+#define INITIAL_DENSITY	0.1f
+
+/**
+ * void-and-cluster法で、size x sizeのタイル状に繰り返せるブルーノイズを生成する。
+ * 各ピクセルには、点を置いた順位を[0, 1)に正規化した値が入るので、どの閾値で切っても
+ * 点が均等に散らばり、低周波の成分をほとんど含まない。
+ * レイの開始位置のジッタに使うと、サンプルのずれが画面上で目立つ模様にならず、細かいノイズになる。
+ *
+ * @param size			一辺のピクセル数
+ * @param noise [OUT]	ブルーノイズ（size * size個）
+ */
+void BlueNoise::generate(int size, std::vector<float>& noise) {
+	int num = size * size;
+
+	// トーラス上の距離に対するガウシアンを、オフセット毎に事前計算する
+	std::vector<float> kernel(num);
+	for (int y = 0; y < size; ++y) {
+		for (int x = 0; x < size; ++x) {
+			int dx = x < size / 2 ? x : size - x;
+			int dy = y < size / 2 ? y : size - y;
+			kernel[y * size + x] = expf(-(dx * dx + dy * dy) / (2.0f * CLUSTER_SIGMA * CLUSTER_SIGMA));
+		}
+	}
+
+	// 初期パターンとして、乱数で点を置く（毎回同じノイズになるように、固定の種の線形合同法を使う）
+	std::vector<char> pattern(num, 0);
+	std::vector<float> energy(num, 0.0f);
+	unsigned int seed = 12345;
+	int numOnes = 0;
+	while (numOnes < (int)(num * INITIAL_DENSITY)) {
+		seed = seed * 1103515245 + 12345;
+		int index = (seed >> 8) % num;
+		if (pattern[index]) continue;
+
+		pattern[index] = 1;
+		updateEnergy(size, kernel, energy, index, 1.0f);
+		numOnes++;
+	}
+
+	// 最も密な点を最も疎な場所へ動かし、点が均等に散らばるまで繰り返す
+	while (true) {
+		int cluster = findTightestCluster(pattern, energy);
+		pattern[cluster] = 0;
+		updateEnergy(size, kernel, energy, cluster, -1.0f);
+
+		int hole = findLargestVoid(pattern, energy);
+		pattern[hole] = 1;
+		updateEnergy(size, kernel, energy, hole, 1.0f);
+
+		if (hole == cluster) break;
+	}
+
+	std::vector<int> ranks(num, 0);
+
+	// 初期パターンの点は、最も密な点から順に取り除き、後ろの順位を付ける
+	{
+		std::vector<char> p = pattern;
+		std::vector<float> e = energy;
+		for (int rank = numOnes - 1; rank >= 0; --rank) {
+			int cluster = findTightestCluster(p, e);
+			p[cluster] = 0;
+			updateEnergy(size, kernel, e, cluster, -1.0f);
+			ranks[cluster] = rank;
+		}
+	}
+
+	// 残りは、最も疎な場所から順に点を置き、順位を付ける
+	for (int rank = numOnes; rank < num; ++rank) {
+		int hole = findLargestVoid(pattern, energy);
+		pattern[hole] = 1;
+		updateEnergy(size, kernel, energy, hole, 1.0f);
+		ranks[hole] = rank;
+	}
+
+	noise.resize(num);
+	for (int i = 0; i < num; ++i) {
+		noise[i] = (ranks[i] + 0.5f) / num;
+	}
+}
+
+/**
+ * 点の追加／削除に合わせて、各ピクセルのエネルギー（周囲の点の密度）を更新する。
+ *
+ * @param size				一辺のピクセル数
+ * @param kernel			オフセット毎のガウシアン
+ * @param energy [IN/OUT]	エネルギー
+ * @param index				追加／削除した点
+ * @param sign				追加の場合は1、削除の場合は-1
+ */
+void BlueNoise::updateEnergy(int size, const std::vector<float>& kernel, std::vector<float>& energy, int index, float sign) {
+	int px = index % size;
+	int py = index / size;
+
+	#pragma omp parallel for
+	for (int y = 0; y < size; ++y) {
+		int dy = (y - py + size) % size;
+		for (int x = 0; x < size; ++x) {
+			int dx = (x - px + size) % size;
+			energy[y * size + x] += sign * kernel[dy * size + dx];
+		}
+	}
+}
+
+/**
+ * 点の中で、エネルギーが最大のもの（最も密な点）を返却する。
+ *
+ * @param pattern	各ピクセルに点があるかどうか
+ * @param energy	エネルギー
+ * @return			最も密な点
+ */
+int BlueNoise::findTightestCluster(const std::vector<char>& pattern, const std::vector<float>& energy) {
+	int best = -1;
+	for (int i = 0; i < (int)pattern.size(); ++i) {
+		if (pattern[i] && (best < 0 || energy[i] > energy[best])) best = i;
+	}
+	return best;
+}
+
+/**
+ * 点の無いピクセルの中で、エネルギーが最小のもの（最も疎な場所）を返却する。
+ *
+ * @param pattern	各ピクセルに点があるかどうか
+ * @param energy	エネルギー
+ * @return			最も疎な場所
+ */
+int BlueNoise::findLargestVoid(const std::vector<char>& pattern, const std::vector<float>& energy) {
+	int best = -1;
+	for (int i = 0; i < (int)pattern.size(); ++i) {
+		if (!pattern[i] && (best < 0 || energy[i] < energy[best])) best = i;
+	}
+	return best;
+}
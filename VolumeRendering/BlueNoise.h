@@ -0,0 +1,16 @@
+#pragma once
+
+#include <vector>
+
+class BlueNoise {
+protected:
+	BlueNoise() {}
+
+public:
+	static void generate(int size, std::vector<float>& noise);
+
+private:
+	static void updateEnergy(int size, const std::vector<float>& kernel, std::vector<float>& energy, int index, float sign);
+	static int findTightestCluster(const std::vector<char>& pattern, const std::vector<float>& energy);
+	static int findLargestVoid(const std::vector<char>& pattern, const std::vector<float>& energy);
+};
@@ -47,6 +47,16 @@ public:
 		return ((mvMat.transposed()).inverted())*eye;
 	}
 
+	QMatrix4x4 getModelviewMatrix() const {
+		QMatrix4x4 m;
+		m.translate(-dx, -dy, -dz);
+		m.rotate(xrot, 1.0, 0.0, 0.0);
+		m.rotate(yrot, 0.0, 1.0, 0.0);
+		m.rotate(zrot, 0.0, 0.0, 1.0);
+		m.translate(-lookAtX, -lookAtY, -lookAtZ);
+		return m;
+	}
+
 	void applyCamTransform() {
 		glLoadIdentity();
 		glTranslatef(-dx, -dy, -dz);
@@ -0,0 +1,203 @@
+﻿#include "CameraPath.h"
+#include <math.h>
+#include <iostream>
+#include <algorithm>
+#include <QFile>
+#include <QTextStream>
+#include <QLocale>
+
+/**
+ * カメラの現在の状態を、キーフレームとして追加する。キーフレームは時刻の順に並べ替える。
+ * 同じ時刻のキーフレームがあれば、置き換える。
+ *
+ * @param time		時刻 [s]
+ * @param camera	カメラ
+ */
+void CameraPath::addKeyframe(float time, const Camera& camera) {
+	Keyframe keyframe;
+	keyframe.time = time;
+	keyframe.xrot = camera.xrot;
+	keyframe.yrot = camera.yrot;
+	keyframe.zrot = camera.zrot;
+	keyframe.dx = camera.dx;
+	keyframe.dy = camera.dy;
+	keyframe.dz = camera.dz;
+	keyframe.lookAtX = camera.lookAtX;
+	keyframe.lookAtY = camera.lookAtY;
+	keyframe.lookAtZ = camera.lookAtZ;
+
+	int i = 0;
+	while (i < (int)keyframes.size() && keyframes[i].time < time) i++;
+	if (i < (int)keyframes.size() && keyframes[i].time == time) {
+		keyframes[i] = keyframe;
+	} else {
+		keyframes.insert(keyframes.begin() + i, keyframe);
+	}
+}
+
+/**
+ * 最後のキーフレームの時刻を返却する。
+ *
+ * @return		長さ [s]
+ */
+float CameraPath::getDuration() const {
+	return keyframes.empty() ? 0.0f : keyframes.back().time;
+}
+
+/**
+ * 指定した時刻のカメラを、キーフレームの間をCatmull-Romスプラインで補間して求める。
+ * 接線は前後のキーフレームの差分を時刻の差で割ったものなので、キーフレームの間隔が不揃いでも速度が滑らかにつながる。
+ * 回転は、前のキーフレームから近い方向に回るように、360度の倍数を足してから補間する。
+ *
+ * @param time				時刻 [s]
+ * @param camera [OUT]		カメラ
+ */
+void CameraPath::evaluate(float time, Camera& camera) const {
+	if (keyframes.empty()) return;
+
+	int n = keyframes.size();
+	float values[NUM_CHANNELS];
+	if (n == 1 || time <= keyframes[0].time) {
+		for (int c = 0; c < NUM_CHANNELS; ++c) values[c] = getChannel(keyframes[0], c);
+	} else if (time >= keyframes[n - 1].time) {
+		for (int c = 0; c < NUM_CHANNELS; ++c) values[c] = getChannel(keyframes[n - 1], c);
+	} else {
+		int k = 0;
+		while (keyframes[k + 1].time <= time) k++;
+
+		// 補間に使う前後4つのキーフレーム（端では同じものを繰り返す）
+		int indices[4] = { std::max(k - 1, 0), k, k + 1, std::min(k + 2, n - 1) };
+		float times[4];
+		for (int i = 0; i < 4; ++i) times[i] = keyframes[indices[i]].time;
+
+		float h = times[2] - times[1];
+		float s = (time - times[1]) / h;
+		float h00 = 2 * s * s * s - 3 * s * s + 1;
+		float h10 = s * s * s - 2 * s * s + s;
+		float h01 = -2 * s * s * s + 3 * s * s;
+		float h11 = s * s * s - s * s;
+
+		for (int c = 0; c < NUM_CHANNELS; ++c) {
+			float p[4];
+			for (int i = 0; i < 4; ++i) {
+				p[i] = getChannel(keyframes[indices[i]], c);
+				if (i > 0 && isAngle(c)) {
+					while (p[i] - p[i - 1] > 180.0f) p[i] -= 360.0f;
+					while (p[i] - p[i - 1] < -180.0f) p[i] += 360.0f;
+				}
+			}
+
+			float m1 = times[2] > times[0] ? (p[2] - p[0]) / (times[2] - times[0]) : 0.0f;
+			float m2 = times[3] > times[1] ? (p[3] - p[1]) / (times[3] - times[1]) : 0.0f;
+			values[c] = h00 * p[1] + h10 * h * m1 + h01 * p[2] + h11 * h * m2;
+		}
+	}
+
+	camera.setRotation(values[0], values[1], values[2]);
+	camera.setTranslation(values[3], values[4], values[5]);
+	camera.setLookAt(values[6], values[7], values[8]);
+}
+
+/**
+ * テキストファイルからキーフレームを読み込む。
+ * 1行に1つのキーフレームを、time xrot yrot zrot dx dy dz lookAtX lookAtY lookAtZの順に空白で区切って書く。
+ * #で始まる行は無視する。
+ * QCoreApplicationはロケールを環境に合わせるので、小数点がカンマのロケールでも同じファイルを読めるように、
+ * 数値はCロケールで読む。
+ *
+ * @param filename	ファイル名
+ * @return			読み込めた場合はtrue
+ */
+bool CameraPath::load(const char* filename) {
+	QFile file(QFile::decodeName(filename));
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) return false;
+
+	keyframes.clear();
+	QTextStream in(&file);
+	while (!in.atEnd()) {
+		QString line = in.readLine();
+		if (line.startsWith('#')) continue;
+
+		Keyframe k;
+		QTextStream fields(&line, QIODevice::ReadOnly);
+		fields.setLocale(QLocale::c());
+		fields >> k.time >> k.xrot >> k.yrot >> k.zrot >> k.dx >> k.dy >> k.dz >> k.lookAtX >> k.lookAtY >> k.lookAtZ;
+		if (fields.status() == QTextStream::Ok) {
+			keyframes.push_back(k);
+		}
+	}
+
+	for (int i = 1; i < (int)keyframes.size(); ++i) {
+		if (keyframes[i].time <= keyframes[i - 1].time) {
+			std::cout << filename << ": the keyframes must be in the order of time." << std::endl;
+			keyframes.clear();
+			return false;
+		}
+	}
+
+	return !keyframes.empty();
+}
+
+/**
+ * キーフレームを、loadで読み込める形式で書き出す。
+ * ロケールによらず同じファイルになるように、数値はCロケールで書く。
+ *
+ * @param filename	ファイル名
+ * @return			書き出せた場合はtrue
+ */
+bool CameraPath::save(const char* filename) const {
+	QFile file(QFile::decodeName(filename));
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) return false;
+
+	QTextStream out(&file);
+	out.setLocale(QLocale::c());
+	out << "# time xrot yrot zrot dx dy dz lookAtX lookAtY lookAtZ\n";
+	for (int i = 0; i < (int)keyframes.size(); ++i) {
+		const Keyframe& k = keyframes[i];
+		out << k.time << ' ' << k.xrot << ' ' << k.yrot << ' ' << k.zrot << ' ' << k.dx << ' ' << k.dy << ' ' << k.dz << ' ' << k.lookAtX << ' ' << k.lookAtY << ' ' << k.lookAtZ << '\n';
+	}
+	out.flush();
+
+	return out.status() == QTextStream::Ok;
+}
+
+/**
+ * カメラの位置から、Y軸の周りを一周するパスを生成する。
+ * 補間で一定の速さになるように、90度毎にキーフレームを置く。
+ *
+ * @param camera	開始するカメラ
+ * @param duration	一周にかける時間 [s]
+ * @return			パス
+ */
+CameraPath CameraPath::orbit(const Camera& camera, float duration) {
+	CameraPath path;
+	Camera key = camera;
+	for (int i = 0; i <= 4; ++i) {
+		// setYRotationは[0, 360]に丸めるので、直接設定して一周分の角度を保つ
+		key.yrot = camera.yrot + 90.0f * i;
+		path.addKeyframe(duration * i / 4, key);
+	}
+
+	return path;
+}
+
+/**
+ * キーフレームのチャンネルの値を返却する。0 - 2は回転の角度、3 - 5は移動、6 - 8は注視点である。
+ *
+ * @param keyframe	キーフレーム
+ * @param channel	チャンネル
+ * @return			値
+ */
+float CameraPath::getChannel(const Keyframe& keyframe, int channel) {
+	switch (channel) {
+	case 0: return keyframe.xrot;
+	case 1: return keyframe.yrot;
+	case 2: return keyframe.zrot;
+	case 3: return keyframe.dx;
+	case 4: return keyframe.dy;
+	case 5: return keyframe.dz;
+	case 6: return keyframe.lookAtX;
+	case 7: return keyframe.lookAtY;
+	default: return keyframe.lookAtZ;
+	}
+}
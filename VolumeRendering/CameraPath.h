@@ -0,0 +1,43 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+#include "Camera.h"
+
+class CameraPath {
+public:
+	struct Keyframe {
+		float time;
+		float xrot;
+		float yrot;
+		float zrot;
+		float dx;
+		float dy;
+		float dz;
+		float lookAtX;
+		float lookAtY;
+		float lookAtZ;
+	};
+
+	static const int NUM_CHANNELS = 9;
+
+private:
+	std::vector<Keyframe> keyframes;
+
+public:
+	CameraPath() {}
+
+	void addKeyframe(float time, const Camera& camera);
+	void clear() { keyframes.clear(); }
+	int numKeyframes() const { return keyframes.size(); }
+	float getDuration() const;
+	void evaluate(float time, Camera& camera) const;
+	bool load(const char* filename);
+	bool save(const char* filename) const;
+	static CameraPath orbit(const Camera& camera, float duration);
+
+private:
+	static float getChannel(const Keyframe& keyframe, int channel);
+	static bool isAngle(int channel) { return channel < 3; }
+};
+
@@ -0,0 +1,518 @@
+﻿#include "CpuRaycaster.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+// raycastfs.glslの定数と同じ値
+#define DENSITY_SCALE		10.0f
+#define ABSORB_RATE			10.0f
+#define LIGHT_STEP_SIZE		0.01f
+#define LIGHT_ABSORPTION	5.0f
+#define LIGHT_SAMPLES		128
+#define REFINE_STEPS		6
+
+// レイのサンプル間隔（テクスチャ座標）
+#define STEP_SIZE			0.005f
+
+// 等値面のBlinn-Phongシェーディングの係数
+#define AMBIENT				0.3f
+#define DIFFUSE				0.7f
+#define SPECULAR			0.4f
+#define SHININESS			32.0f
+
+/**
+ * GPUを使わずに、raycastfs.glslと同じレイマーチングをCPUで行う。
+ * GLのコンテキストが無くても描画でき、const関数だけで描画するので、複数のスレッドから同時に使える。
+ * 3Dデータはコピーしないので、描画が終わるまで呼び出し側で保持すること。
+ * 窓は単調なので、ブリックの最小値・最大値は窓を適用する前の値で作っておき、参照する時に窓を適用する。
+ *
+ * @param width		3Dデータの幅
+ * @param height	3Dデータの高さ
+ * @param depth		3Dデータの奥行き
+ * @param data		3Dデータ（ウィンドウを適用する前の値）
+ */
+CpuRaycaster::CpuRaycaster(int width, int height, int depth, const float* data) {
+	gridWidth = width;
+	gridHeight = height;
+	gridDepth = depth;
+	this->data = data;
+	minMaxBricks.build(width, height, depth, data);
+
+	renderMode = VolumeRendering::RENDER_VOLUME;
+	windowMin = 0.0f;
+	windowMax = 1.0f;
+	isoValue = 0.5f;
+	lightPos = QVector3D(1.0f, 1.0f, 2.0f);
+	terminationThreshold = 0.99f;
+	stepSize = STEP_SIZE;
+}
+
+/**
+ * 密度の窓を設定する。VolumeRendering::setWindowと同じく、窓を[0, 1]に写して描画する。
+ *
+ * @param windowMin	窓の下限
+ * @param windowMax	窓の上限
+ */
+void CpuRaycaster::setWindow(float windowMin, float windowMax) {
+	this->windowMin = windowMin;
+	this->windowMax = windowMax > windowMin ? windowMax : windowMin + 1.0f;
+}
+
+/**
+ * 描画モードを設定する。等値面のメッシュは作らないので、RENDER_ISOSURFACEはRENDER_ISORAYCASTとして描画する。
+ *
+ * @param renderMode	描画モード
+ */
+void CpuRaycaster::setRenderMode(int renderMode) {
+	this->renderMode = renderMode;
+}
+
+/**
+ * 等値面の値を設定する。
+ *
+ * @param isoValue	等値面の値（窓を適用した後の値）
+ */
+void CpuRaycaster::setIsoValue(float isoValue) {
+	this->isoValue = isoValue;
+}
+
+/**
+ * 光源の位置を設定する。
+ *
+ * @param lightPos	光源の位置（テクスチャ座標）
+ */
+void CpuRaycaster::setLightPosition(const QVector3D& lightPos) {
+	this->lightPos = lightPos;
+}
+
+/**
+ * レイを打ち切る不透明度を設定する。
+ *
+ * @param terminationThreshold	不透明度の閾値
+ */
+void CpuRaycaster::setTerminationThreshold(float terminationThreshold) {
+	this->terminationThreshold = terminationThreshold;
+}
+
+/**
+ * 画像をTILE_SIZE四方のタイルに分け、タイル毎に描画する。
+ * 隣り合うレイは近いボクセルを読むので、タイル単位で描画するとキャッシュに乗りやすい。
+ * タイル毎に描画の重さが違うので、タイルはOpenMPで動的にスレッドに割り当て、レイの統計はスレッド毎に集計してから合計する。
+ * 背景は黒で、GPUの描画と同じく、上下は画像の座標（上が0行目）に合わせる。
+ * statisticsを指定した場合は、VolumeRendering::collectStatisticsと同じく、ボックスに当たったレイの統計を返却する。
+ *
+ * @param modelview		モデルビュー行列
+ * @param projection	投影行列
+ * @param width			画像の幅
+ * @param height		画像の高さ
+ * @param image [OUT]	描画した画像
+ * @param statistics [OUT]	レイの統計（NULLの場合は返却しない）
+ */
+void CpuRaycaster::render(const QMatrix4x4& modelview, const QMatrix4x4& projection, int width, int height, QImage& image, VolumeRendering::RayStatistics* statistics) const {
+	image = QImage(width, height, QImage::Format_RGB32);
+
+	QMatrix4x4 inverse = (projection * modelview).inverted();
+	QVector3D eye = toTexture((modelview.inverted() * QVector4D(0, 0, 0, 1)).toVector3D());
+
+	VolumeRendering::RayStatistics total;
+	memset(&total, 0, sizeof(total));
+
+	// 複数のスレッドからscanLineを呼ぶ前に、画像のメモリを確保しておく
+	image.bits();
+
+	int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+	int numTiles = tilesX * ((height + TILE_SIZE - 1) / TILE_SIZE);
+	#pragma omp parallel
+	{
+		VolumeRendering::RayStatistics local;
+		memset(&local, 0, sizeof(local));
+
+		#pragma omp for schedule(dynamic)
+		for (int i = 0; i < numTiles; ++i) {
+			renderTile(inverse, eye, (i % tilesX) * TILE_SIZE, (i / tilesX) * TILE_SIZE, image, local);
+		}
+
+		#pragma omp critical
+		{
+			total.rays += local.rays;
+			total.iterations += local.iterations;
+			total.samples += local.samples;
+			total.lightSteps += local.lightSteps;
+			total.terminated += local.terminated;
+			total.maxCost = std::max(total.maxCost, local.maxCost);
+		}
+	}
+
+	if (statistics != NULL) *statistics = total;
+}
+
+/**
+ * １つのタイルのレイを飛ばす。
+ * 各ピクセルの中心を遠方のクリップ面に逆投影してレイの方向を求め、ボックス[0, 1]^3との交差区間だけをサンプリングする。
+ *
+ * @param inverse		投影行列とモデルビュー行列の積の逆行列
+ * @param eye			視点（テクスチャ座標）
+ * @param x0			タイルの左端
+ * @param y0			タイルの上端
+ * @param image [OUT]	描画先の画像
+ * @param statistics [IN/OUT]	レイの統計（タイルのレイの分を加算する）
+ */
+void CpuRaycaster::renderTile(const QMatrix4x4& inverse, const QVector3D& eye, int x0, int y0, QImage& image, VolumeRendering::RayStatistics& statistics) const {
+	int width = image.width();
+	int height = image.height();
+	int x1 = std::min(x0 + TILE_SIZE, width);
+	int y1 = std::min(y0 + TILE_SIZE, height);
+
+	for (int y = y0; y < y1; ++y) {
+		QRgb* line = (QRgb*)image.scanLine(y);
+		float ndcY = 1.0f - 2.0f * (y + 0.5f) / height;
+		for (int x = x0; x < x1; ++x) {
+			float ndcX = 2.0f * (x + 0.5f) / width - 1.0f;
+			QVector3D dir = (toTexture(inverse.map(QVector3D(ndcX, ndcY, 1.0f))) - eye).normalized();
+
+			// ボックスとの交差区間（スラブ法）
+			float tEnter = 0.0f;
+			float tExit = 1e20f;
+			float e[3] = { eye.x(), eye.y(), eye.z() };
+			float d[3] = { dir.x(), dir.y(), dir.z() };
+			for (int i = 0; i < 3; ++i) {
+				if (fabs(d[i]) < 1e-8f) {
+					if (e[i] < 0.0f || e[i] > 1.0f) tExit = -1.0f;
+					continue;
+				}
+				float t0 = -e[i] / d[i];
+				float t1 = (1.0f - e[i]) / d[i];
+				tEnter = std::max(tEnter, std::min(t0, t1));
+				tExit = std::min(tExit, std::max(t0, t1));
+			}
+
+			if (tEnter >= tExit) {
+				line[x] = qRgb(0, 0, 0);
+				continue;
+			}
+
+			double cost = statistics.samples + statistics.lightSteps;
+			line[x] = traceRay(eye, dir, tEnter, tExit, statistics);
+			statistics.rays++;
+			statistics.maxCost = std::max(statistics.maxCost, (float)(statistics.samples + statistics.lightSteps - cost));
+		}
+	}
+}
+
+/**
+ * 交差区間のサンプルを描画モードに応じて処理し、ピクセルの色を返却する。
+ * サンプルはraycastfs.glslと同じく視点からstepSize毎の位置に取るので、GPUの描画と同じ位置をサンプリングする。
+ *
+ * @param eye		視点（テクスチャ座標）
+ * @param dir		レイの方向（正規化済み）
+ * @param tEnter	ボックスに入る距離
+ * @param tExit		ボックスから出る距離
+ * @param statistics [IN/OUT]	レイの統計
+ * @return			ピクセルの色
+ */
+QRgb CpuRaycaster::traceRay(const QVector3D& eye, const QVector3D& dir, float tEnter, float tExit, VolumeRendering::RayStatistics& statistics) const {
+	int first = (int)ceil(tEnter / stepSize);
+	int last = (int)(tExit / stepSize);
+
+	switch (renderMode) {
+	case VolumeRendering::RENDER_VOLUME:
+		return traceVolume(eye, dir, first, last, statistics);
+	case VolumeRendering::RENDER_ISOSURFACE:
+	case VolumeRendering::RENDER_ISORAYCAST:
+		return traceIsosurface(eye, dir, first, last, statistics);
+	default:
+		return traceProjection(eye, dir, first, last, statistics);
+	}
+}
+
+/**
+ * 光源へのレイマーチングで減衰させた光を、前から順に合成する。
+ * 不透明度はBeer-Lambertで求め、閾値に達したら打ち切る。
+ *
+ * @param eye		視点（テクスチャ座標）
+ * @param dir		レイの方向
+ * @param first		最初のサンプルの番号
+ * @param last		最後のサンプルの番号
+ * @param statistics [IN/OUT]	レイの統計
+ * @return			ピクセルの色
+ */
+QRgb CpuRaycaster::traceVolume(const QVector3D& eye, const QVector3D& dir, int first, int last, VolumeRendering::RayStatistics& statistics) const {
+	float alpha = 0.0f;
+	float color = 0.0f;
+
+	for (int i = first; i <= last; ++i) {
+		QVector3D pos = eye + dir * (stepSize * i);
+		float sampleDens = sampleDensity(pos) * DENSITY_SCALE;
+		statistics.iterations++;
+		statistics.samples++;
+		if (sampleDens <= 1e-5f) continue;
+
+		float sampleAlpha = 1.0f - exp(-sampleDens * ABSORB_RATE * stepSize);
+
+		float lapha = 1.0f;
+		QVector3D lightDir = (lightPos - pos).normalized() * LIGHT_STEP_SIZE;
+		QVector3D lpos = pos + lightDir;
+		for (int s = 0; s < LIGHT_SAMPLES; ++s) {
+			lapha *= 1.0f - LIGHT_ABSORPTION * LIGHT_STEP_SIZE * sampleDensity(lpos);
+			statistics.lightSteps++;
+			if (lapha <= 0.01f) break;
+			lpos += lightDir;
+		}
+
+		color += (1.0f - alpha) * sampleAlpha * 10.0f * lapha / ABSORB_RATE;
+		alpha += (1.0f - alpha) * sampleAlpha;
+		if (alpha >= terminationThreshold) {
+			statistics.terminated++;
+			break;
+		}
+	}
+
+	// 色は不透明度を掛けてあるので、黒の背景にはそのまま書き込めばよい
+	int c = (int)(std::min(std::max(color, 0.0f), 1.0f) * 255.0f + 0.5f);
+	return qRgb(c, c, c);
+}
+
+/**
+ * 等値面との最初の交点を求めてシェーディングする。
+ * 交点はセカント法で絞り込み、法線は密度の中心差分から求める。
+ *
+ * @param eye		視点（テクスチャ座標）
+ * @param dir		レイの方向
+ * @param first		最初のサンプルの番号
+ * @param last		最後のサンプルの番号
+ * @param statistics [IN/OUT]	レイの統計
+ * @return			ピクセルの色
+ */
+QRgb CpuRaycaster::traceIsosurface(const QVector3D& eye, const QVector3D& dir, int first, int last, VolumeRendering::RayStatistics& statistics) const {
+	if (first > last) return qRgb(0, 0, 0);
+
+	QVector3D prevPos = eye + dir * (stepSize * first);
+	float prevDens = sampleDensity(prevPos);
+	statistics.samples++;
+	if (prevDens >= isoValue) {
+		// ボックスに入った時点で内側にいるので、ボックスの面を交点とする
+		prevDens = 0.0f;
+	}
+
+	for (int i = first; i <= last; ++i) {
+		QVector3D pos = eye + dir * (stepSize * i);
+		float dens = sampleDensity(pos);
+		statistics.iterations++;
+		statistics.samples++;
+		if (dens < isoValue) {
+			prevPos = pos;
+			prevDens = dens;
+			continue;
+		}
+
+		QVector3D hit = i == first ? pos : refineHit(prevPos, prevDens, pos, dens);
+		QVector3D n = computeNormal(hit);
+		statistics.samples += (i == first ? 0 : REFINE_STEPS) + 6;
+		statistics.terminated++;
+		QVector3D l = (lightPos - hit).normalized();
+		QVector3D v = (eye - hit).normalized();
+		if (QVector3D::dotProduct(n, n) == 0.0f) n = v;
+		if (QVector3D::dotProduct(n, v) < 0.0f) n = -n;
+		QVector3D h = (l + v).normalized();
+
+		float lit = AMBIENT + DIFFUSE * std::max(QVector3D::dotProduct(n, l), 0.0f);
+		float spec = SPECULAR * pow(std::max(QVector3D::dotProduct(n, h), 0.0f), SHININESS);
+		float rgb[3] = { 0.9f * lit + spec, 0.85f * lit + spec, 0.75f * lit + spec };
+		int c[3];
+		for (int k = 0; k < 3; ++k) {
+			c[k] = (int)(std::min(rgb[k], 1.0f) * 255.0f + 0.5f);
+		}
+		return qRgb(c[0], c[1], c[2]);
+	}
+
+	return qRgb(0, 0, 0);
+}
+
+/**
+ * 最大値、最小値、平均値の投影を計算する。
+ * raycastfs.glslと同じく、結果を変えないブリック（最大値投影では最大値が現在の値以下のブリック、
+ * 最小値投影では最小値が現在の値以上のブリック、平均値投影では空のブリック）は、サンプリングせずに読み飛ばす。
+ *
+ * @param eye		視点（テクスチャ座標）
+ * @param dir		レイの方向
+ * @param first		最初のサンプルの番号
+ * @param last		最後のサンプルの番号
+ * @param statistics [IN/OUT]	レイの統計
+ * @return			ピクセルの色
+ */
+QRgb CpuRaycaster::traceProjection(const QVector3D& eye, const QVector3D& dir, int first, int last, VolumeRendering::RayStatistics& statistics) const {
+	float value = renderMode == VolumeRendering::RENDER_MINIP ? 1e20f : 0.0f;
+	float total = 0.0f;
+	int count = 0;
+
+	for (int i = first; i <= last; ++i) {
+		QVector3D pos = eye + dir * (stepSize * i);
+		statistics.iterations++;
+
+		int bx = std::min(std::max((int)floor((pos.x() * gridWidth - 0.5f) / MinMaxBricks::BRICK_SIZE), 0), minMaxBricks.getBricksX() - 1);
+		int by = std::min(std::max((int)floor((pos.y() * gridHeight - 0.5f) / MinMaxBricks::BRICK_SIZE), 0), minMaxBricks.getBricksY() - 1);
+		int bz = std::min(std::max((int)floor((pos.z() * gridDepth - 0.5f) / MinMaxBricks::BRICK_SIZE), 0), minMaxBricks.getBricksZ() - 1);
+		bool skip;
+		if (renderMode == VolumeRendering::RENDER_MIP) {
+			skip = applyWindow(minMaxBricks.getMax(bx, by, bz)) <= value;
+		} else if (renderMode == VolumeRendering::RENDER_MINIP) {
+			skip = applyWindow(minMaxBricks.getMin(bx, by, bz)) >= value;
+		} else {
+			// 空のブリックは平均に0を加えるだけ
+			skip = applyWindow(minMaxBricks.getMax(bx, by, bz)) <= 0.0f;
+		}
+		if (skip) {
+			int n = std::min(stepsToLeaveBrick(pos, dir, bx, by, bz), last - i + 1);
+			if (renderMode == VolumeRendering::RENDER_AVERAGE) count += n;
+			i += n - 1;
+			continue;
+		}
+
+		float dens = sampleDensity(pos);
+		statistics.samples++;
+		if (renderMode == VolumeRendering::RENDER_MIP) {
+			value = std::max(value, dens);
+		} else if (renderMode == VolumeRendering::RENDER_MINIP) {
+			value = std::min(value, dens);
+		} else {
+			total += dens;
+			count++;
+		}
+	}
+
+	if (renderMode == VolumeRendering::RENDER_AVERAGE) {
+		value = count > 0 ? total / count : 0.0f;
+	} else if (value >= 1e20f) {
+		value = 0.0f;
+	}
+
+	int c = (int)(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+	return qRgb(c, c, c);
+}
+
+/**
+ * posからレイを進めて、ブリック(bx, by, bz)を出るまでのサンプル数を返却する。
+ * ブリックの範囲はraycastfs.glslのstepsToLeaveBrickと同じく、ボクセルの中心の座標で求める。
+ *
+ * @param pos	現在の位置（テクスチャ座標）
+ * @param dir	レイの方向
+ * @param bx	ブリックのX座標
+ * @param by	ブリックのY座標
+ * @param bz	ブリックのZ座標
+ * @return		ブリックを出るまでのサンプル数（1以上）
+ */
+int CpuRaycaster::stepsToLeaveBrick(const QVector3D& pos, const QVector3D& dir, int bx, int by, int bz) const {
+	float p[3] = { pos.x(), pos.y(), pos.z() };
+	float d[3] = { dir.x(), dir.y(), dir.z() };
+	int b[3] = { bx, by, bz };
+	int size[3] = { gridWidth, gridHeight, gridDepth };
+
+	float exit = 1e20f;
+	for (int i = 0; i < 3; ++i) {
+		if (fabs(d[i]) < 1e-8f) continue;
+		float lower = (b[i] * MinMaxBricks::BRICK_SIZE + 0.5f) / size[i];
+		float upper = ((b[i] + 1) * MinMaxBricks::BRICK_SIZE + 0.5f) / size[i];
+		exit = std::min(exit, std::max((lower - p[i]) / d[i], (upper - p[i]) / d[i]));
+	}
+
+	return std::max((int)ceil(exit / stepSize), 1);
+}
+
+/**
+ * 窓を適用し、[0, 1]に写す。窓の上限を超える値は、VolumeRendering::applyWindowと同じく1より大きいまま残す。
+ *
+ * @param value	窓を適用する前の値
+ * @return		窓を適用した値
+ */
+float CpuRaycaster::applyWindow(float value) const {
+	return std::max(value - windowMin, 0.0f) / (windowMax - windowMin);
+}
+
+/**
+ * ボックス座標（原点を中心とするボクセル単位の座標）を、テクスチャ座標に変換する。
+ *
+ * @param p		ボックス座標
+ * @return		テクスチャ座標
+ */
+QVector3D CpuRaycaster::toTexture(const QVector3D& p) const {
+	return QVector3D((p.x() + gridWidth * 0.5f) / gridWidth, (p.y() + gridHeight * 0.5f) / gridHeight, (p.z() + gridDepth * 0.5f) / gridDepth);
+}
+
+/**
+ * 3Dテクスチャと同じく、ボクセルの中心の間を三線形補間し、範囲外は端の値とする（GL_CLAMP_TO_EDGE）。
+ * 補間した値に窓を適用し、[0, 1]に写す。
+ *
+ * @param pos	テクスチャ座標
+ * @return		窓を適用した密度
+ */
+float CpuRaycaster::sampleDensity(const QVector3D& pos) const {
+	float fx = std::min(std::max(pos.x() * gridWidth - 0.5f, 0.0f), (float)(gridWidth - 1));
+	float fy = std::min(std::max(pos.y() * gridHeight - 0.5f, 0.0f), (float)(gridHeight - 1));
+	float fz = std::min(std::max(pos.z() * gridDepth - 0.5f, 0.0f), (float)(gridDepth - 1));
+	int x0 = (int)fx;
+	int y0 = (int)fy;
+	int z0 = (int)fz;
+	float tx = fx - x0;
+	float ty = fy - y0;
+	float tz = fz - z0;
+	int dx = x0 + 1 < gridWidth ? 1 : 0;
+	int dy = y0 + 1 < gridHeight ? gridWidth : 0;
+	int dz = z0 + 1 < gridDepth ? gridWidth * gridHeight : 0;
+
+	const float* p = data + (z0 * gridHeight + y0) * gridWidth + x0;
+	float c00 = p[0] + (p[dx] - p[0]) * tx;
+	float c10 = p[dy] + (p[dy + dx] - p[dy]) * tx;
+	float c01 = p[dz] + (p[dz + dx] - p[dz]) * tx;
+	float c11 = p[dz + dy] + (p[dz + dy + dx] - p[dz + dy]) * tx;
+	float c0 = c00 + (c10 - c00) * ty;
+	float c1 = c01 + (c11 - c01) * ty;
+	float d = c0 + (c1 - c0) * tz;
+
+	return applyWindow(d);
+}
+
+/**
+ * 等値面の値より小さいpos0と大きいpos1の間の交点を、セカント法で絞り込む。
+ *
+ * @param pos0	等値面の手前の位置
+ * @param d0	pos0の密度
+ * @param pos1	等値面の奥の位置
+ * @param d1	pos1の密度
+ * @return		交点
+ */
+QVector3D CpuRaycaster::refineHit(QVector3D pos0, float d0, QVector3D pos1, float d1) const {
+	for (int i = 0; i < REFINE_STEPS; ++i) {
+		float t = std::min(std::max((isoValue - d0) / std::max(d1 - d0, 1e-6f), 0.0f), 1.0f);
+		QVector3D pos = pos0 + (pos1 - pos0) * t;
+		float d = sampleDensity(pos);
+		if (d < isoValue) {
+			pos0 = pos;
+			d0 = d;
+		} else {
+			pos1 = pos;
+			d1 = d;
+		}
+	}
+
+	float t = std::min(std::max((isoValue - d0) / std::max(d1 - d0, 1e-6f), 0.0f), 1.0f);
+	return pos0 + (pos1 - pos0) * t;
+}
+
+/**
+ * 密度の中心差分から、等値面の外向きの法線を求める。
+ * 光の計算はテクスチャ座標で行うので、勾配をグリッドのサイズで補正する。
+ *
+ * @param pos	テクスチャ座標
+ * @return		法線（勾配が無い場合は0）
+ */
+QVector3D CpuRaycaster::computeNormal(const QVector3D& pos) const {
+	float hx = 1.0f / gridWidth;
+	float hy = 1.0f / gridHeight;
+	float hz = 1.0f / gridDepth;
+	float gx = sampleDensity(pos + QVector3D(hx, 0, 0)) - sampleDensity(pos - QVector3D(hx, 0, 0));
+	float gy = sampleDensity(pos + QVector3D(0, hy, 0)) - sampleDensity(pos - QVector3D(0, hy, 0));
+	float gz = sampleDensity(pos + QVector3D(0, 0, hz)) - sampleDensity(pos - QVector3D(0, 0, hz));
+	if (gx * gx + gy * gy + gz * gz < 1e-12f) return QVector3D(0, 0, 0);
+
+	return QVector3D(-gx / hx, -gy / hy, -gz / hz).normalized();
+}
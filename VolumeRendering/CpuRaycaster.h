@@ -0,0 +1,52 @@
+#pragma once
+
+#include "VolumeRendering.h"
+#include <QImage>
+#include <QRgb>
+#include <QVector3D>
+#include <QMatrix4x4>
+#include "MinMaxBricks.h"
+
+class CpuRaycaster {
+public:
+	static const int TILE_SIZE = 32;
+
+private:
+	int gridWidth;
+	int gridHeight;
+	int gridDepth;
+	const float* data;
+	MinMaxBricks minMaxBricks;
+
+	int renderMode;
+	float windowMin;
+	float windowMax;
+	float isoValue;
+	QVector3D lightPos;
+	float terminationThreshold;
+	float stepSize;
+
+public:
+	CpuRaycaster(int width, int height, int depth, const float* data);
+
+	void setWindow(float windowMin, float windowMax);
+	void setRenderMode(int renderMode);
+	void setIsoValue(float isoValue);
+	void setLightPosition(const QVector3D& lightPos);
+	void setTerminationThreshold(float terminationThreshold);
+	void render(const QMatrix4x4& modelview, const QMatrix4x4& projection, int width, int height, QImage& image, VolumeRendering::RayStatistics* statistics = NULL) const;
+
+private:
+	void renderTile(const QMatrix4x4& inverse, const QVector3D& eye, int x0, int y0, QImage& image, VolumeRendering::RayStatistics& statistics) const;
+	QRgb traceRay(const QVector3D& eye, const QVector3D& dir, float tEnter, float tExit, VolumeRendering::RayStatistics& statistics) const;
+	QRgb traceVolume(const QVector3D& eye, const QVector3D& dir, int first, int last, VolumeRendering::RayStatistics& statistics) const;
+	QRgb traceIsosurface(const QVector3D& eye, const QVector3D& dir, int first, int last, VolumeRendering::RayStatistics& statistics) const;
+	QRgb traceProjection(const QVector3D& eye, const QVector3D& dir, int first, int last, VolumeRendering::RayStatistics& statistics) const;
+	int stepsToLeaveBrick(const QVector3D& pos, const QVector3D& dir, int bx, int by, int bz) const;
+	float applyWindow(float value) const;
+	QVector3D toTexture(const QVector3D& p) const;
+	float sampleDensity(const QVector3D& pos) const;
+	QVector3D refineHit(QVector3D pos0, float d0, QVector3D pos1, float d1) const;
+	QVector3D computeNormal(const QVector3D& pos) const;
+};
+
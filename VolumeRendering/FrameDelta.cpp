@@ -0,0 +1,187 @@
+﻿#include "FrameDelta.h"
+#include <math.h>
+
+/**
+ * 時系列データの連続する２フレーム間の差分を、BRICK_SIZE^3のブリック単位で保持する。
+ * 変化したブリックのデータだけを持つので、メモリと転送量は変化した領域に比例する。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ */
+FrameDelta::FrameDelta(int width, int height, int depth) {
+	this->width = width;
+	this->height = height;
+	this->depth = depth;
+
+	bricksX = (width + BRICK_SIZE - 1) / BRICK_SIZE;
+	bricksY = (height + BRICK_SIZE - 1) / BRICK_SIZE;
+	bricksZ = (depth + BRICK_SIZE - 1) / BRICK_SIZE;
+}
+
+/**
+ * ２つのフレームを比較し、値がtoleranceより大きく変化したボクセルを含むブリックを求める。
+ * ブリック単位で全コアに分散して比較し、変化したブリックのデータをnextからコピーする。
+ * prevがNULLの場合は、全ブリックを含むキーフレームとなる。
+ *
+ * @param prev			前のフレーム（NULL可）
+ * @param next			次のフレーム
+ * @param tolerance		変化とみなさない誤差
+ */
+void FrameDelta::compute(const float* prev, const float* next, float tolerance) {
+	int num = numTotalBricks();
+	std::vector<char> changed(num, prev == NULL ? 1 : 0);
+
+	if (prev != NULL) {
+		#pragma omp parallel for schedule(dynamic)
+		for (int brick = 0; brick < num; ++brick) {
+			int x0, y0, z0, w, h, d;
+			getBrickExtent(brick, x0, y0, z0, w, h, d);
+
+			// 1つでも変化したボクセルが見つかれば、そのブリックの比較は打ち切る
+			bool diff = false;
+			for (int z = z0; z < z0 + d && !diff; ++z) {
+				for (int y = y0; y < y0 + h && !diff; ++y) {
+					int index = (z * height + y) * width + x0;
+					for (int x = 0; x < w; ++x) {
+						if (fabs(next[index + x] - prev[index + x]) > tolerance) {
+							diff = true;
+							break;
+						}
+					}
+				}
+			}
+			changed[brick] = diff ? 1 : 0;
+		}
+	}
+
+	// 変化したブリックのリストと、データの格納位置を決める
+	bricks.clear();
+	offsets.clear();
+	int size = 0;
+	for (int brick = 0; brick < num; ++brick) {
+		if (!changed[brick]) continue;
+
+		int x0, y0, z0, w, h, d;
+		getBrickExtent(brick, x0, y0, z0, w, h, d);
+		bricks.push_back(brick);
+		offsets.push_back(size);
+		size += w * h * d;
+	}
+	brickData.resize(size);
+
+	#pragma omp parallel for schedule(dynamic)
+	for (int i = 0; i < (int)bricks.size(); ++i) {
+		copyBrick(bricks[i], next, &brickData[offsets[i]]);
+	}
+}
+
+/**
+ * この差分の後に、指定した差分を続けて適用した場合と同じになるように、２つの差分を統合する。
+ * 両方に含まれるブリックは、nextのデータを使う。
+ *
+ * @param next		後の差分
+ */
+void FrameDelta::merge(const FrameDelta& next) {
+	std::vector<int> mergedBricks;
+	std::vector<int> mergedOffsets;
+	std::vector<float> mergedData;
+
+	int i = 0;
+	int j = 0;
+	while (i < (int)bricks.size() || j < (int)next.bricks.size()) {
+		int brick;
+		const float* src;
+		if (j >= (int)next.bricks.size() || (i < (int)bricks.size() && bricks[i] < next.bricks[j])) {
+			brick = bricks[i];
+			src = getBrickData(i++);
+		} else {
+			if (i < (int)bricks.size() && bricks[i] == next.bricks[j]) i++;
+			brick = next.bricks[j];
+			src = next.getBrickData(j++);
+		}
+
+		int x0, y0, z0, w, h, d;
+		getBrickExtent(brick, x0, y0, z0, w, h, d);
+		mergedBricks.push_back(brick);
+		mergedOffsets.push_back(mergedData.size());
+		mergedData.insert(mergedData.end(), src, src + w * h * d);
+	}
+
+	bricks.swap(mergedBricks);
+	offsets.swap(mergedOffsets);
+	brickData.swap(mergedData);
+}
+
+/**
+ * 差分をフレームに適用する。
+ *
+ * @param frame [IN/OUT]	前のフレーム。適用後は次のフレームになる
+ */
+void FrameDelta::apply(float* frame) const {
+	#pragma omp parallel for schedule(dynamic)
+	for (int i = 0; i < (int)bricks.size(); ++i) {
+		int x0, y0, z0, w, h, d;
+		getBrickExtent(bricks[i], x0, y0, z0, w, h, d);
+
+		const float* src = &brickData[offsets[i]];
+		for (int z = z0; z < z0 + d; ++z) {
+			for (int y = y0; y < y0 + h; ++y) {
+				float* dst = frame + (z * height + y) * width + x0;
+				for (int x = 0; x < w; ++x) {
+					dst[x] = *src++;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * 変化したブリックが無い状態にする。
+ */
+void FrameDelta::clear() {
+	bricks.clear();
+	offsets.clear();
+	brickData.clear();
+}
+
+/**
+ * 指定したブリックの範囲を返却する。端のブリックはBRICK_SIZEより小さくなる。
+ *
+ * @param brick			ブリックのインデックス
+ * @param x0 [OUT]		開始位置のx座標
+ * @param y0 [OUT]		開始位置のy座標
+ * @param z0 [OUT]		開始位置のz座標
+ * @param w [OUT]		幅
+ * @param h [OUT]		高さ
+ * @param d [OUT]		奥行き
+ */
+void FrameDelta::getBrickExtent(int brick, int& x0, int& y0, int& z0, int& w, int& h, int& d) const {
+	x0 = (brick % bricksX) * BRICK_SIZE;
+	y0 = (brick / bricksX % bricksY) * BRICK_SIZE;
+	z0 = (brick / bricksX / bricksY) * BRICK_SIZE;
+	w = x0 + BRICK_SIZE <= width ? BRICK_SIZE : width - x0;
+	h = y0 + BRICK_SIZE <= height ? BRICK_SIZE : height - y0;
+	d = z0 + BRICK_SIZE <= depth ? BRICK_SIZE : depth - z0;
+}
+
+/**
+ * フレームから、指定したブリックのデータを詰めてコピーする。
+ *
+ * @param brick			ブリックのインデックス
+ * @param frame			フレーム
+ * @param dst [OUT]		コピー先
+ */
+void FrameDelta::copyBrick(int brick, const float* frame, float* dst) const {
+	int x0, y0, z0, w, h, d;
+	getBrickExtent(brick, x0, y0, z0, w, h, d);
+
+	for (int z = z0; z < z0 + d; ++z) {
+		for (int y = y0; y < y0 + h; ++y) {
+			const float* src = frame + (z * height + y) * width + x0;
+			for (int x = 0; x < w; ++x) {
+				*dst++ = src[x];
+			}
+		}
+	}
+}
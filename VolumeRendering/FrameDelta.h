@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+
+class FrameDelta {
+public:
+	static const int BRICK_SIZE = 32;
+
+private:
+	int width;
+	int height;
+	int depth;
+	int bricksX;
+	int bricksY;
+	int bricksZ;
+
+	std::vector<int> bricks;
+	std::vector<int> offsets;
+	std::vector<float> brickData;
+
+public:
+	FrameDelta(int width, int height, int depth);
+
+	void compute(const float* prev, const float* next, float tolerance = 0.0f);
+	void merge(const FrameDelta& next);
+	void apply(float* frame) const;
+	void clear();
+
+	int numBricks() const { return bricks.size(); }
+	int numTotalBricks() const { return bricksX * bricksY * bricksZ; }
+	int getBrick(int i) const { return bricks[i]; }
+	const float* getBrickData(int i) const { return &brickData[offsets[i]]; }
+	void getBrickExtent(int brick, int& x0, int& y0, int& z0, int& w, int& h, int& d) const;
+	int byteSize() const { return brickData.size() * sizeof(float); }
+
+private:
+	void copyBrick(int brick, const float* frame, float* dst) const;
+};
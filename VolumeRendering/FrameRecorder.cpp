@@ -0,0 +1,376 @@
+﻿#include "FrameRecorder.h"
+#include <iostream>
+#include <string.h>
+#include <QMutexLocker>
+#include <QImage>
+#include "Profiler.h"
+
+// フレームが1つしか書き出されず、フレームレートを測れない場合のフレームレート
+#define DEFAULT_FRAME_RATE	30.0
+
+FrameRecorder::FrameRecorder() : encoder(this) {
+	for (int i = 0; i < NUM_PBOS; ++i) {
+		readbacks[i].pbo = 0;
+		readbacks[i].size = 0;
+		readbacks[i].fence = 0;
+		readbacks[i].width = 0;
+		readbacks[i].height = 0;
+		readbacks[i].record = false;
+		readbacks[i].timestamp = 0;
+	}
+	oldestReadback = 0;
+	numReadbacks = 0;
+
+	recording = false;
+	format = FORMAT_PNG;
+	capturedFrames = 0;
+	writtenFrames = 0;
+	droppedFrames = 0;
+	firstTimestamp = 0;
+	lastTimestamp = 0;
+
+	quit = false;
+	rawFile = NULL;
+	rawWidth = 0;
+	rawHeight = 0;
+
+	encoder.start();
+}
+
+/**
+ * 残っているフレームを書き出してから、エンコードのスレッドを終了する。
+ * PBOとフェンスを削除するので、OpenGLのコンテキストをカレントにしてから破棄すること。
+ */
+FrameRecorder::~FrameRecorder() {
+	stopRecording();
+
+	{
+		QMutexLocker locker(&mutex);
+		quit = true;
+		queueChanged.wakeAll();
+	}
+	encoder.wait();
+
+	for (int i = 0; i < NUM_PBOS; ++i) {
+		if (readbacks[i].fence != 0) glDeleteSync(readbacks[i].fence);
+		if (readbacks[i].pbo > 0) glDeleteBuffers(1, &readbacks[i].pbo);
+	}
+}
+
+/**
+ * 録画を開始する。以降、captureに渡したフレームを書き出す。
+ * 録画していない間はエンコードのスレッドは何もしていないので、パスやファイルはロックせずに設定できる。
+ * PNGの場合は、pathに連番と拡張子を付けたファイル（path_00000.pngなど）に、
+ * 生の動画の場合は、pathのファイルに、上の行から並べたBGRAのフレームを続けて書き出す。
+ * フレーム毎にキャプチャした時刻を記録し、終了時に実際のフレームレートを求める。
+ *
+ * @param path		PNGの場合はファイル名の接頭辞、生の動画の場合はファイル名
+ * @param format	FORMAT_PNGまたはFORMAT_RAW
+ * @return			開始できた場合はtrue
+ */
+bool FrameRecorder::startRecording(const std::string& path, int format) {
+	stopRecording();
+
+	if (format == FORMAT_RAW) {
+		rawFile = fopen(path.c_str(), "wb");
+		if (rawFile == NULL) {
+			std::cout << "Unable to open " << path << std::endl;
+			return false;
+		}
+		rawWidth = 0;
+		rawHeight = 0;
+	}
+
+	this->path = path;
+	this->format = format;
+	capturedFrames = 0;
+	writtenFrames = 0;
+	droppedFrames = 0;
+	firstTimestamp = 0;
+	lastTimestamp = 0;
+	recordClock.start();
+	recording = true;
+
+	return true;
+}
+
+/**
+ * 録画を終了する。読み戻し中のフレームは待って、エンコードの待ち行列が空になるまで書き出す。
+ * 終了時だけは、描画のスレッドを止めてもよい。
+ * 描画のフレームレートは一定ではないので、動画への変換方法は、書き出したフレームの時刻から測ったフレームレートで出力する。
+ */
+void FrameRecorder::stopRecording() {
+	if (!recording) return;
+	recording = false;
+
+	collect(true);
+	flush();
+
+	if (rawFile != NULL) {
+		fclose(rawFile);
+		rawFile = NULL;
+	}
+
+	printf("Recorded %d of %d frames to %s", writtenFrames, capturedFrames, path.c_str());
+	if (droppedFrames > 0) {
+		printf(" (%d frames were dropped)", droppedFrames);
+	}
+	printf("\n");
+	if (writtenFrames == 0) return;
+
+	double fps = getFrameRate();
+	if (format == FORMAT_RAW) {
+		printf("Convert it with: ffmpeg -f rawvideo -pixel_format bgra -video_size %dx%d -framerate %.3f -i %s output.mp4\n", rawWidth, rawHeight, fps, path.c_str());
+	} else {
+		printf("Convert it with: ffmpeg -framerate %.3f -i %s_%%05d.png output.mp4\n", fps, path.c_str());
+	}
+}
+
+/**
+ * 最初と最後に書き出したフレームの時刻から、平均のフレームレートを求める。
+ * 途中で捨てたフレームの分は時間だけが進むので、変換した動画の長さは録画した時間と同じになる。
+ *
+ * @return	1秒あたりのフレーム数
+ */
+double FrameRecorder::getFrameRate() const {
+	if (writtenFrames < 2 || lastTimestamp <= firstTimestamp) return DEFAULT_FRAME_RATE;
+
+	return (writtenFrames - 1) * 1000.0 / (lastTimestamp - firstTimestamp);
+}
+
+/**
+ * 次にcaptureに渡されるフレームを、スクリーンショットとして保存する。
+ *
+ * @param filename	ファイル名
+ */
+void FrameRecorder::requestScreenshot(const std::string& filename) {
+	screenshotFilename = filename;
+}
+
+/**
+ * フレームバッファの内容の読み戻しを、PBOへの非同期の転送として発行し、フェンスを置く。
+ * 転送が終わったPBOだけを回収してエンコードのスレッドに渡すので、描画のスレッドは待たない。
+ * PBOが全て転送中の場合は、待たずにそのフレームを捨てる。
+ * 録画中にスクリーンショットを要求された場合は、同じ読み戻しを両方に使う。
+ *
+ * @param fbo		読み戻すフレームバッファ（０の場合はバックバッファ）
+ * @param width		幅
+ * @param height	高さ
+ */
+void FrameRecorder::capture(GLuint fbo, int width, int height) {
+	PROFILE_SCOPE("capture");
+
+	collect(false);
+
+	if (!recording && screenshotFilename.empty()) return;
+
+	if (recording) {
+		capturedFrames++;
+	}
+	if (numReadbacks == NUM_PBOS) {
+		// スクリーンショットは、要求を残して次のフレームで撮る
+		if (recording) {
+			QMutexLocker locker(&mutex);
+			droppedFrames++;
+		}
+		return;
+	}
+
+	Readback& readback = readbacks[(oldestReadback + numReadbacks) % NUM_PBOS];
+	int size = width * height * 4;
+	if (readback.pbo == 0) {
+		glGenBuffers(1, &readback.pbo);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+	if (readback.size != size) {
+		glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+		readback.size = size;
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+	if (fbo == 0) {
+		glReadBuffer(GL_BACK);
+	}
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glReadPixels(0, 0, width, height, GL_BGRA, GL_UNSIGNED_BYTE, 0);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+	readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	readback.width = width;
+	readback.height = height;
+	readback.record = recording;
+	readback.timestamp = recording ? recordClock.elapsed() : 0;
+
+	// 録画のフレームは、捨てられても連番が飛ばないように、エンコードのスレッドで名前を付ける
+	readback.filename = screenshotFilename;
+	screenshotFilename.clear();
+	numReadbacks++;
+}
+
+/**
+ * 転送が終わったPBOを、待たずに回収する。
+ * 最後のフレームの後、次のフレームが描画されない場合に、定期的に呼び出すこと。
+ */
+void FrameRecorder::poll() {
+	collect(false);
+}
+
+/**
+ * 転送が終わったPBOを古い順に回収し、エンコードの待ち行列に入れる。
+ * 順番を保つため、まだ終わっていないPBOがあれば、それ以降は次の機会に回す。
+ *
+ * @param wait	転送が終わるまで待つ場合はtrue
+ */
+void FrameRecorder::collect(bool wait) {
+	while (numReadbacks > 0) {
+		Readback& readback = readbacks[oldestReadback];
+		GLenum result = glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? 1000000000ULL : 0);
+		if (result == GL_TIMEOUT_EXPIRED) break;
+		glDeleteSync(readback.fence);
+		readback.fence = 0;
+
+		if (result != GL_WAIT_FAILED) {
+			Frame* frame = new Frame();
+			frame->width = readback.width;
+			frame->height = readback.height;
+			frame->record = readback.record;
+			frame->timestamp = readback.timestamp;
+			frame->filename = readback.filename;
+			frame->pixels.resize(readback.size);
+
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+			void* pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback.size, GL_MAP_READ_BIT);
+			if (pixels != NULL) {
+				memcpy(&frame->pixels[0], pixels, readback.size);
+				glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+				enqueue(frame);
+			} else {
+				if (frame->record) {
+					QMutexLocker locker(&mutex);
+					droppedFrames++;
+				}
+				delete frame;
+			}
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		}
+
+		oldestReadback = (oldestReadback + 1) % NUM_PBOS;
+		numReadbacks--;
+	}
+}
+
+/**
+ * フレームをエンコードの待ち行列に入れる。
+ * エンコードが追いつかず、待ち行列が一杯の場合は、描画のスレッドを止めないように捨てる。
+ *
+ * @param frame		フレーム（エンコードのスレッドが削除する）
+ */
+void FrameRecorder::enqueue(Frame* frame) {
+	QMutexLocker locker(&mutex);
+
+	if ((int)queue.size() >= MAX_QUEUED_FRAMES) {
+		if (frame->record) droppedFrames++;
+		delete frame;
+		return;
+	}
+
+	queue.push_back(frame);
+	queueChanged.wakeAll();
+}
+
+/**
+ * エンコードの待ち行列が空になるまで待つ。
+ */
+void FrameRecorder::flush() {
+	QMutexLocker locker(&mutex);
+
+	while (!queue.empty()) {
+		queueChanged.wait(&mutex);
+	}
+}
+
+/**
+ * フレームを書き出す。エンコードのスレッドで実行する。
+ * ファイル名の付いたフレームはスクリーンショットとして保存し、録画のフレームは、PNGの連番か、生の動画に書き出す。
+ * 録画中のスクリーンショットは、両方に書き出す。
+ * OpenGLは下の行から並ぶので、上下を反転して書き出す。
+ *
+ * @param frame		フレーム
+ */
+void FrameRecorder::encode(Frame* frame) {
+	PROFILE_SCOPE("encode");
+
+	if (!frame->filename.empty()) {
+		savePng(frame, frame->filename);
+	}
+	if (!frame->record) return;
+
+	if (format == FORMAT_RAW) {
+		if (rawFile == NULL) return;
+
+		// 生の動画は、最初のフレームのサイズに揃える（ウィンドウのサイズを変えたフレームは捨てる）
+		if (rawWidth == 0) {
+			rawWidth = frame->width;
+			rawHeight = frame->height;
+		}
+		if (frame->width != rawWidth || frame->height != rawHeight) {
+			QMutexLocker locker(&mutex);
+			droppedFrames++;
+			return;
+		}
+
+		int stride = frame->width * 4;
+		for (int y = frame->height - 1; y >= 0; --y) {
+			fwrite(&frame->pixels[y * stride], 1, stride, rawFile);
+		}
+	} else {
+		char suffix[32];
+		sprintf(suffix, "_%05d.png", writtenFrames);
+		savePng(frame, path + suffix);
+	}
+
+	if (writtenFrames == 0) firstTimestamp = frame->timestamp;
+	lastTimestamp = frame->timestamp;
+	writtenFrames++;
+}
+
+/**
+ * フレームをPNGファイルに保存する。
+ * 画面のアルファは意味を持たないので、RGB32として保存する。
+ *
+ * @param frame		フレーム
+ * @param filename	ファイル名
+ */
+void FrameRecorder::savePng(Frame* frame, const std::string& filename) {
+	QImage image(&frame->pixels[0], frame->width, frame->height, QImage::Format_RGB32);
+	if (!image.mirrored().save(QString::fromUtf8(filename.c_str()))) {
+		std::cout << "Unable to save " << filename << std::endl;
+	}
+}
+
+/**
+ * 待ち行列からフレームを取り出して書き出す。待ち行列が空の間は眠る。
+ */
+void FrameRecorder::EncoderThread::run() {
+	while (true) {
+		Frame* frame;
+		{
+			QMutexLocker locker(&recorder->mutex);
+			while (recorder->queue.empty() && !recorder->quit) {
+				recorder->queueChanged.wait(&recorder->mutex);
+			}
+			if (recorder->queue.empty()) return;
+
+			frame = recorder->queue.front();
+		}
+
+		recorder->encode(frame);
+		delete frame;
+
+		// 書き出し終わってから取り除くので、flushは最後のフレームの書き出しまで待つ
+		QMutexLocker locker(&recorder->mutex);
+		recorder->queue.pop_front();
+		recorder->queueChanged.wakeAll();
+	}
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <stdio.h>
+#include <vector>
+#include <deque>
+#include <string>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThread>
+#include <QElapsedTimer>
+
+class FrameRecorder {
+public:
+	enum { FORMAT_PNG = 0, FORMAT_RAW };
+
+	static const int NUM_PBOS = 3;
+	static const int MAX_QUEUED_FRAMES = 16;
+
+private:
+	struct Readback {
+		GLuint pbo;
+		int size;
+		GLsync fence;
+		int width;
+		int height;
+		bool record;
+		qint64 timestamp;
+		std::string filename;
+	};
+
+	struct Frame {
+		std::vector<unsigned char> pixels;
+		int width;
+		int height;
+		bool record;
+		qint64 timestamp;
+		std::string filename;
+	};
+
+	class EncoderThread : public QThread {
+	private:
+		FrameRecorder* recorder;
+
+	public:
+		EncoderThread(FrameRecorder* recorder) : recorder(recorder) {}
+
+	protected:
+		void run();
+	};
+
+	Readback readbacks[NUM_PBOS];
+	int oldestReadback;
+	int numReadbacks;
+
+	bool recording;
+	int format;
+	std::string path;
+	int capturedFrames;
+	int writtenFrames;
+	int droppedFrames;
+	QElapsedTimer recordClock;
+	qint64 firstTimestamp;
+	qint64 lastTimestamp;
+	std::string screenshotFilename;
+
+	EncoderThread encoder;
+	QMutex mutex;
+	QWaitCondition queueChanged;
+	std::deque<Frame*> queue;
+	bool quit;
+	FILE* rawFile;
+	int rawWidth;
+	int rawHeight;
+
+public:
+	FrameRecorder();
+	~FrameRecorder();
+
+	bool startRecording(const std::string& path, int format);
+	void stopRecording();
+	bool isRecording() const { return recording; }
+	void requestScreenshot(const std::string& filename);
+	bool isActive() const { return recording || !screenshotFilename.empty() || numReadbacks > 0; }
+	void capture(GLuint fbo, int width, int height);
+	void poll();
+	bool hasPendingReadbacks() const { return numReadbacks > 0; }
+
+private:
+	void collect(bool wait);
+	void enqueue(Frame* frame);
+	void encode(Frame* frame);
+	void savePng(Frame* frame, const std::string& filename);
+	double getFrameRate() const;
+	void flush();
+};
+
@@ -4,10 +4,52 @@
 #include <GL/GLU.h>
 #include <QRgb>
 #include "Util.h"
+#include "Profiler.h"
+#include "CpuRaycaster.h"
+#include "SequenceRenderer.h"
+#include <QTimer>
+#include <algorithm>
+#include <stdio.h>
 
 #define SQR(x)	((x) * (x))
 
+// interval to collect the frames that are still being read back once nothing is drawn [ms]
+#define CAPTURE_POLL_INTERVAL	10
+
+// time between the keyframes added from the current view, and the length of the default orbit [s]
+#define KEYFRAME_INTERVAL	2.0f
+#define ORBIT_DURATION		8.0f
+
 GLWidget3D::GLWidget3D() {
+	compressVolume = false;
+	sparseVolume = false;
+
+	sequence = NULL;
+	playbackFPS = 30;
+	playbackStart = 0;
+	displayedFrame = 0;
+	shownFrames = 0;
+	droppedFrames = 0;
+	stalledTicks = 0;
+	uploadedBytes = 0;
+	deltaPlayback = false;
+
+	splatter = NULL;
+
+	recorder = new FrameRecorder();
+
+	// swap the buffers in glDraw() so that the swap can be profiled separately from paintGL()
+	setAutoBufferSwap(false);
+}
+
+GLWidget3D::~GLWidget3D() {
+	stopSequence();
+
+	delete splatter;
+
+	// the recorder deletes its pixel buffers
+	makeCurrent();
+	delete recorder;
 }
 
 /**
@@ -21,6 +63,9 @@ void GLWidget3D::mousePressEvent(QMouseEvent *e) {
  * This event handler is called when the mouse release events occur.
  */
 void GLWidget3D::mouseReleaseEvent(QMouseEvent *e) {
+	// Trace every pixel again once the camera stops, so that the reprojection errors do not remain.
+	makeCurrent();
+	vr->invalidateHistory();
 	updateGL();
 }
 
@@ -32,7 +77,10 @@ void GLWidget3D::mouseMoveEvent(QMouseEvent *e) {
 	float dy = (float)(e->y() - lastPos.y());
 	lastPos = e->pos();
 
-	if (e->buttons() & Qt::LeftButton) {
+	if ((e->buttons() & Qt::LeftButton) && (e->modifiers() & Qt::ControlModifier)) {
+		setLightPosition(vr->getLightPosition() + QVector3D(dx * 0.01f, -dy * 0.01f, 0.0f));
+		return;
+	} else if (e->buttons() & Qt::LeftButton) {
 		camera.changeXRotation(dy);
 		camera.changeYRotation(dx);
 	} else if (e->buttons() & Qt::RightButton) {
@@ -46,6 +94,57 @@ void GLWidget3D::mouseMoveEvent(QMouseEvent *e) {
 	updateGL();
 }
 
+/**
+ * This event handler is called when the playback timer or the capture timer fires.
+ * The frame that should be on screen is derived from the elapsed time and the target FPS,
+ * so frames that were not prefetched in time are skipped and counted as dropped.
+ */
+void GLWidget3D::timerEvent(QTimerEvent *e) {
+	if (e->timerId() == captureTimer.timerId()) {
+		makeCurrent();
+		recorder->poll();
+		if (!recorder->hasPendingReadbacks()) captureTimer.stop();
+		return;
+	}
+
+	if (e->timerId() != timer.timerId() || sequence == NULL) return;
+
+	int position = playbackStart + (int)(playbackClock.elapsed() * playbackFPS / 1000);
+	if (position <= displayedFrame) return;
+
+	int index;
+	if (sequence->isDeltaEncoding()) {
+		// only the bricks that changed since the displayed frame are uploaded
+		FrameDelta* delta = sequence->takeDelta(position, index);
+		if (delta == NULL) {
+			stalledTicks++;
+			return;
+		}
+
+		makeCurrent();
+		uploadedBytes += vr->updateVolumeData(*delta);
+		delete delta;
+	} else {
+		float* data = sequence->takeLatestFrame(position, index);
+		if (data == NULL) {
+			// the next frame is still being loaded by the worker threads
+			stalledTicks++;
+			return;
+		}
+
+		makeCurrent();
+		vr->updateVolumeData(data);
+		uploadedBytes += (long long)sequence->getWidth() * sequence->getHeight() * sequence->getDepth() * sizeof(float);
+		delete [] data;
+	}
+
+	droppedFrames += index - displayedFrame - 1;
+	shownFrames++;
+	displayedFrame = index;
+
+	updateGL();
+}
+
 /**
  * This function is called once before the first call to paintGL() or resizeGL().
  */
@@ -79,6 +178,9 @@ void GLWidget3D::resizeGL(int width, int height) {
  * This function is called whenever the widget needs to be painted.
  */
 void GLWidget3D::paintGL() {
+	PROFILE_SCOPE("paintGL");
+	PROFILE_GPU_SCOPE("paintGL");
+
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 	glMatrixMode(GL_MODELVIEW);
@@ -87,6 +189,40 @@ void GLWidget3D::paintGL() {
 
 
 	vr->render(QVector3D(camera.getCamPos()));
+
+	if (vr->isStatistics() && vr->getRayStatistics().rays > 0) {
+		const VolumeRendering::RayStatistics& stats = vr->getRayStatistics();
+		printf("Rays: %d, per ray: %.1f iterations, %.1f samples, %.1f light steps, terminated %.1f%%, max cost %.0f, total %.0f samples\n", stats.rays, stats.iterations / stats.rays, stats.samples / stats.rays, stats.lightSteps / stats.rays, stats.terminated * 100.0 / stats.rays, stats.maxCost, stats.samples + stats.lightSteps);
+	}
+
+	// keep drawing while the progressive rendering is still averaging frames
+	if (vr->needsRefinement()) {
+		QTimer::singleShot(0, this, SLOT(updateGL()));
+	}
+}
+
+/**
+ * Draw a frame and swap the buffers, bracketed by the profiler's frame boundaries.
+ */
+void GLWidget3D::glDraw() {
+	makeCurrent();
+	Profiler::beginFrame();
+
+	{
+		PROFILE_SCOPE("frame");
+		QGLWidget::glDraw();
+
+		// read the back buffer before the swap, without waiting for it
+		if (recorder->isActive()) {
+			recorder->capture(0, width(), height());
+			if (recorder->hasPendingReadbacks()) captureTimer.start(CAPTURE_POLL_INTERVAL, this);
+		}
+
+		PROFILE_SCOPE("swapBuffers");
+		if (doubleBuffer()) swapBuffers();
+	}
+
+	Profiler::endFrame();
 }
 
 QVector2D GLWidget3D::mouseTo2D(int x,int y) {
@@ -110,13 +246,393 @@ QVector2D GLWidget3D::mouseTo2D(int x,int y) {
 }
 
 void GLWidget3D::loadVTK(char* filename) {
+	stopSequence();
+
 	float* data;
 	int width, height, depth;
-	Util::loadVTK(filename, width, height, depth, &data);
+	VolumeHistogram histogram;
+	if (!Util::loadVTK(filename, width, height, depth, &data, &histogram)) {
+		std::cout << "Unable to load " << filename << std::endl;
+		return;
+	}
+
+	// set the window from the percentiles, so that low-contrast scans are visible without tweaking
+	float windowMin, windowMax;
+	histogram.getAutoWindow(windowMin, windowMax);
+	printf("Density: min %.4f, max %.4f, 1%% %.4f, 50%% %.4f, 99%% %.4f, window [%.4f, %.4f]\n", histogram.getMin(), histogram.getMax(), histogram.percentile(0.01f), histogram.percentile(0.5f), histogram.percentile(0.99f), windowMin, windowMax);
+
+	makeCurrent();
+	vr->setWindow(windowMin, windowMax);
+	if (compressVolume) {
+		vr->setCompressedVolumeData(width, height, depth, data);
+	} else if (sparseVolume) {
+		// the densities below the window are invisible, so the bricks that contain only them are empty
+		vr->setSparseVolumeData(width, height, depth, data, windowMin);
+	} else {
+		vr->setVolumeData(width, height, depth, data);
+	}
+
+	delete [] data;
+
+	updateGL();
+}
+
+/**
+ * Set whether volumes loaded afterwards are stored as BC4 compressed textures.
+ */
+void GLWidget3D::setCompressVolume(bool compress) {
+	compressVolume = compress;
+}
+
+/**
+ * Set whether volumes loaded afterwards are stored as occupied bricks only.
+ * If compression is also enabled, compression takes precedence.
+ */
+void GLWidget3D::setSparseVolume(bool sparse) {
+	sparseVolume = sparse;
+}
+
+/**
+ * Switch between the light march and Blinn-Phong shading with the precomputed gradient volume.
+ */
+void GLWidget3D::setShading(bool shading) {
+	makeCurrent();
+	vr->setShading(shading);
+	updateGL();
+}
+
+/**
+ * Switch between the light march and the transmittance volume precomputed by a plane sweep.
+ * While it is on, the light can be moved with Ctrl + left drag.
+ */
+void GLWidget3D::setPrecomputedLight(bool precomputedLight) {
+	makeCurrent();
+	vr->setPrecomputedLight(precomputedLight);
+	updateGL();
+}
+
+/**
+ * Set whether the precomputed ambient occlusion volume darkens densely surrounded regions.
+ */
+void GLWidget3D::setAmbientOcclusion(bool ambientOcclusion) {
+	makeCurrent();
+	vr->setAmbientOcclusion(ambientOcclusion);
+	updateGL();
+}
+
+/**
+ * Switch between the volume ray casting, the isosurface modes and the intensity projections.
+ * See VolumeRendering::setRenderMode for the modes.
+ */
+void GLWidget3D::setRenderMode(int renderMode) {
+	makeCurrent();
+	vr->setRenderMode(renderMode);
+	updateGL();
+}
+
+/**
+ * Set the iso value of the isosurface. The meshes of the recent iso values are cached,
+ * so going back to a previous value does not extract the mesh again.
+ */
+void GLWidget3D::setIsoValue(float isoValue) {
+	makeCurrent();
+	vr->setIsoValue(isoValue);
+	updateGL();
+}
+
+/**
+ * Enable or disable the progressive rendering. While the camera is static, jittered frames with
+ * a larger step size are averaged until the image converges.
+ */
+void GLWidget3D::setProgressive(bool progressive) {
+	makeCurrent();
+	vr->setProgressive(progressive);
+	updateGL();
+}
+
+/**
+ * Enable or disable the temporal reprojection. While the camera moves, the previous frame is reprojected
+ * into the new view and only the disoccluded or invalid pixels are traced.
+ */
+void GLWidget3D::setReprojection(bool reprojection) {
+	makeCurrent();
+	vr->setReprojection(reprojection);
+	updateGL();
+}
+
+/**
+ * Set the opacity at which the rays of the volume rendering terminate.
+ */
+void GLWidget3D::setTerminationThreshold(float terminationThreshold) {
+	makeCurrent();
+	vr->setTerminationThreshold(terminationThreshold);
+	updateGL();
+}
+
+float GLWidget3D::getTerminationThreshold() const {
+	return vr->getTerminationThreshold();
+}
+
+/**
+ * Enable or disable the coarse occlusion pass. The rays of each tile only march the range where
+ * the low resolution rays around it found non-empty and not yet occluded samples.
+ */
+void GLWidget3D::setOcclusionCulling(bool occlusionCulling) {
+	makeCurrent();
+	vr->setOcclusionCulling(occlusionCulling);
+	updateGL();
+}
 
-	vr->setVolumeData(width, height, depth, data);
+/**
+ * Enable or disable the per-ray statistics. While enabled, the cost of each ray is shown as a heat map
+ * and the totals of each frame are printed.
+ */
+void GLWidget3D::setRayStatistics(bool statistics) {
+	makeCurrent();
+	vr->setStatistics(statistics);
+	updateGL();
+}
+
+float GLWidget3D::getIsoValue() const {
+	return vr->getIsoValue();
+}
+
+/**
+ * Move the light. The position is in the texture coordinates, where the volume spans [0, 1].
+ */
+void GLWidget3D::setLightPosition(const QVector3D& lightPos) {
+	makeCurrent();
+	vr->setLightPosition(lightPos);
+	updateGL();
+}
+
+/**
+ * Load a time series of VTK files. The first frame is loaded immediately and
+ * the following frames are prefetched on worker threads.
+ */
+void GLWidget3D::loadVTKSequence(const std::vector<std::string>& filenames) {
+	stopSequence();
+
+	sequence = new VolumeSequence(filenames, 4, deltaPlayback);
 
+	float* data;
+	VolumeHistogram histogram;
+	if (!sequence->open(&data, &histogram)) {
+		std::cout << "Unable to load " << filenames[0] << std::endl;
+		stopSequence();
+		return;
+	}
+
+	// the window is set from the first frame and kept for the whole series, so that the frames stay comparable
+	float windowMin, windowMax;
+	histogram.getAutoWindow(windowMin, windowMax);
+	printf("Density of the first frame: min %.4f, max %.4f, window [%.4f, %.4f]\n", histogram.getMin(), histogram.getMax(), windowMin, windowMax);
+
+	makeCurrent();
+	vr->setWindow(windowMin, windowMax);
+	vr->setSequenceFormat(sequence->getWidth(), sequence->getHeight(), sequence->getDepth());
+	if (deltaPlayback) {
+		// the first frame is uploaded as a key frame that contains all the bricks
+		FrameDelta key(sequence->getWidth(), sequence->getHeight(), sequence->getDepth());
+		key.compute(NULL, data);
+		vr->updateVolumeData(key);
+	} else {
+		vr->updateVolumeData(data);
+	}
 	delete [] data;
 
 	updateGL();
-}
\ No newline at end of file
+}
+
+/**
+ * Start or pause the playback of the loaded time series.
+ * When paused, the playback statistics are printed.
+ */
+void GLWidget3D::setPlaying(bool playing) {
+	if (sequence == NULL) return;
+
+	if (playing) {
+		playbackStart = displayedFrame;
+		shownFrames = 0;
+		droppedFrames = 0;
+		stalledTicks = 0;
+		uploadedBytes = 0;
+		playbackClock.start();
+
+		// tick twice per frame so that frames are not shown a whole period late
+		timer.start(std::max(1, 500 / playbackFPS), this);
+	} else if (timer.isActive()) {
+		timer.stop();
+
+		float seconds = playbackClock.elapsed() / 1000.0f;
+		printf("Playback: %d frames shown, %d dropped, %d stalls, %.1f fps (target %d fps)\n", shownFrames, droppedFrames, stalledTicks, seconds > 0.0f ? shownFrames / seconds : 0.0f, playbackFPS);
+		if (shownFrames > 0) {
+			double fullBytes = (double)shownFrames * sequence->getWidth() * sequence->getHeight() * sequence->getDepth() * sizeof(float);
+			printf("Uploaded: %.1f MB (%.1f%% of full frames)\n", uploadedBytes / 1048576.0, uploadedBytes * 100.0 / fullBytes);
+		}
+	}
+}
+
+/**
+ * Set the target frame rate of the playback.
+ */
+void GLWidget3D::setPlaybackFPS(int fps) {
+	if (fps < 1) fps = 1;
+
+	bool playing = timer.isActive();
+	setPlaying(false);
+	playbackFPS = fps;
+	setPlaying(playing);
+}
+
+/**
+ * Stop the playback and release the time series.
+ */
+void GLWidget3D::stopSequence() {
+	setPlaying(false);
+
+	delete sequence;
+	sequence = NULL;
+	displayedFrame = 0;
+}
+
+/**
+ * Set whether sequences loaded afterwards are stored as brick deltas between frames,
+ * so that only the changed bricks are uploaded during the playback.
+ */
+void GLWidget3D::setDeltaPlayback(bool delta) {
+	deltaPlayback = delta;
+}
+
+/**
+ * Set up the grid onto which SPH particles are splatted by updateParticles().
+ * See ParticleSplatter for the meaning of the parameters.
+ */
+void GLWidget3D::setParticleGrid(int width, int height, int depth, float minX, float minY, float minZ, float voxelSize, float smoothingLength, float densityScale) {
+	stopSequence();
+
+	delete splatter;
+	splatter = new ParticleSplatter(width, height, depth, minX, minY, minZ, voxelSize, smoothingLength);
+	splatter->setDensityScale(densityScale);
+
+	particleGridSize[0] = width;
+	particleGridSize[1] = height;
+	particleGridSize[2] = depth;
+	particleVolume.resize(width * height * depth);
+
+	// the splatted densities are not normalized, so they are shown without the window
+	makeCurrent();
+	vr->setWindow(0.0f, 1.0f);
+}
+
+/**
+ * Reconstruct the density from the particles of the current simulation step and show it.
+ * Since the grid size does not change between steps, the volume texture is updated in place.
+ * This has to be called from the GUI thread.
+ */
+void GLWidget3D::updateParticles(const std::vector<ParticleSplatter::Particle>& particles) {
+	if (splatter == NULL) return;
+
+	splatter->splat(particles, &particleVolume[0]);
+
+	makeCurrent();
+	vr->setVolumeData(particleGridSize[0], particleGridSize[1], particleGridSize[2], &particleVolume[0]);
+
+	updateGL();
+}
+/**
+ * Enable or disable the profiler. While it is enabled, a per-stage summary is printed every second.
+ */
+void GLWidget3D::setProfiling(bool profiling) {
+	makeCurrent();
+	Profiler::setEnabled(profiling);
+}
+
+/**
+ * Write the events recorded by the profiler as a Chrome trace.
+ */
+bool GLWidget3D::saveProfileTrace(const char* filename) {
+	return Profiler::writeChromeTrace(filename);
+}
+
+/**
+ * Save the next frame as an image. The frame is read back asynchronously and saved by the encoder thread.
+ */
+void GLWidget3D::saveScreenshot(const char* filename) {
+	recorder->requestScreenshot(filename);
+	updateGL();
+}
+
+/**
+ * Start recording every drawn frame, either as a PNG sequence named path_00000.png, ... or as a raw BGRA video.
+ */
+bool GLWidget3D::startRecording(const char* path, int format) {
+	makeCurrent();
+	return recorder->startRecording(path, format);
+}
+
+/**
+ * Stop recording and write out the frames that are still being read back or encoded.
+ */
+void GLWidget3D::stopRecording() {
+	makeCurrent();
+	recorder->stopRecording();
+}
+
+/**
+ * Append the current view to the camera path, KEYFRAME_INTERVAL seconds after the last keyframe.
+ */
+int GLWidget3D::addCameraKeyframe() {
+	float time = cameraPath.numKeyframes() == 0 ? 0.0f : cameraPath.getDuration() + KEYFRAME_INTERVAL;
+	cameraPath.addKeyframe(time, camera);
+	printf("Keyframe %d at %.1f s\n", cameraPath.numKeyframes(), time);
+	return cameraPath.numKeyframes();
+}
+
+/**
+ * Remove all the keyframes of the camera path.
+ */
+void GLWidget3D::clearCameraPath() {
+	cameraPath.clear();
+}
+
+/**
+ * Load the keyframes of the camera path from a text file, and move the camera to the first one.
+ */
+bool GLWidget3D::loadCameraPath(const char* filename) {
+	if (!cameraPath.load(filename)) return false;
+
+	cameraPath.evaluate(0.0f, camera);
+	updateGL();
+	return true;
+}
+
+/**
+ * Save the keyframes of the camera path to a text file.
+ */
+bool GLWidget3D::saveCameraPath(const char* filename) {
+	return cameraPath.save(filename);
+}
+
+/**
+ * Render the camera path on the CPU at fps frames per second, as prefix_00000.png, ...
+ * The frames are distributed over the worker threads. Without a path of at least two keyframes,
+ * an orbit around the current view is rendered instead.
+ */
+int GLWidget3D::renderCameraPath(const char* prefix, float fps) {
+	const std::vector<float>& data = vr->getVolumeData();
+	if (data.empty()) return 0;
+
+	CpuRaycaster raycaster(vr->getGridWidth(), vr->getGridHeight(), vr->getGridDepth(), &data[0]);
+	raycaster.setWindow(vr->getWindowMin(), vr->getWindowMax());
+	raycaster.setRenderMode(vr->getRenderMode());
+	raycaster.setIsoValue(vr->getIsoValue());
+	raycaster.setLightPosition(vr->getLightPosition());
+	raycaster.setTerminationThreshold(vr->getTerminationThreshold());
+
+	if (cameraPath.numKeyframes() < 2) {
+		return SequenceRenderer::render(raycaster, CameraPath::orbit(camera, ORBIT_DURATION), fps, width(), height(), prefix);
+	} else {
+		return SequenceRenderer::render(raycaster, cameraPath, fps, width(), height(), prefix);
+	}
+}
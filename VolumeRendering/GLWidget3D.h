@@ -4,11 +4,17 @@
 #include <QGLWidget>
 #include <QMouseEvent>
 #include <QKeyEvent>
+#include <QTimerEvent>
 #include "Camera.h"
 #include <QVector2D>
 #include <vector>
 #include <QBasicTimer>
+#include <QElapsedTimer>
 #include "VolumeRendering.h"
+#include "VolumeSequence.h"
+#include "ParticleSplatter.h"
+#include "FrameRecorder.h"
+#include "CameraPath.h"
 
 using namespace std;
 
@@ -20,18 +26,77 @@ private:
 	QPoint lastPos;
 	VolumeRendering* vr;
 	QBasicTimer timer;
+	bool compressVolume;
+	bool sparseVolume;
+
+	VolumeSequence* sequence;
+	int playbackFPS;
+	QElapsedTimer playbackClock;
+	int playbackStart;
+	int displayedFrame;
+	int shownFrames;
+	int droppedFrames;
+	int stalledTicks;
+	long long uploadedBytes;
+	bool deltaPlayback;
+
+	ParticleSplatter* splatter;
+	std::vector<float> particleVolume;
+	int particleGridSize[3];
+
+	FrameRecorder* recorder;
+	QBasicTimer captureTimer;
+
+	CameraPath cameraPath;
 
 public:
 	GLWidget3D();
+	~GLWidget3D();
 	QVector2D mouseTo2D(int x,int y);
 	void loadVTK(char* filename);
+	void setCompressVolume(bool compress);
+	void setSparseVolume(bool sparse);
+	void setShading(bool shading);
+	void setPrecomputedLight(bool precomputedLight);
+	void setAmbientOcclusion(bool ambientOcclusion);
+	void setLightPosition(const QVector3D& lightPos);
+	void setRenderMode(int renderMode);
+	void setIsoValue(float isoValue);
+	float getIsoValue() const;
+	void setRayStatistics(bool statistics);
+	void setProgressive(bool progressive);
+	void setReprojection(bool reprojection);
+	void setTerminationThreshold(float terminationThreshold);
+	float getTerminationThreshold() const;
+	void setOcclusionCulling(bool occlusionCulling);
+	void loadVTKSequence(const std::vector<std::string>& filenames);
+	void setPlaying(bool playing);
+	void setPlaybackFPS(int fps);
+	void setDeltaPlayback(bool delta);
+	void setParticleGrid(int width, int height, int depth, float minX, float minY, float minZ, float voxelSize, float smoothingLength, float densityScale);
+	void updateParticles(const std::vector<ParticleSplatter::Particle>& particles);
+	void setProfiling(bool profiling);
+	bool saveProfileTrace(const char* filename);
+	void saveScreenshot(const char* filename);
+	bool startRecording(const char* path, int format);
+	void stopRecording();
+	int addCameraKeyframe();
+	void clearCameraPath();
+	bool loadCameraPath(const char* filename);
+	bool saveCameraPath(const char* filename);
+	int renderCameraPath(const char* prefix, float fps);
 
 protected:
 	void initializeGL();
 	void resizeGL(int width, int height);
 	void paintGL();    
+	void glDraw();
 	void mousePressEvent(QMouseEvent *e);
 	void mouseMoveEvent(QMouseEvent *e);
 	void mouseReleaseEvent(QMouseEvent *e);
+	void timerEvent(QTimerEvent *e);
+
+private:
+	void stopSequence();
 };
 
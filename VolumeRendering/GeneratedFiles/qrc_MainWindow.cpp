@@ -9,13 +9,1670 @@
 
 #include <QtCore/qglobal.h>
 
+static const unsigned char qt_resource_data[] = {
+  // C:/Users/VolumeRendering/VolumeRendering/shader/accumulatefs.glsl
+  0x0,0x0,0x1,0x34,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,
+  0xa,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x67,0x6c,0x46,0x72,0x61,
+  0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,
+  0x66,0x72,0x61,0x6d,0x65,0x20,0x74,0x68,0x61,0x74,0x20,0x77,0x61,0x73,0x20,0x6a,
+  0x75,0x73,0x74,0x20,0x72,0x61,0x79,0x20,0x63,0x61,0x73,0x74,0x2e,0x20,0x69,0x74,
+  0x20,0x69,0x73,0x20,0x62,0x6c,0x65,0x6e,0x64,0x65,0x64,0x20,0x69,0x6e,0x74,0x6f,
+  0x20,0x74,0x68,0x65,0x20,0x61,0x63,0x63,0x75,0x6d,0x75,0x6c,0x61,0x74,0x69,0x6f,
+  0x6e,0x20,0x62,0x75,0x66,0x66,0x65,0x72,0xa,0x2f,0x2f,0x20,0x77,0x69,0x74,0x68,
+  0x20,0x74,0x68,0x65,0x20,0x77,0x65,0x69,0x67,0x68,0x74,0x20,0x31,0x20,0x2f,0x20,
+  0x28,0x6e,0x75,0x6d,0x62,0x65,0x72,0x20,0x6f,0x66,0x20,0x61,0x63,0x63,0x75,0x6d,
+  0x75,0x6c,0x61,0x74,0x65,0x64,0x20,0x66,0x72,0x61,0x6d,0x65,0x73,0x29,0x2c,0x20,
+  0x77,0x68,0x69,0x63,0x68,0x20,0x6b,0x65,0x65,0x70,0x73,0x20,0x74,0x68,0x65,0x20,
+  0x72,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x20,0x61,0x76,0x65,0x72,0x61,0x67,0x65,0x2e,
+  0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+  0x32,0x44,0x20,0x66,0x72,0x61,0x6d,0x65,0x3b,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,
+  0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,
+  0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,
+  0x63,0x68,0x28,0x66,0x72,0x61,0x6d,0x65,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,
+  0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x29,
+  0x2c,0x20,0x30,0x29,0x3b,0xa,0x7d,0xa,
+  // C:/Users/VolumeRendering/VolumeRendering/shader/heatmapfs.glsl
+  0x0,0x0,0x2,0xfa,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,
+  0xa,0xa,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x54,0x65,0x78,0x43,0x6f,
+  0x6f,0x72,0x64,0x3b,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x67,0x6c,
+  0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x70,
+  0x65,0x72,0x2d,0x70,0x69,0x78,0x65,0x6c,0x20,0x72,0x61,0x79,0x20,0x73,0x74,0x61,
+  0x74,0x69,0x73,0x74,0x69,0x63,0x73,0x20,0x77,0x72,0x69,0x74,0x74,0x65,0x6e,0x20,
+  0x62,0x79,0x20,0x72,0x61,0x79,0x63,0x61,0x73,0x74,0x66,0x73,0x2e,0x67,0x6c,0x73,
+  0x6c,0x3a,0xa,0x2f,0x2f,0x20,0x6d,0x61,0x69,0x6e,0x20,0x6c,0x6f,0x6f,0x70,0x20,
+  0x69,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x2c,0x20,0x64,0x65,0x6e,0x73,
+  0x69,0x74,0x79,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x2c,0x20,0x6c,0x69,0x67,
+  0x68,0x74,0x20,0x6d,0x61,0x72,0x63,0x68,0x20,0x73,0x74,0x65,0x70,0x73,0x20,0x61,
+  0x6e,0x64,0x20,0x65,0x61,0x72,0x6c,0x79,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,
+  0x74,0x69,0x6f,0x6e,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
+  0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x73,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,
+  0x73,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,
+  0x20,0x6d,0x61,0x78,0x43,0x6f,0x73,0x74,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x62,0x6c,
+  0x75,0x65,0x20,0x2d,0x3e,0x20,0x63,0x79,0x61,0x6e,0x20,0x2d,0x3e,0x20,0x67,0x72,
+  0x65,0x65,0x6e,0x20,0x2d,0x3e,0x20,0x79,0x65,0x6c,0x6c,0x6f,0x77,0x20,0x2d,0x3e,
+  0x20,0x72,0x65,0x64,0xa,0x76,0x65,0x63,0x33,0x20,0x68,0x65,0x61,0x74,0x28,0x66,
+  0x6c,0x6f,0x61,0x74,0x20,0x74,0x29,0x20,0x7b,0xa,0x9,0x74,0x20,0x3d,0x20,0x63,
+  0x6c,0x61,0x6d,0x70,0x28,0x74,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+  0x29,0x20,0x2a,0x20,0x34,0x2e,0x30,0x3b,0xa,0x9,0x72,0x65,0x74,0x75,0x72,0x6e,
+  0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x76,0x65,0x63,0x33,0x28,0x74,0x20,0x2d,0x20,
+  0x32,0x2e,0x30,0x2c,0x20,0x74,0x20,0x3c,0x20,0x32,0x2e,0x30,0x20,0x3f,0x20,0x74,
+  0x20,0x3a,0x20,0x34,0x2e,0x30,0x20,0x2d,0x20,0x74,0x2c,0x20,0x32,0x2e,0x30,0x20,
+  0x2d,0x20,0x74,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+  0xa,0x7d,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,
+  0x7b,0xa,0x9,0x76,0x65,0x63,0x34,0x20,0x73,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,
+  0x75,0x72,0x65,0x28,0x73,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x73,0x2c,0x20,
+  0x76,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x29,0x3b,0xa,0xa,0x9,0x2f,0x2f,
+  0x20,0x74,0x68,0x65,0x20,0x70,0x69,0x78,0x65,0x6c,0x73,0x20,0x77,0x68,0x6f,0x73,
+  0x65,0x20,0x72,0x61,0x79,0x73,0x20,0x6d,0x69,0x73,0x73,0x65,0x64,0x20,0x74,0x68,
+  0x65,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x73,0x74,0x61,0x79,0x20,0x62,0x6c,
+  0x61,0x63,0x6b,0xa,0x9,0x69,0x66,0x20,0x28,0x73,0x2e,0x78,0x20,0x3d,0x3d,0x20,
+  0x30,0x2e,0x30,0x29,0x20,0x7b,0xa,0x9,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x43,
+  0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2c,0x20,0x30,
+  0x2c,0x20,0x30,0x2c,0x20,0x31,0x29,0x3b,0xa,0x9,0x9,0x72,0x65,0x74,0x75,0x72,
+  0x6e,0x3b,0xa,0x9,0x7d,0xa,0xa,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x63,
+  0x6f,0x73,0x74,0x20,0x6f,0x66,0x20,0x61,0x20,0x72,0x61,0x79,0x20,0x69,0x73,0x20,
+  0x74,0x68,0x65,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x20,0x6f,0x66,0x20,0x64,0x65,
+  0x6e,0x73,0x69,0x74,0x79,0x20,0x66,0x65,0x74,0x63,0x68,0x65,0x73,0x2c,0x20,0x69,
+  0x6e,0x63,0x6c,0x75,0x64,0x69,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x67,
+  0x68,0x74,0x20,0x6d,0x61,0x72,0x63,0x68,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,
+  0x63,0x6f,0x73,0x74,0x20,0x3d,0x20,0x73,0x2e,0x79,0x20,0x2b,0x20,0x73,0x2e,0x7a,
+  0x3b,0xa,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
+  0x20,0x76,0x65,0x63,0x34,0x28,0x68,0x65,0x61,0x74,0x28,0x63,0x6f,0x73,0x74,0x20,
+  0x2f,0x20,0x6d,0x61,0x78,0x28,0x6d,0x61,0x78,0x43,0x6f,0x73,0x74,0x2c,0x20,0x31,
+  0x2e,0x30,0x29,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x7d,0xa,
+  // C:/Users/VolumeRendering/VolumeRendering/shader/raycastvs.glsl
+  0x0,0x0,0x0,0xe6,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,
+  0xa,0xa,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x67,0x6c,0x56,0x65,0x72,0x74,
+  0x65,0x78,0x3b,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x50,0x6f,
+  0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x20,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
+  0x6d,0x20,0x6d,0x61,0x74,0x34,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x76,0x69,0x65,0x77,
+  0x4d,0x61,0x74,0x72,0x69,0x78,0x3b,0x20,0x20,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
+  0x6d,0x20,0x6d,0x61,0x74,0x34,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,
+  0x6e,0x4d,0x61,0x74,0x72,0x69,0x78,0x3b,0xa,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,
+  0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+  0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x70,0x72,0x6f,0x6a,0x65,
+  0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x6d,0x6f,
+  0x64,0x65,0x6c,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,
+  0x67,0x6c,0x56,0x65,0x72,0x74,0x65,0x78,0x3b,0xa,0x20,0x20,0x20,0x20,0x76,0x50,
+  0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x56,0x65,0x72,0x74,
+  0x65,0x78,0x2e,0x78,0x79,0x7a,0x3b,0xa,0x7d,0xa,
+  // C:/Users/VolumeRendering/VolumeRendering/shader/raycastfs.glsl
+  0x0,0x0,0x51,0xcd,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,
+  0xa,0xa,0x2f,0x2f,0x20,0x54,0x68,0x65,0x20,0x76,0x61,0x72,0x69,0x61,0x6e,0x74,
+  0x20,0x69,0x73,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x20,0x62,0x79,0x20,
+  0x74,0x68,0x65,0x20,0x6d,0x61,0x63,0x72,0x6f,0x73,0x20,0x62,0x65,0x6c,0x6f,0x77,
+  0x2c,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x52,0x65,
+  0x6e,0x64,0x65,0x72,0x69,0x6e,0x67,0x20,0x69,0x6e,0x6a,0x65,0x63,0x74,0x73,0x20,
+  0x72,0x69,0x67,0x68,0x74,0x20,0x61,0x66,0x74,0x65,0x72,0xa,0x2f,0x2f,0x20,0x74,
+  0x68,0x65,0x20,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x6c,0x69,0x6e,0x65,
+  0x20,0x28,0x73,0x65,0x65,0x20,0x55,0x74,0x69,0x6c,0x3a,0x3a,0x4c,0x6f,0x61,0x64,
+  0x50,0x72,0x6f,0x67,0x72,0x61,0x6d,0x29,0x2e,0x20,0x54,0x68,0x65,0x20,0x64,0x65,
+  0x66,0x61,0x75,0x6c,0x74,0x73,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x74,
+  0x68,0x65,0x20,0x70,0x6c,0x61,0x69,0x6e,0x20,0x44,0x56,0x52,0x20,0x76,0x61,0x72,
+  0x69,0x61,0x6e,0x74,0x2e,0xa,0x2f,0x2f,0x20,0x20,0x20,0x52,0x45,0x4e,0x44,0x45,
+  0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x52,0x45,
+  0x4e,0x44,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x2c,0x20,0x52,0x45,0x4e,
+  0x44,0x45,0x52,0x5f,0x49,0x53,0x4f,0x52,0x41,0x59,0x43,0x41,0x53,0x54,0x2c,0x20,
+  0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x49,0x50,0x2c,0x20,0x52,0x45,0x4e,0x44,
+  0x45,0x52,0x5f,0x4d,0x49,0x4e,0x49,0x50,0x20,0x6f,0x72,0x20,0x52,0x45,0x4e,0x44,
+  0x45,0x52,0x5f,0x41,0x56,0x45,0x52,0x41,0x47,0x45,0xa,0x2f,0x2f,0x20,0x20,0x20,
+  0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0x5f,0x44,0x45,0x4e,0x53,0x45,
+  0x2c,0x20,0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0x5f,0x43,0x4f,0x4d,0x50,0x52,0x45,
+  0x53,0x53,0x45,0x44,0x20,0x6f,0x72,0x20,0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0x5f,
+  0x53,0x50,0x41,0x52,0x53,0x45,0xa,0x2f,0x2f,0x20,0x20,0x20,0x53,0x48,0x41,0x44,
+  0x49,0x4e,0x47,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x31,
+  0x20,0x74,0x6f,0x20,0x73,0x68,0x61,0x64,0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x74,
+  0x68,0x65,0x20,0x70,0x72,0x65,0x63,0x6f,0x6d,0x70,0x75,0x74,0x65,0x64,0x20,0x67,
+  0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0xa,0x2f,
+  0x2f,0x20,0x20,0x20,0x50,0x52,0x45,0x43,0x4f,0x4d,0x50,0x55,0x54,0x45,0x44,0x5f,
+  0x4c,0x49,0x47,0x48,0x54,0x20,0x20,0x31,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x20,
+  0x74,0x68,0x65,0x20,0x70,0x72,0x65,0x63,0x6f,0x6d,0x70,0x75,0x74,0x65,0x64,0x20,
+  0x74,0x72,0x61,0x6e,0x73,0x6d,0x69,0x74,0x74,0x61,0x6e,0x63,0x65,0x20,0x69,0x6e,
+  0x73,0x74,0x65,0x61,0x64,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x67,
+  0x68,0x74,0x20,0x6d,0x61,0x72,0x63,0x68,0xa,0x2f,0x2f,0x20,0x20,0x20,0x41,0x4d,
+  0x42,0x49,0x45,0x4e,0x54,0x5f,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,0x20,
+  0x20,0x31,0x20,0x74,0x6f,0x20,0x75,0x73,0x65,0x20,0x74,0x68,0x65,0x20,0x70,0x72,
+  0x65,0x63,0x6f,0x6d,0x70,0x75,0x74,0x65,0x64,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,
+  0x74,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x76,0x6f,0x6c,0x75,
+  0x6d,0x65,0xa,0x2f,0x2f,0x20,0x20,0x20,0x45,0x4d,0x50,0x54,0x59,0x5f,0x53,0x4b,
+  0x49,0x50,0x50,0x49,0x4e,0x47,0x20,0x20,0x20,0x20,0x20,0x31,0x20,0x74,0x6f,0x20,
+  0x73,0x6b,0x69,0x70,0x20,0x74,0x68,0x65,0x20,0x62,0x72,0x69,0x63,0x6b,0x73,0x20,
+  0x74,0x68,0x61,0x74,0x20,0x63,0x61,0x6e,0x6e,0x6f,0x74,0x20,0x63,0x68,0x61,0x6e,
+  0x67,0x65,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,
+  0x6e,0xa,0x2f,0x2f,0x20,0x20,0x20,0x4c,0x49,0x47,0x48,0x54,0x5f,0x53,0x41,0x4d,
+  0x50,0x4c,0x45,0x53,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x68,0x65,0x20,0x6d,0x61,
+  0x78,0x69,0x6d,0x75,0x6d,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x20,0x6f,0x66,0x20,
+  0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x6c,
+  0x69,0x67,0x68,0x74,0x20,0x6d,0x61,0x72,0x63,0x68,0xa,0x2f,0x2f,0x20,0x20,0x20,
+  0x53,0x54,0x41,0x54,0x49,0x53,0x54,0x49,0x43,0x53,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x31,0x20,0x74,0x6f,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x74,0x68,
+  0x65,0x20,0x70,0x65,0x72,0x2d,0x72,0x61,0x79,0x20,0x63,0x6f,0x73,0x74,0x20,0x74,
+  0x6f,0x20,0x74,0x68,0x65,0x20,0x73,0x65,0x63,0x6f,0x6e,0x64,0x20,0x72,0x65,0x6e,
+  0x64,0x65,0x72,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0xa,0x2f,0x2f,0x20,0x20,0x20,
+  0x53,0x54,0x45,0x50,0x5f,0x53,0x49,0x5a,0x45,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,
+  0x62,0x65,0x74,0x77,0x65,0x65,0x6e,0x20,0x74,0x68,0x65,0x20,0x73,0x61,0x6d,0x70,
+  0x6c,0x65,0x73,0x20,0x61,0x6c,0x6f,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x72,0x61,
+  0x79,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+  0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0x73,0xa,0x2f,0x2f,0x20,
+  0x20,0x20,0x4a,0x49,0x54,0x54,0x45,0x52,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x20,0x20,0x31,0x20,0x74,0x6f,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,
+  0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x6f,0x66,0x20,0x65,0x61,
+  0x63,0x68,0x20,0x72,0x61,0x79,0x20,0x62,0x79,0x20,0x61,0x20,0x62,0x6c,0x75,0x65,
+  0x20,0x6e,0x6f,0x69,0x73,0x65,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0x2f,0x2f,0x20,
+  0x20,0x20,0x52,0x45,0x50,0x52,0x4f,0x4a,0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x20,
+  0x20,0x20,0x20,0x20,0x20,0x31,0x20,0x74,0x6f,0x20,0x72,0x65,0x75,0x73,0x65,0x20,
+  0x74,0x68,0x65,0x20,0x72,0x65,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x65,0x64,0x20,
+  0x70,0x72,0x65,0x76,0x69,0x6f,0x75,0x73,0x20,0x66,0x72,0x61,0x6d,0x65,0x20,0x61,
+  0x6e,0x64,0x20,0x77,0x72,0x69,0x74,0x65,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x72,
+  0x73,0x74,0x20,0x73,0x69,0x67,0x6e,0x69,0x66,0x69,0x63,0x61,0x6e,0x74,0x20,0x73,
+  0x61,0x6d,0x70,0x6c,0x65,0xa,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x6f,
+  0x20,0x74,0x68,0x65,0x20,0x73,0x65,0x63,0x6f,0x6e,0x64,0x20,0x72,0x65,0x6e,0x64,
+  0x65,0x72,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x20,0x28,0x52,0x45,0x4e,0x44,0x45,
+  0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x20,0x61,0x6e,0x64,0x20,0x52,0x45,0x4e,
+  0x44,0x45,0x52,0x5f,0x49,0x53,0x4f,0x52,0x41,0x59,0x43,0x41,0x53,0x54,0x20,0x6f,
+  0x6e,0x6c,0x79,0x29,0xa,0x2f,0x2f,0x20,0x20,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,
+  0x49,0x4f,0x4e,0x5f,0x50,0x41,0x53,0x53,0x20,0x20,0x20,0x20,0x20,0x31,0x20,0x74,
+  0x6f,0x20,0x74,0x72,0x61,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x61,0x72,
+  0x73,0x65,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x70,0x61,0x73,
+  0x73,0x2c,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x77,0x72,0x69,0x74,0x65,0x73,0x20,
+  0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x61,0x6c,0x6f,
+  0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,0x20,0x62,0x65,0x66,0x6f,0x72,
+  0x65,0x20,0x77,0x68,0x69,0x63,0x68,0xa,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x74,0x68,0x65,0x20,0x6d,0x69,0x6e,0x2d,0x6d,0x61,0x78,0x20,0x62,0x72,0x69,0x63,
+  0x6b,0x73,0x20,0x61,0x72,0x6f,0x75,0x6e,0x64,0x20,0x61,0x6c,0x6c,0x20,0x74,0x68,
+  0x65,0x20,0x72,0x61,0x79,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x74,0x69,
+  0x6c,0x65,0x20,0x61,0x72,0x65,0x20,0x65,0x6d,0x70,0x74,0x79,0x2c,0x20,0x61,0x6e,
+  0x64,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x74,
+  0x6f,0x20,0x74,0x68,0x65,0xa,0x2f,0x2f,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x65,
+  0x72,0x6d,0x69,0x6e,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x69,0x6e,0x73,0x74,0x65,
+  0x61,0x64,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,
+  0x28,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x20,0x6f,
+  0x6e,0x6c,0x79,0x29,0xa,0x2f,0x2f,0x20,0x20,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,
+  0x49,0x4f,0x4e,0x5f,0x43,0x55,0x4c,0x4c,0x49,0x4e,0x47,0x20,0x20,0x31,0x20,0x74,
+  0x6f,0x20,0x73,0x6b,0x69,0x70,0x20,0x74,0x68,0x65,0x20,0x65,0x6d,0x70,0x74,0x79,
+  0x20,0x61,0x6e,0x64,0x20,0x6f,0x63,0x63,0x6c,0x75,0x64,0x65,0x64,0x20,0x70,0x61,
+  0x72,0x74,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,0x20,0x66,
+  0x6f,0x75,0x6e,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x61,0x72,
+  0x73,0x65,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x70,0x61,0x73,
+  0x73,0xa,0x2f,0x2f,0x20,0x20,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,
+  0x5f,0x54,0x49,0x4c,0x45,0x5f,0x53,0x49,0x5a,0x45,0x20,0x74,0x68,0x65,0x20,0x6e,
+  0x75,0x6d,0x62,0x65,0x72,0x20,0x6f,0x66,0x20,0x70,0x69,0x78,0x65,0x6c,0x73,0x20,
+  0x63,0x6f,0x76,0x65,0x72,0x65,0x64,0x20,0x62,0x79,0x20,0x6f,0x6e,0x65,0x20,0x74,
+  0x65,0x78,0x65,0x6c,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x61,0x72,
+  0x73,0x65,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x70,0x61,0x73,
+  0x73,0x20,0x69,0x6e,0x20,0x65,0x61,0x63,0x68,0x20,0x64,0x69,0x72,0x65,0x63,0x74,
+  0x69,0x6f,0x6e,0xa,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x76,0x61,0x6c,0x75,
+  0x65,0x73,0x20,0x6d,0x75,0x73,0x74,0x20,0x6d,0x61,0x74,0x63,0x68,0x20,0x74,0x68,
+  0x65,0x20,0x65,0x6e,0x75,0x6d,0x20,0x69,0x6e,0x20,0x56,0x6f,0x6c,0x75,0x6d,0x65,
+  0x52,0x65,0x6e,0x64,0x65,0x72,0x69,0x6e,0x67,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,
+  0x65,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x20,
+  0x30,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,
+  0x5f,0x49,0x53,0x4f,0x52,0x41,0x59,0x43,0x41,0x53,0x54,0x20,0x32,0xa,0x23,0x64,
+  0x65,0x66,0x69,0x6e,0x65,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x49,0x50,
+  0x20,0x33,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x52,0x45,0x4e,0x44,0x45,
+  0x52,0x5f,0x4d,0x49,0x4e,0x49,0x50,0x20,0x34,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,
+  0x65,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x41,0x56,0x45,0x52,0x41,0x47,0x45,
+  0x20,0x35,0xa,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x54,0x4f,0x52,
+  0x41,0x47,0x45,0x5f,0x44,0x45,0x4e,0x53,0x45,0x20,0x30,0xa,0x23,0x64,0x65,0x66,
+  0x69,0x6e,0x65,0x20,0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0x5f,0x43,0x4f,0x4d,0x50,
+  0x52,0x45,0x53,0x53,0x45,0x44,0x20,0x31,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+  0x20,0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0x5f,0x53,0x50,0x41,0x52,0x53,0x45,0x20,
+  0x32,0xa,0xa,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,
+  0x52,0x5f,0x4d,0x4f,0x44,0x45,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x52,
+  0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x52,0x45,0x4e,0x44,0x45,
+  0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,
+  0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0xa,
+  0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0x20,
+  0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0x5f,0x44,0x45,0x4e,0x53,0x45,0xa,0x23,0x65,
+  0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x53,0x48,0x41,
+  0x44,0x49,0x4e,0x47,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x48,0x41,
+  0x44,0x49,0x4e,0x47,0x20,0x30,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x23,0x69,
+  0x66,0x6e,0x64,0x65,0x66,0x20,0x50,0x52,0x45,0x43,0x4f,0x4d,0x50,0x55,0x54,0x45,
+  0x44,0x5f,0x4c,0x49,0x47,0x48,0x54,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,
+  0x50,0x52,0x45,0x43,0x4f,0x4d,0x50,0x55,0x54,0x45,0x44,0x5f,0x4c,0x49,0x47,0x48,
+  0x54,0x20,0x30,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x6e,0x64,
+  0x65,0x66,0x20,0x41,0x4d,0x42,0x49,0x45,0x4e,0x54,0x5f,0x4f,0x43,0x43,0x4c,0x55,
+  0x53,0x49,0x4f,0x4e,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x41,0x4d,0x42,
+  0x49,0x45,0x4e,0x54,0x5f,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,0x20,0x30,
+  0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,
+  0x45,0x4d,0x50,0x54,0x59,0x5f,0x53,0x4b,0x49,0x50,0x50,0x49,0x4e,0x47,0xa,0x23,
+  0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x45,0x4d,0x50,0x54,0x59,0x5f,0x53,0x4b,0x49,
+  0x50,0x50,0x49,0x4e,0x47,0x20,0x30,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x23,
+  0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x4c,0x49,0x47,0x48,0x54,0x5f,0x53,0x41,0x4d,
+  0x50,0x4c,0x45,0x53,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4c,0x49,0x47,
+  0x48,0x54,0x5f,0x53,0x41,0x4d,0x50,0x4c,0x45,0x53,0x20,0x31,0x32,0x38,0xa,0x23,
+  0x65,0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x53,0x54,
+  0x41,0x54,0x49,0x53,0x54,0x49,0x43,0x53,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,
+  0x20,0x53,0x54,0x41,0x54,0x49,0x53,0x54,0x49,0x43,0x53,0x20,0x30,0xa,0x23,0x65,
+  0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x53,0x54,0x45,
+  0x50,0x5f,0x53,0x49,0x5a,0x45,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,
+  0x54,0x45,0x50,0x5f,0x53,0x49,0x5a,0x45,0x20,0x30,0x2e,0x30,0x30,0x35,0xa,0x23,
+  0x65,0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x4a,0x49,
+  0x54,0x54,0x45,0x52,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4a,0x49,0x54,
+  0x54,0x45,0x52,0x20,0x30,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,
+  0x6e,0x64,0x65,0x66,0x20,0x52,0x45,0x50,0x52,0x4f,0x4a,0x45,0x43,0x54,0x49,0x4f,
+  0x4e,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x52,0x45,0x50,0x52,0x4f,0x4a,
+  0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x30,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,
+  0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,
+  0x4e,0x5f,0x50,0x41,0x53,0x53,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4f,
+  0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,0x5f,0x50,0x41,0x53,0x53,0x20,0x30,0xa,
+  0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x4f,
+  0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,0x5f,0x43,0x55,0x4c,0x4c,0x49,0x4e,0x47,
+  0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,
+  0x4f,0x4e,0x5f,0x43,0x55,0x4c,0x4c,0x49,0x4e,0x47,0x20,0x30,0xa,0x23,0x65,0x6e,
+  0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x6e,0x64,0x65,0x66,0x20,0x4f,0x43,0x43,0x4c,
+  0x55,0x53,0x49,0x4f,0x4e,0x5f,0x54,0x49,0x4c,0x45,0x5f,0x53,0x49,0x5a,0x45,0xa,
+  0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,
+  0x4e,0x5f,0x54,0x49,0x4c,0x45,0x5f,0x53,0x49,0x5a,0x45,0x20,0x38,0xa,0x23,0x65,
+  0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x50,0x52,0x4f,0x4a,0x45,
+  0x43,0x54,0x49,0x4f,0x4e,0x20,0x26,0x26,0x20,0x53,0x54,0x41,0x54,0x49,0x53,0x54,
+  0x49,0x43,0x53,0xa,0x23,0x65,0x72,0x72,0x6f,0x72,0x20,0x22,0x52,0x45,0x50,0x52,
+  0x4f,0x4a,0x45,0x43,0x54,0x49,0x4f,0x4e,0x20,0x61,0x6e,0x64,0x20,0x53,0x54,0x41,
+  0x54,0x49,0x53,0x54,0x49,0x43,0x53,0x20,0x62,0x6f,0x74,0x68,0x20,0x75,0x73,0x65,
+  0x20,0x74,0x68,0x65,0x20,0x73,0x65,0x63,0x6f,0x6e,0x64,0x20,0x72,0x65,0x6e,0x64,
+  0x65,0x72,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x22,0xa,0x23,0x65,0x6e,0x64,0x69,
+  0x66,0xa,0x23,0x69,0x66,0x20,0x28,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,
+  0x5f,0x50,0x41,0x53,0x53,0x20,0x7c,0x7c,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,
+  0x4f,0x4e,0x5f,0x43,0x55,0x4c,0x4c,0x49,0x4e,0x47,0x29,0x20,0x26,0x26,0x20,0x52,
+  0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x21,0x3d,0x20,0x52,0x45,
+  0x4e,0x44,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0xa,0x23,0x65,0x72,0x72,
+  0x6f,0x72,0x20,0x22,0x74,0x68,0x65,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,
+  0x6e,0x20,0x70,0x61,0x73,0x73,0x20,0x69,0x73,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x64,
+  0x65,0x66,0x69,0x6e,0x65,0x64,0x20,0x66,0x6f,0x72,0x20,0x52,0x45,0x4e,0x44,0x45,
+  0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0x22,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,
+  0xa,0xa,0x2f,0x2f,0x20,0x53,0x54,0x41,0x54,0x28,0x78,0x29,0x20,0x63,0x6f,0x6d,
+  0x70,0x69,0x6c,0x65,0x73,0x20,0x78,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x69,0x6e,0x20,
+  0x74,0x68,0x65,0x20,0x73,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x73,0x20,0x76,
+  0x61,0x72,0x69,0x61,0x6e,0x74,0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x61,0x74,0x20,
+  0x74,0x68,0x65,0x20,0x63,0x6f,0x75,0x6e,0x74,0x65,0x72,0x73,0x20,0x63,0x6f,0x73,
+  0x74,0x20,0x6e,0x6f,0x74,0x68,0x69,0x6e,0x67,0x20,0x6f,0x74,0x68,0x65,0x72,0x77,
+  0x69,0x73,0x65,0xa,0x23,0x69,0x66,0x20,0x53,0x54,0x41,0x54,0x49,0x53,0x54,0x49,
+  0x43,0x53,0xa,0x23,0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x53,0x54,0x41,0x54,0x28,
+  0x78,0x29,0x20,0x78,0xa,0x23,0x65,0x6c,0x73,0x65,0xa,0x23,0x64,0x65,0x66,0x69,
+  0x6e,0x65,0x20,0x53,0x54,0x41,0x54,0x28,0x78,0x29,0xa,0x23,0x65,0x6e,0x64,0x69,
+  0x66,0xa,0xa,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x50,0x6f,0x73,0x69,
+  0x74,0x69,0x6f,0x6e,0x3b,0xa,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+  0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
+  0x65,0x63,0x34,0x20,0x67,0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+  0xa,0x23,0x69,0x66,0x20,0x53,0x54,0x41,0x54,0x49,0x53,0x54,0x49,0x43,0x53,0xa,
+  0x2f,0x2f,0x20,0x6d,0x61,0x69,0x6e,0x20,0x6c,0x6f,0x6f,0x70,0x20,0x69,0x74,0x65,
+  0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x2c,0x20,0x64,0x65,0x6e,0x73,0x69,0x74,0x79,
+  0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x2c,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,
+  0x6d,0x61,0x72,0x63,0x68,0x20,0x73,0x74,0x65,0x70,0x73,0x20,0x61,0x6e,0x64,0x20,
+  0x77,0x68,0x65,0x74,0x68,0x65,0x72,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,0x20,
+  0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x65,0x64,0x20,0x65,0x61,0x72,0x6c,0x79,
+  0xa,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+  0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x67,
+  0x6c,0x46,0x72,0x61,0x67,0x53,0x74,0x61,0x74,0x73,0x3b,0xa,0x69,0x6e,0x74,0x20,
+  0x73,0x74,0x61,0x74,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x3d,
+  0x20,0x30,0x3b,0xa,0x69,0x6e,0x74,0x20,0x73,0x74,0x61,0x74,0x53,0x61,0x6d,0x70,
+  0x6c,0x65,0x73,0x20,0x3d,0x20,0x30,0x3b,0xa,0x69,0x6e,0x74,0x20,0x73,0x74,0x61,
+  0x74,0x4c,0x69,0x67,0x68,0x74,0x53,0x74,0x65,0x70,0x73,0x20,0x3d,0x20,0x30,0x3b,
+  0xa,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x74,0x61,0x74,0x54,0x65,0x72,0x6d,0x69,0x6e,
+  0x61,0x74,0x65,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0xa,0x23,0x65,
+  0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x50,0x52,0x4f,0x4a,0x45,
+  0x43,0x54,0x49,0x4f,0x4e,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x70,0x6f,0x73,
+  0x69,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x72,
+  0x73,0x74,0x20,0x73,0x69,0x67,0x6e,0x69,0x66,0x69,0x63,0x61,0x6e,0x74,0x20,0x73,
+  0x61,0x6d,0x70,0x6c,0x65,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x74,0x65,0x78,
+  0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0x73,
+  0x2c,0x20,0x61,0x6e,0x64,0x20,0x69,0x6e,0x20,0x77,0x2c,0x20,0x74,0x68,0x65,0x20,
+  0x6e,0x75,0x6d,0x62,0x65,0x72,0x20,0x6f,0x66,0xa,0x2f,0x2f,0x20,0x66,0x72,0x61,
+  0x6d,0x65,0x73,0x20,0x74,0x68,0x65,0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x68,0x61,
+  0x73,0x20,0x62,0x65,0x65,0x6e,0x20,0x72,0x65,0x75,0x73,0x65,0x64,0x20,0x70,0x6c,
+  0x75,0x73,0x20,0x6f,0x6e,0x65,0x20,0x28,0x30,0x20,0x69,0x66,0x20,0x74,0x68,0x65,
+  0x20,0x72,0x61,0x79,0x20,0x64,0x69,0x64,0x20,0x6e,0x6f,0x74,0x20,0x68,0x69,0x74,
+  0x20,0x61,0x6e,0x79,0x74,0x68,0x69,0x6e,0x67,0x20,0x73,0x69,0x67,0x6e,0x69,0x66,
+  0x69,0x63,0x61,0x6e,0x74,0x29,0xa,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+  0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,
+  0x76,0x65,0x63,0x34,0x20,0x67,0x6c,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,
+  0x69,0x6f,0x6e,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x75,0x6e,0x69,
+  0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x33,0x44,0x20,0x64,
+  0x65,0x6e,0x73,0x69,0x74,0x79,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,
+  0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x41,0x72,0x72,0x61,0x79,0x20,0x63,
+  0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x44,0x65,0x6e,0x73,0x69,0x74,0x79,
+  0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+  0x64,0x65,0x6e,0x73,0x69,0x74,0x79,0x52,0x61,0x6e,0x67,0x65,0x3b,0xa,0x75,0x6e,
+  0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x69,0x6e,0x64,
+  0x6f,0x77,0x4d,0x69,0x6e,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0xa,0x75,0x6e,0x69,
+  0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x77,0x69,0x6e,0x64,0x6f,
+  0x77,0x4d,0x61,0x78,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0xa,0x75,0x6e,0x69,0x66,
+  0x6f,0x72,0x6d,0x20,0x75,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x33,0x44,0x20,0x62,
+  0x72,0x69,0x63,0x6b,0x54,0x61,0x62,0x6c,0x65,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,
+  0x72,0x6d,0x20,0x76,0x65,0x63,0x33,0x20,0x61,0x74,0x6c,0x61,0x73,0x53,0x69,0x7a,
+  0x65,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,
+  0x65,0x72,0x33,0x44,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x73,0x3b,0xa,
+  0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x33,
+  0x44,0x20,0x6c,0x69,0x67,0x68,0x74,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x3b,0xa,0x75,
+  0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x33,0x44,
+  0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x56,0x6f,0x6c,0x75,0x6d,0x65,
+  0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+  0x72,0x33,0x44,0x20,0x6d,0x69,0x6e,0x4d,0x61,0x78,0x42,0x72,0x69,0x63,0x6b,0x73,
+  0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+  0x69,0x73,0x6f,0x56,0x61,0x6c,0x75,0x65,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
+  0x6d,0x20,0x76,0x65,0x63,0x33,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x3b,
+  0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x33,0x20,0x63,0x61,
+  0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x3b,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,
+  0x6d,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x20,
+  0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x2c,
+  0x20,0x32,0x2e,0x30,0x29,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x70,
+  0x72,0x65,0x76,0x69,0x6f,0x75,0x73,0x20,0x66,0x72,0x61,0x6d,0x65,0x20,0x72,0x65,
+  0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x65,0x64,0x20,0x69,0x6e,0x74,0x6f,0x20,0x74,
+  0x68,0x65,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x76,0x69,0x65,0x77,0x20,
+  0x28,0x73,0x65,0x65,0x20,0x72,0x65,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x76,0x73,
+  0x2e,0x67,0x6c,0x73,0x6c,0x29,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,
+  0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x72,0x65,0x70,0x72,0x6f,0x6a,0x65,
+  0x63,0x74,0x65,0x64,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,
+  0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x72,0x65,0x70,
+  0x72,0x6f,0x6a,0x65,0x63,0x74,0x65,0x64,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+  0x3b,0xa,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,0x20,0x74,0x65,
+  0x72,0x6d,0x69,0x6e,0x61,0x74,0x65,0x73,0x20,0x6f,0x6e,0x63,0x65,0x20,0x74,0x68,
+  0x65,0x20,0x61,0x63,0x63,0x75,0x6d,0x75,0x6c,0x61,0x74,0x65,0x64,0x20,0x6f,0x70,
+  0x61,0x63,0x69,0x74,0x79,0x20,0x72,0x65,0x61,0x63,0x68,0x65,0x73,0x20,0x74,0x68,
+  0x69,0x73,0x20,0x76,0x61,0x6c,0x75,0x65,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+  0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x69,
+  0x6f,0x6e,0x54,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x20,0x3d,0x20,0x30,0x2e,
+  0x39,0x39,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x61,0x72,
+  0x73,0x65,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x20,0x70,0x61,0x73,
+  0x73,0x3a,0x20,0x78,0x20,0x69,0x73,0x20,0x31,0x20,0x69,0x66,0x20,0x74,0x68,0x65,
+  0x20,0x62,0x6f,0x78,0x20,0x77,0x61,0x73,0x20,0x68,0x69,0x74,0x2c,0x20,0x79,0x20,
+  0x69,0x73,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,
+  0x61,0x6c,0x6f,0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,0x20,0x62,0x65,
+  0x66,0x6f,0x72,0x65,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x61,0x6c,0x6c,0x20,0x74,
+  0x68,0x65,0xa,0x2f,0x2f,0x20,0x72,0x61,0x79,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,
+  0x65,0x20,0x74,0x69,0x6c,0x65,0x20,0x61,0x72,0x65,0x20,0x65,0x6d,0x70,0x74,0x79,
+  0x20,0x28,0x31,0x65,0x32,0x30,0x20,0x69,0x66,0x20,0x74,0x68,0x65,0x79,0x20,0x61,
+  0x72,0x65,0x20,0x65,0x6d,0x70,0x74,0x79,0x20,0x61,0x6c,0x6c,0x20,0x74,0x68,0x65,
+  0x20,0x77,0x61,0x79,0x29,0x2c,0x20,0x61,0x6e,0x64,0x20,0x7a,0x20,0x69,0x73,0x20,
+  0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x74,0x6f,0x20,
+  0x74,0x68,0x65,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x69,0x6f,0x6e,0xa,
+  0x2f,0x2f,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,
+  0x20,0x72,0x61,0x79,0x20,0x28,0x31,0x65,0x32,0x30,0x20,0x69,0x66,0x20,0x69,0x74,
+  0x20,0x64,0x69,0x64,0x20,0x6e,0x6f,0x74,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,
+  0x74,0x65,0x29,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,
+  0x6c,0x65,0x72,0x32,0x44,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x54,
+  0x69,0x6c,0x65,0x73,0x3b,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x6e,0x75,0x6d,
+  0x62,0x65,0x72,0x20,0x6f,0x66,0x20,0x74,0x69,0x6c,0x65,0x73,0x20,0x70,0x65,0x72,
+  0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x69,0x6e,0x20,0x65,0x61,0x63,0x68,0x20,0x64,
+  0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+  0x20,0x76,0x65,0x63,0x32,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x53,
+  0x63,0x61,0x6c,0x65,0x3b,0xa,0xa,0x2f,0x2f,0x20,0x74,0x69,0x6c,0x65,0x61,0x62,
+  0x6c,0x65,0x20,0x62,0x6c,0x75,0x65,0x20,0x6e,0x6f,0x69,0x73,0x65,0x20,0x69,0x6e,
+  0x20,0x5b,0x30,0x2c,0x20,0x31,0x29,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,
+  0x69,0x6e,0x64,0x65,0x78,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x61,0x63,0x63,
+  0x75,0x6d,0x75,0x6c,0x61,0x74,0x65,0x64,0x20,0x66,0x72,0x61,0x6d,0x65,0xa,0x75,
+  0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,
+  0x20,0x62,0x6c,0x75,0x65,0x4e,0x6f,0x69,0x73,0x65,0x3b,0xa,0x75,0x6e,0x69,0x66,
+  0x6f,0x72,0x6d,0x20,0x69,0x6e,0x74,0x20,0x66,0x72,0x61,0x6d,0x65,0x49,0x6e,0x64,
+  0x65,0x78,0x3b,0xa,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x20,0x6c,
+  0x69,0x67,0x68,0x74,0x73,0x61,0x6d,0x70,0x6c,0x65,0x4e,0x75,0x6d,0x20,0x3d,0x20,
+  0x4c,0x49,0x47,0x48,0x54,0x5f,0x53,0x41,0x4d,0x50,0x4c,0x45,0x53,0x3b,0xa,0x63,
+  0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x74,0x65,0x70,0x53,
+  0x69,0x7a,0x65,0x20,0x3d,0x20,0x53,0x54,0x45,0x50,0x5f,0x53,0x49,0x5a,0x45,0x3b,
+  0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,0x67,
+  0x68,0x74,0x53,0x74,0x65,0x70,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,
+  0x31,0x3b,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,
+  0x6d,0x61,0x72,0x63,0x68,0x20,0x75,0x73,0x65,0x64,0x20,0x74,0x6f,0x20,0x61,0x74,
+  0x74,0x65,0x6e,0x75,0x61,0x74,0x65,0x20,0x62,0x79,0x20,0x61,0x62,0x73,0x6f,0x72,
+  0x62,0x52,0x61,0x74,0x65,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x35,0x20,0x70,0x65,
+  0x72,0x20,0x73,0x74,0x65,0x70,0x2c,0x20,0x77,0x68,0x69,0x63,0x68,0x20,0x69,0x73,
+  0x20,0x6b,0x65,0x70,0x74,0xa,0x2f,0x2f,0x20,0x69,0x6e,0x64,0x65,0x70,0x65,0x6e,
+  0x64,0x65,0x6e,0x74,0x20,0x6f,0x66,0x20,0x53,0x54,0x45,0x50,0x5f,0x53,0x49,0x5a,
+  0x45,0x20,0x28,0x73,0x61,0x6d,0x65,0x20,0x61,0x73,0x20,0x4c,0x49,0x47,0x48,0x54,
+  0x5f,0x41,0x42,0x53,0x4f,0x52,0x50,0x54,0x49,0x4f,0x4e,0x20,0x69,0x6e,0x20,0x56,
+  0x6f,0x6c,0x75,0x6d,0x65,0x52,0x65,0x6e,0x64,0x65,0x72,0x69,0x6e,0x67,0x29,0xa,
+  0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,0x67,0x68,
+  0x74,0x41,0x62,0x73,0x6f,0x72,0x70,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x35,0x2e,
+  0x30,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
+  0x65,0x6e,0x73,0x69,0x74,0x79,0x53,0x63,0x61,0x6c,0x65,0x20,0x3d,0x20,0x31,0x30,
+  0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x62,
+  0x73,0x6f,0x72,0x62,0x52,0x61,0x74,0x65,0x20,0x3d,0x20,0x31,0x30,0x2e,0x30,0x3b,
+  0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x69,0x67,0x68,0x62,0x6f,0x72,
+  0x69,0x6e,0x67,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x72,0x61,0x79,0x73,0x20,
+  0x64,0x6f,0x20,0x6e,0x6f,0x74,0x20,0x73,0x65,0x65,0x20,0x65,0x78,0x61,0x63,0x74,
+  0x6c,0x79,0x20,0x74,0x68,0x65,0x20,0x73,0x61,0x6d,0x65,0x20,0x73,0x61,0x6d,0x70,
+  0x6c,0x65,0x73,0x2c,0x20,0x73,0x6f,0x20,0x6b,0x65,0x65,0x70,0x20,0x74,0x68,0x69,
+  0x73,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,0x61,0x66,0x74,0x65,0x72,
+  0x20,0x74,0x68,0x65,0x69,0x72,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x69,
+  0x6f,0x6e,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,
+  0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x4d,0x61,0x72,0x67,0x69,0x6e,0x20,0x3d,
+  0x20,0x30,0x2e,0x30,0x32,0x3b,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,
+  0x6f,0x74,0x70,0x72,0x69,0x6e,0x74,0x20,0x6f,0x66,0x20,0x61,0x20,0x74,0x69,0x6c,
+  0x65,0x20,0x74,0x68,0x61,0x74,0x20,0x63,0x6f,0x76,0x65,0x72,0x73,0x20,0x6d,0x6f,
+  0x72,0x65,0x20,0x62,0x72,0x69,0x63,0x6b,0x73,0x20,0x74,0x68,0x61,0x6e,0x20,0x74,
+  0x68,0x69,0x73,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x74,0x65,0x73,0x74,0x65,
+  0x64,0x20,0x61,0x6e,0x64,0x20,0x63,0x6f,0x75,0x6e,0x74,0x73,0x20,0x61,0x73,0x20,
+  0x6e,0x6f,0x6e,0x2d,0x65,0x6d,0x70,0x74,0x79,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,
+  0x69,0x6e,0x74,0x20,0x6d,0x61,0x78,0x46,0x6f,0x6f,0x74,0x70,0x72,0x69,0x6e,0x74,
+  0x42,0x72,0x69,0x63,0x6b,0x73,0x20,0x3d,0x20,0x36,0x34,0x3b,0xa,0x63,0x6f,0x6e,
+  0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x72,0x69,0x63,0x6b,0x53,0x69,
+  0x7a,0x65,0x20,0x3d,0x20,0x38,0x2e,0x30,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,
+  0x69,0x6e,0x74,0x20,0x72,0x65,0x66,0x69,0x6e,0x65,0x53,0x74,0x65,0x70,0x73,0x20,
+  0x3d,0x20,0x36,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x33,0x20,
+  0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,
+  0x65,0x63,0x33,0x28,0x30,0x2e,0x39,0x2c,0x20,0x30,0x2e,0x38,0x35,0x2c,0x20,0x30,
+  0x2e,0x37,0x35,0x29,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
+  0x74,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,0x30,0x2e,0x33,0x3b,
+  0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x66,
+  0x66,0x75,0x73,0x65,0x20,0x3d,0x20,0x30,0x2e,0x37,0x3b,0xa,0x63,0x6f,0x6e,0x73,
+  0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,
+  0x20,0x3d,0x20,0x30,0x2e,0x34,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+  0x6f,0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3d,0x20,
+  0x33,0x32,0x2e,0x30,0x3b,0xa,0xa,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x6d,
+  0x70,0x6c,0x65,0x52,0x61,0x77,0x44,0x65,0x6e,0x73,0x69,0x74,0x79,0x28,0x76,0x65,
+  0x63,0x33,0x20,0x70,0x6f,0x73,0x29,0x20,0x7b,0xa,0x23,0x69,0x66,0x20,0x53,0x54,
+  0x4f,0x52,0x41,0x47,0x45,0x20,0x3d,0x3d,0x20,0x53,0x54,0x4f,0x52,0x41,0x47,0x45,
+  0x5f,0x43,0x4f,0x4d,0x50,0x52,0x45,0x53,0x53,0x45,0x44,0xa,0x9,0x2f,0x2f,0x20,
+  0x42,0x43,0x34,0x20,0x73,0x6c,0x69,0x63,0x65,0x73,0x20,0x61,0x72,0x65,0x20,0x73,
+  0x74,0x6f,0x72,0x65,0x64,0x20,0x61,0x73,0x20,0x6c,0x61,0x79,0x65,0x72,0x73,0x20,
+  0x6f,0x66,0x20,0x61,0x20,0x32,0x44,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,
+  0x61,0x72,0x72,0x61,0x79,0x2c,0xa,0x9,0x2f,0x2f,0x20,0x73,0x6f,0x20,0x69,0x6e,
+  0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,0x65,0x20,0x62,0x65,0x74,0x77,0x65,0x65,
+  0x6e,0x20,0x74,0x68,0x65,0x20,0x74,0x77,0x6f,0x20,0x6e,0x65,0x61,0x72,0x65,0x73,
+  0x74,0x20,0x73,0x6c,0x69,0x63,0x65,0x73,0x20,0x6d,0x61,0x6e,0x75,0x61,0x6c,0x6c,
+  0x79,0x2e,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x7a,0x20,0x3d,0x20,0x63,0x6c,
+  0x61,0x6d,0x70,0x28,0x70,0x6f,0x73,0x2e,0x7a,0x20,0x2a,0x20,0x67,0x72,0x69,0x64,
+  0x53,0x69,0x7a,0x65,0x2e,0x7a,0x20,0x2d,0x20,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,
+  0x30,0x2c,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x2e,0x7a,0x20,0x2d,0x20,
+  0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x7a,0x30,0x20,
+  0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x7a,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,
+  0x61,0x74,0x20,0x7a,0x31,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x7a,0x30,0x20,0x2b,
+  0x20,0x31,0x2e,0x30,0x2c,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x2e,0x7a,
+  0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,
+  0x64,0x30,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x63,0x6f,0x6d,
+  0x70,0x72,0x65,0x73,0x73,0x65,0x64,0x44,0x65,0x6e,0x73,0x69,0x74,0x79,0x2c,0x20,
+  0x76,0x65,0x63,0x33,0x28,0x70,0x6f,0x73,0x2e,0x78,0x79,0x2c,0x20,0x7a,0x30,0x29,
+  0x29,0x2e,0x78,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x31,0x20,0x3d,
+  0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,
+  0x73,0x65,0x64,0x44,0x65,0x6e,0x73,0x69,0x74,0x79,0x2c,0x20,0x76,0x65,0x63,0x33,
+  0x28,0x70,0x6f,0x73,0x2e,0x78,0x79,0x2c,0x20,0x7a,0x31,0x29,0x29,0x2e,0x78,0x3b,
+  0xa,0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x78,0x28,0x64,0x30,0x2c,
+  0x20,0x64,0x31,0x2c,0x20,0x7a,0x20,0x2d,0x20,0x7a,0x30,0x29,0x20,0x2a,0x20,0x64,
+  0x65,0x6e,0x73,0x69,0x74,0x79,0x52,0x61,0x6e,0x67,0x65,0x3b,0xa,0x23,0x65,0x6c,
+  0x69,0x66,0x20,0x53,0x54,0x4f,0x52,0x41,0x47,0x45,0x20,0x3d,0x3d,0x20,0x53,0x54,
+  0x4f,0x52,0x41,0x47,0x45,0x5f,0x53,0x50,0x41,0x52,0x53,0x45,0xa,0x9,0x2f,0x2f,
+  0x20,0x6c,0x6f,0x6f,0x6b,0x20,0x75,0x70,0x20,0x74,0x68,0x65,0x20,0x73,0x6c,0x6f,
+  0x74,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x62,0x72,0x69,0x63,0x6b,0x20,0x69,
+  0x6e,0x20,0x74,0x68,0x65,0x20,0x61,0x74,0x6c,0x61,0x73,0x3b,0x20,0x65,0x6d,0x70,
+  0x74,0x79,0x20,0x62,0x72,0x69,0x63,0x6b,0x73,0x20,0x61,0x72,0x65,0x20,0x6e,0x6f,
+  0x74,0x20,0x73,0x74,0x6f,0x72,0x65,0x64,0x2e,0xa,0x9,0x2f,0x2f,0x20,0x65,0x61,
+  0x63,0x68,0x20,0x73,0x6c,0x6f,0x74,0x20,0x68,0x61,0x73,0x20,0x61,0x20,0x6f,0x6e,
+  0x65,0x2d,0x76,0x6f,0x78,0x65,0x6c,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x2c,0x20,
+  0x73,0x6f,0x20,0x74,0x72,0x69,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x66,0x69,0x6c,
+  0x74,0x65,0x72,0x69,0x6e,0x67,0x20,0x73,0x74,0x61,0x79,0x73,0x20,0x69,0x6e,0x73,
+  0x69,0x64,0x65,0x20,0x74,0x68,0x65,0x20,0x73,0x6c,0x6f,0x74,0x2e,0xa,0x9,0x76,
+  0x65,0x63,0x33,0x20,0x76,0x6f,0x78,0x65,0x6c,0x20,0x3d,0x20,0x70,0x6f,0x73,0x20,
+  0x2a,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x3b,0xa,0x9,0x69,0x76,0x65,
+  0x63,0x33,0x20,0x62,0x72,0x69,0x63,0x6b,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,
+  0x28,0x69,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x76,0x6f,0x78,
+  0x65,0x6c,0x20,0x2f,0x20,0x62,0x72,0x69,0x63,0x6b,0x53,0x69,0x7a,0x65,0x29,0x29,
+  0x2c,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x30,0x29,0x2c,0x20,0x74,0x65,0x78,0x74,
+  0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,0x62,0x72,0x69,0x63,0x6b,0x54,0x61,0x62,
+  0x6c,0x65,0x2c,0x20,0x30,0x29,0x20,0x2d,0x20,0x31,0x29,0x3b,0xa,0x9,0x75,0x76,
+  0x65,0x63,0x34,0x20,0x65,0x6e,0x74,0x72,0x79,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,
+  0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x62,0x72,0x69,0x63,0x6b,0x54,0x61,0x62,0x6c,
+  0x65,0x2c,0x20,0x62,0x72,0x69,0x63,0x6b,0x2c,0x20,0x30,0x29,0x3b,0xa,0x9,0x69,
+  0x66,0x20,0x28,0x65,0x6e,0x74,0x72,0x79,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x75,
+  0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x30,0x2e,0x30,0x3b,0xa,0xa,0x9,
+  0x76,0x65,0x63,0x33,0x20,0x6c,0x6f,0x63,0x61,0x6c,0x20,0x3d,0x20,0x76,0x6f,0x78,
+  0x65,0x6c,0x20,0x2d,0x20,0x76,0x65,0x63,0x33,0x28,0x62,0x72,0x69,0x63,0x6b,0x29,
+  0x20,0x2a,0x20,0x62,0x72,0x69,0x63,0x6b,0x53,0x69,0x7a,0x65,0x3b,0xa,0x9,0x76,
+  0x65,0x63,0x33,0x20,0x61,0x74,0x6c,0x61,0x73,0x50,0x6f,0x73,0x20,0x3d,0x20,0x76,
+  0x65,0x63,0x33,0x28,0x65,0x6e,0x74,0x72,0x79,0x2e,0x78,0x79,0x7a,0x29,0x20,0x2a,
+  0x20,0x28,0x62,0x72,0x69,0x63,0x6b,0x53,0x69,0x7a,0x65,0x20,0x2b,0x20,0x32,0x2e,
+  0x30,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x20,0x2b,0x20,0x6c,0x6f,0x63,0x61,0x6c,
+  0x3b,0xa,0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+  0x65,0x28,0x64,0x65,0x6e,0x73,0x69,0x74,0x79,0x2c,0x20,0x61,0x74,0x6c,0x61,0x73,
+  0x50,0x6f,0x73,0x20,0x2f,0x20,0x61,0x74,0x6c,0x61,0x73,0x53,0x69,0x7a,0x65,0x29,
+  0x2e,0x78,0x3b,0xa,0x23,0x65,0x6c,0x73,0x65,0xa,0x9,0x72,0x65,0x74,0x75,0x72,
+  0x6e,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x64,0x65,0x6e,0x73,0x69,0x74,
+  0x79,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2e,0x78,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,
+  0x66,0xa,0x7d,0xa,0xa,0x2f,0x2f,0x20,0x6d,0x61,0x70,0x20,0x74,0x68,0x65,0x20,
+  0x64,0x65,0x6e,0x73,0x69,0x74,0x79,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x74,
+  0x6f,0x20,0x5b,0x30,0x2c,0x20,0x31,0x5d,0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x61,
+  0x74,0x20,0x6c,0x6f,0x77,0x2d,0x63,0x6f,0x6e,0x74,0x72,0x61,0x73,0x74,0x20,0x64,
+  0x61,0x74,0x61,0x20,0x75,0x73,0x65,0x73,0x20,0x74,0x68,0x65,0x20,0x77,0x68,0x6f,
+  0x6c,0x65,0x20,0x72,0x61,0x6e,0x67,0x65,0xa,0x2f,0x2f,0x20,0x61,0x6e,0x64,0x20,
+  0x74,0x68,0x65,0x20,0x64,0x65,0x6e,0x73,0x69,0x74,0x69,0x65,0x73,0x20,0x62,0x65,
+  0x6c,0x6f,0x77,0x20,0x74,0x68,0x65,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x20,0x61,
+  0x72,0x65,0x20,0x73,0x6b,0x69,0x70,0x70,0x65,0x64,0x20,0x61,0x73,0x20,0x65,0x6d,
+  0x70,0x74,0x79,0x2e,0xa,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x6d,0x70,0x6c,
+  0x65,0x44,0x65,0x6e,0x73,0x69,0x74,0x79,0x28,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,
+  0x73,0x29,0x20,0x7b,0xa,0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x78,
+  0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x52,0x61,0x77,0x44,0x65,0x6e,0x73,0x69,0x74,
+  0x79,0x28,0x70,0x6f,0x73,0x29,0x20,0x2d,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x4d,
+  0x69,0x6e,0x2c,0x20,0x30,0x2e,0x30,0x29,0x20,0x2f,0x20,0x28,0x77,0x69,0x6e,0x64,
+  0x6f,0x77,0x4d,0x61,0x78,0x20,0x2d,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,0x4d,0x69,
+  0x6e,0x29,0x3b,0xa,0x7d,0xa,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,
+  0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,
+  0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0xa,0x2f,0x2f,0x20,0x42,0x6c,0x69,0x6e,0x6e,
+  0x2d,0x50,0x68,0x6f,0x6e,0x67,0x20,0x73,0x68,0x61,0x64,0x69,0x6e,0x67,0x20,0x77,
+  0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x65,0x63,0x6f,0x6d,0x70,0x75,
+  0x74,0x65,0x64,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x76,0x6f,0x6c,
+  0x75,0x6d,0x65,0x2e,0xa,0x2f,0x2f,0x20,0x72,0x67,0x62,0x20,0x68,0x6f,0x6c,0x64,
+  0x73,0x20,0x74,0x68,0x65,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x64,
+  0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x61,0x6e,0x64,0x20,0x61,0x20,
+  0x68,0x6f,0x6c,0x64,0x73,0x20,0x69,0x74,0x73,0x20,0x6d,0x61,0x67,0x6e,0x69,0x74,
+  0x75,0x64,0x65,0x2c,0x20,0x73,0x6f,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x6f,0x6e,0x65,
+  0x20,0x66,0x65,0x74,0x63,0x68,0x20,0x69,0x73,0x20,0x6e,0x65,0x65,0x64,0x65,0x64,
+  0x2e,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x73,0x68,0x61,0x64,0x69,0x6e,0x67,
+  0x20,0x66,0x61,0x64,0x65,0x73,0x20,0x6f,0x75,0x74,0x20,0x77,0x68,0x65,0x72,0x65,
+  0x20,0x74,0x68,0x65,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x69,0x73,
+  0x20,0x77,0x65,0x61,0x6b,0x2c,0x20,0x73,0x69,0x6e,0x63,0x65,0x20,0x74,0x68,0x65,
+  0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x69,0x73,0x20,0x6d,0x65,0x61,0x6e,0x69,
+  0x6e,0x67,0x6c,0x65,0x73,0x73,0x20,0x74,0x68,0x65,0x72,0x65,0x2e,0xa,0x76,0x65,
+  0x63,0x33,0x20,0x73,0x68,0x61,0x64,0x65,0x28,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,
+  0x73,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x65,0x79,0x65,0x29,0x20,0x7b,0xa,0x9,
+  0x76,0x65,0x63,0x34,0x20,0x67,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+  0x28,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x73,0x2c,0x20,0x70,0x6f,0x73,0x29,
+  0x3b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x67,0x2e,0x78,0x79,
+  0x7a,0x20,0x2a,0x20,0x32,0x2e,0x30,0x20,0x2d,0x20,0x31,0x2e,0x30,0x3b,0xa,0x9,
+  0x69,0x66,0x20,0x28,0x64,0x6f,0x74,0x28,0x6e,0x2c,0x20,0x6e,0x29,0x20,0x3c,0x20,
+  0x31,0x65,0x2d,0x34,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,
+  0x33,0x28,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x2b,0x20,0x64,0x69,0x66,0x66,
+  0x75,0x73,0x65,0x29,0x3b,0xa,0x9,0x6e,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+  0x6c,0x69,0x7a,0x65,0x28,0x6e,0x29,0x3b,0xa,0xa,0x9,0x76,0x65,0x63,0x33,0x20,
+  0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,
+  0x67,0x68,0x74,0x50,0x6f,0x73,0x20,0x2d,0x20,0x70,0x6f,0x73,0x29,0x3b,0xa,0x9,
+  0x76,0x65,0x63,0x33,0x20,0x76,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+  0x7a,0x65,0x28,0x65,0x79,0x65,0x20,0x2d,0x20,0x70,0x6f,0x73,0x29,0x3b,0xa,0x9,
+  0x76,0x65,0x63,0x33,0x20,0x68,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+  0x7a,0x65,0x28,0x6c,0x20,0x2b,0x20,0x76,0x29,0x3b,0xa,0xa,0x9,0x2f,0x2f,0x20,
+  0x74,0x77,0x6f,0x20,0x73,0x69,0x64,0x65,0x64,0x20,0x6c,0x69,0x67,0x68,0x74,0x69,
+  0x6e,0x67,0x2c,0x20,0x73,0x69,0x6e,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x67,0x72,
+  0x61,0x64,0x69,0x65,0x6e,0x74,0x20,0x70,0x6f,0x69,0x6e,0x74,0x73,0x20,0x69,0x6e,
+  0x77,0x61,0x72,0x64,0x20,0x6f,0x72,0x20,0x6f,0x75,0x74,0x77,0x61,0x72,0x64,0x20,
+  0x64,0x65,0x70,0x65,0x6e,0x64,0x69,0x6e,0x67,0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,
+  0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,
+  0x6c,0x69,0x74,0x20,0x3d,0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x2b,0x20,
+  0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x2a,0x20,0x61,0x62,0x73,0x28,0x64,0x6f,
+  0x74,0x28,0x6e,0x2c,0x20,0x6c,0x29,0x29,0x20,0x2b,0x20,0x73,0x70,0x65,0x63,0x75,
+  0x6c,0x61,0x72,0x20,0x2a,0x20,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x64,0x6f,
+  0x74,0x28,0x6e,0x2c,0x20,0x68,0x29,0x29,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,
+  0x65,0x73,0x73,0x29,0x3b,0xa,0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,
+  0x63,0x33,0x28,0x6d,0x69,0x78,0x28,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x2b,
+  0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x2c,0x20,0x6c,0x69,0x74,0x2c,0x20,0x73,
+  0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x30,
+  0x2e,0x31,0x2c,0x20,0x67,0x2e,0x61,0x29,0x29,0x29,0x3b,0xa,0x7d,0xa,0x23,0x65,
+  0x6e,0x64,0x69,0x66,0xa,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,
+  0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,
+  0x49,0x53,0x4f,0x52,0x41,0x59,0x43,0x41,0x53,0x54,0xa,0x2f,0x2f,0x20,0x72,0x65,
+  0x66,0x69,0x6e,0x65,0x20,0x74,0x68,0x65,0x20,0x63,0x72,0x6f,0x73,0x73,0x69,0x6e,
+  0x67,0x20,0x62,0x65,0x74,0x77,0x65,0x65,0x6e,0x20,0x70,0x6f,0x73,0x30,0x20,0x28,
+  0x62,0x65,0x6c,0x6f,0x77,0x20,0x74,0x68,0x65,0x20,0x69,0x73,0x6f,0x20,0x76,0x61,
+  0x6c,0x75,0x65,0x29,0x20,0x61,0x6e,0x64,0x20,0x70,0x6f,0x73,0x31,0x20,0x28,0x61,
+  0x62,0x6f,0x76,0x65,0x20,0x69,0x74,0x29,0x2e,0xa,0x2f,0x2f,0x20,0x65,0x61,0x63,
+  0x68,0x20,0x73,0x74,0x65,0x70,0x20,0x74,0x61,0x6b,0x65,0x73,0x20,0x74,0x68,0x65,
+  0x20,0x73,0x65,0x63,0x61,0x6e,0x74,0x20,0x70,0x6f,0x69,0x6e,0x74,0x20,0x61,0x6e,
+  0x64,0x20,0x6b,0x65,0x65,0x70,0x73,0x20,0x74,0x68,0x65,0x20,0x68,0x61,0x6c,0x66,
+  0x20,0x74,0x68,0x61,0x74,0x20,0x73,0x74,0x69,0x6c,0x6c,0x20,0x63,0x6f,0x6e,0x74,
+  0x61,0x69,0x6e,0x73,0x20,0x74,0x68,0x65,0x20,0x63,0x72,0x6f,0x73,0x73,0x69,0x6e,
+  0x67,0x2e,0xa,0x76,0x65,0x63,0x33,0x20,0x72,0x65,0x66,0x69,0x6e,0x65,0x48,0x69,
+  0x74,0x28,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x30,0x2c,0x20,0x66,0x6c,0x6f,
+  0x61,0x74,0x20,0x64,0x30,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x31,
+  0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x31,0x29,0x20,0x7b,0xa,0x9,0x66,
+  0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,
+  0x20,0x3c,0x20,0x72,0x65,0x66,0x69,0x6e,0x65,0x53,0x74,0x65,0x70,0x73,0x3b,0x20,
+  0x2b,0x2b,0x69,0x29,0x20,0x7b,0xa,0x9,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,
+  0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x69,0x73,0x6f,0x56,0x61,0x6c,
+  0x75,0x65,0x20,0x2d,0x20,0x64,0x30,0x29,0x20,0x2f,0x20,0x6d,0x61,0x78,0x28,0x64,
+  0x31,0x20,0x2d,0x20,0x64,0x30,0x2c,0x20,0x31,0x65,0x2d,0x36,0x29,0x2c,0x20,0x30,
+  0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x9,0x76,0x65,0x63,0x33,
+  0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x70,0x6f,0x73,0x30,0x2c,
+  0x20,0x70,0x6f,0x73,0x31,0x2c,0x20,0x74,0x29,0x3b,0xa,0x9,0x9,0x66,0x6c,0x6f,
+  0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,
+  0x73,0x69,0x74,0x79,0x28,0x70,0x6f,0x73,0x29,0x3b,0xa,0x9,0x9,0x53,0x54,0x41,
+  0x54,0x28,0x73,0x74,0x61,0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,0x73,0x2b,0x2b,0x3b,
+  0x29,0xa,0x9,0x9,0x69,0x66,0x20,0x28,0x64,0x20,0x3c,0x20,0x69,0x73,0x6f,0x56,
+  0x61,0x6c,0x75,0x65,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x70,0x6f,0x73,0x30,0x20,
+  0x3d,0x20,0x70,0x6f,0x73,0x3b,0xa,0x9,0x9,0x9,0x64,0x30,0x20,0x3d,0x20,0x64,
+  0x3b,0xa,0x9,0x9,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0xa,0x9,0x9,0x9,
+  0x70,0x6f,0x73,0x31,0x20,0x3d,0x20,0x70,0x6f,0x73,0x3b,0xa,0x9,0x9,0x9,0x64,
+  0x31,0x20,0x3d,0x20,0x64,0x3b,0xa,0x9,0x9,0x7d,0xa,0x9,0x7d,0xa,0x9,0x72,
+  0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x69,0x78,0x28,0x70,0x6f,0x73,0x30,0x2c,0x20,
+  0x70,0x6f,0x73,0x31,0x2c,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x69,0x73,0x6f,
+  0x56,0x61,0x6c,0x75,0x65,0x20,0x2d,0x20,0x64,0x30,0x29,0x20,0x2f,0x20,0x6d,0x61,
+  0x78,0x28,0x64,0x31,0x20,0x2d,0x20,0x64,0x30,0x2c,0x20,0x31,0x65,0x2d,0x36,0x29,
+  0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0xa,0x7d,0xa,
+  0xa,0x2f,0x2f,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x66,0x72,0x6f,0x6d,0x20,
+  0x74,0x68,0x65,0x20,0x63,0x65,0x6e,0x74,0x72,0x61,0x6c,0x20,0x64,0x69,0x66,0x66,
+  0x65,0x72,0x65,0x6e,0x63,0x65,0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x64,
+  0x65,0x6e,0x73,0x69,0x74,0x79,0x2c,0x20,0x63,0x6f,0x6d,0x70,0x75,0x74,0x65,0x64,
+  0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x66,0x6c,0x79,0xa,0x76,0x65,0x63,0x33,
+  0x20,0x63,0x6f,0x6d,0x70,0x75,0x74,0x65,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x76,
+  0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x29,0x20,0x7b,0xa,0x9,0x76,0x65,0x63,0x33,
+  0x20,0x68,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2f,0x20,0x67,0x72,0x69,0x64,0x53,
+  0x69,0x7a,0x65,0x3b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x67,0x20,0x3d,0x20,0x76,
+  0x65,0x63,0x33,0x28,0xa,0x9,0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,
+  0x73,0x69,0x74,0x79,0x28,0x70,0x6f,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,0x28,
+  0x68,0x2e,0x78,0x2c,0x20,0x30,0x2c,0x20,0x30,0x29,0x29,0x20,0x2d,0x20,0x73,0x61,
+  0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,0x73,0x69,0x74,0x79,0x28,0x70,0x6f,0x73,0x20,
+  0x2d,0x20,0x76,0x65,0x63,0x33,0x28,0x68,0x2e,0x78,0x2c,0x20,0x30,0x2c,0x20,0x30,
+  0x29,0x29,0x2c,0xa,0x9,0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,0x73,
+  0x69,0x74,0x79,0x28,0x70,0x6f,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,0x28,0x30,
+  0x2c,0x20,0x68,0x2e,0x79,0x2c,0x20,0x30,0x29,0x29,0x20,0x2d,0x20,0x73,0x61,0x6d,
+  0x70,0x6c,0x65,0x44,0x65,0x6e,0x73,0x69,0x74,0x79,0x28,0x70,0x6f,0x73,0x20,0x2d,
+  0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2c,0x20,0x68,0x2e,0x79,0x2c,0x20,0x30,0x29,
+  0x29,0x2c,0xa,0x9,0x9,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,0x73,0x69,
+  0x74,0x79,0x28,0x70,0x6f,0x73,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2c,
+  0x20,0x30,0x2c,0x20,0x68,0x2e,0x7a,0x29,0x29,0x20,0x2d,0x20,0x73,0x61,0x6d,0x70,
+  0x6c,0x65,0x44,0x65,0x6e,0x73,0x69,0x74,0x79,0x28,0x70,0x6f,0x73,0x20,0x2d,0x20,
+  0x76,0x65,0x63,0x33,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x68,0x2e,0x7a,0x29,0x29,
+  0x29,0x3b,0xa,0x9,0x53,0x54,0x41,0x54,0x28,0x73,0x74,0x61,0x74,0x53,0x61,0x6d,
+  0x70,0x6c,0x65,0x73,0x20,0x2b,0x3d,0x20,0x36,0x3b,0x29,0xa,0x9,0x69,0x66,0x20,
+  0x28,0x64,0x6f,0x74,0x28,0x67,0x2c,0x20,0x67,0x29,0x20,0x3c,0x20,0x31,0x65,0x2d,
+  0x31,0x32,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x33,0x28,
+  0x30,0x29,0x3b,0xa,0xa,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x67,0x72,0x61,
+  0x64,0x69,0x65,0x6e,0x74,0x20,0x70,0x6f,0x69,0x6e,0x74,0x73,0x20,0x69,0x6e,0x74,
+  0x6f,0x20,0x74,0x68,0x65,0x20,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x2e,0x20,0x73,
+  0x69,0x6e,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x67,0x68,0x74,0x69,0x6e,
+  0x67,0x20,0x69,0x73,0x20,0x64,0x6f,0x6e,0x65,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,
+  0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,
+  0x61,0x74,0x65,0x73,0x2c,0xa,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x6e,0x6f,
+  0x72,0x6d,0x61,0x6c,0x20,0x69,0x73,0x20,0x73,0x63,0x61,0x6c,0x65,0x64,0x20,0x62,
+  0x79,0x20,0x74,0x68,0x65,0x20,0x67,0x72,0x69,0x64,0x20,0x73,0x69,0x7a,0x65,0x2e,
+  0xa,0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,
+  0x7a,0x65,0x28,0x2d,0x67,0x20,0x2f,0x20,0x68,0x29,0x3b,0xa,0x7d,0xa,0xa,0x76,
+  0x65,0x63,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x48,0x69,0x74,0x28,0x76,0x65,0x63,
+  0x33,0x20,0x68,0x69,0x74,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x65,0x79,0x65,0x29,
+  0x20,0x7b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x63,0x6f,0x6d,
+  0x70,0x75,0x74,0x65,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x28,0x68,0x69,0x74,0x29,0x3b,
+  0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x6c,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,
+  0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x20,0x2d,0x20,
+  0x68,0x69,0x74,0x29,0x3b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x76,0x20,0x3d,0x20,
+  0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x65,0x79,0x65,0x20,0x2d,0x20,
+  0x68,0x69,0x74,0x29,0x3b,0xa,0x9,0x69,0x66,0x20,0x28,0x64,0x6f,0x74,0x28,0x6e,
+  0x2c,0x20,0x6e,0x29,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x20,0x6e,0x20,0x3d,
+  0x20,0x76,0x3b,0xa,0x9,0x69,0x66,0x20,0x28,0x64,0x6f,0x74,0x28,0x6e,0x2c,0x20,
+  0x76,0x29,0x20,0x3c,0x20,0x30,0x2e,0x30,0x29,0x20,0x6e,0x20,0x3d,0x20,0x2d,0x6e,
+  0x3b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x68,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,
+  0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x20,0x2b,0x20,0x76,0x29,0x3b,0xa,0xa,0x9,
+  0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,0x74,0x20,0x3d,0x20,0x61,0x6d,0x62,0x69,
+  0x65,0x6e,0x74,0x20,0x2b,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x2a,0x20,
+  0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x2c,0x20,0x6c,0x29,0x2c,0x20,0x30,
+  0x2e,0x30,0x29,0x3b,0xa,0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,
+  0x34,0x28,0x73,0x75,0x72,0x66,0x61,0x63,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,
+  0x20,0x6c,0x69,0x74,0x20,0x2b,0x20,0x76,0x65,0x63,0x33,0x28,0x73,0x70,0x65,0x63,
+  0x75,0x6c,0x61,0x72,0x20,0x2a,0x20,0x70,0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,
+  0x6f,0x74,0x28,0x6e,0x2c,0x20,0x68,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,
+  0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x29,0x29,0x2c,0x20,0x31,0x2e,0x30,
+  0x29,0x3b,0xa,0x7d,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x23,0x69,0x66,
+  0x20,0x45,0x4d,0x50,0x54,0x59,0x5f,0x53,0x4b,0x49,0x50,0x50,0x49,0x4e,0x47,0xa,
+  0x2f,0x2f,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x73,0x20,0x74,0x68,0x65,0x20,0x6e,
+  0x75,0x6d,0x62,0x65,0x72,0x20,0x6f,0x66,0x20,0x73,0x74,0x65,0x70,0x73,0x20,0x6e,
+  0x65,0x65,0x64,0x65,0x64,0x20,0x74,0x6f,0x20,0x6c,0x65,0x61,0x76,0x65,0x20,0x74,
+  0x68,0x65,0x20,0x6d,0x69,0x6e,0x2d,0x6d,0x61,0x78,0x20,0x62,0x72,0x69,0x63,0x6b,
+  0x20,0x74,0x68,0x61,0x74,0x20,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x73,0x20,0x70,
+  0x6f,0x73,0x2e,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x62,0x72,0x69,0x63,0x6b,
+  0x20,0x63,0x6f,0x76,0x65,0x72,0x73,0x20,0x74,0x68,0x65,0x20,0x63,0x65,0x6c,0x6c,
+  0x73,0x20,0x5b,0x62,0x20,0x2a,0x20,0x62,0x72,0x69,0x63,0x6b,0x53,0x69,0x7a,0x65,
+  0x2c,0x20,0x28,0x62,0x20,0x2b,0x20,0x31,0x29,0x20,0x2a,0x20,0x62,0x72,0x69,0x63,
+  0x6b,0x53,0x69,0x7a,0x65,0x29,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x76,0x6f,
+  0x78,0x65,0x6c,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x20,0x63,0x6f,0x6f,0x72,0x64,
+  0x69,0x6e,0x61,0x74,0x65,0x73,0x2e,0xa,0x69,0x6e,0x74,0x20,0x73,0x74,0x65,0x70,
+  0x73,0x54,0x6f,0x4c,0x65,0x61,0x76,0x65,0x42,0x72,0x69,0x63,0x6b,0x28,0x76,0x65,
+  0x63,0x33,0x20,0x70,0x6f,0x73,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x72,
+  0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x72,0x69,0x63,0x6b,0x29,0x20,0x7b,0xa,
+  0x9,0x76,0x65,0x63,0x33,0x20,0x6c,0x6f,0x77,0x65,0x72,0x20,0x3d,0x20,0x28,0x62,
+  0x72,0x69,0x63,0x6b,0x20,0x2a,0x20,0x62,0x72,0x69,0x63,0x6b,0x53,0x69,0x7a,0x65,
+  0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,0x2f,0x20,0x67,0x72,0x69,0x64,0x53,0x69,
+  0x7a,0x65,0x3b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x75,0x70,0x70,0x65,0x72,0x20,
+  0x3d,0x20,0x28,0x28,0x62,0x72,0x69,0x63,0x6b,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,
+  0x20,0x2a,0x20,0x62,0x72,0x69,0x63,0x6b,0x53,0x69,0x7a,0x65,0x20,0x2b,0x20,0x30,
+  0x2e,0x35,0x29,0x20,0x2f,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x3b,0xa,
+  0x9,0x76,0x65,0x63,0x33,0x20,0x74,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x28,0x6c,
+  0x6f,0x77,0x65,0x72,0x20,0x2d,0x20,0x70,0x6f,0x73,0x29,0x20,0x2f,0x20,0x64,0x69,
+  0x72,0x2c,0x20,0x28,0x75,0x70,0x70,0x65,0x72,0x20,0x2d,0x20,0x70,0x6f,0x73,0x29,
+  0x20,0x2f,0x20,0x64,0x69,0x72,0x29,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,
+  0x65,0x78,0x69,0x74,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x6d,0x69,0x6e,0x28,0x74,
+  0x2e,0x78,0x2c,0x20,0x74,0x2e,0x79,0x29,0x2c,0x20,0x74,0x2e,0x7a,0x29,0x3b,0xa,
+  0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x78,0x28,0x69,0x6e,0x74,0x28,
+  0x63,0x65,0x69,0x6c,0x28,0x65,0x78,0x69,0x74,0x20,0x2f,0x20,0x73,0x74,0x65,0x70,
+  0x53,0x69,0x7a,0x65,0x29,0x29,0x2c,0x20,0x31,0x29,0x3b,0xa,0x7d,0xa,0x23,0x65,
+  0x6e,0x64,0x69,0x66,0xa,0xa,0x23,0x69,0x66,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,
+  0x49,0x4f,0x4e,0x5f,0x50,0x41,0x53,0x53,0xa,0x2f,0x2f,0x20,0x72,0x65,0x74,0x75,
+  0x72,0x6e,0x73,0x20,0x74,0x72,0x75,0x65,0x20,0x69,0x66,0x20,0x61,0x6c,0x6c,0x20,
+  0x74,0x68,0x65,0x20,0x6d,0x69,0x6e,0x2d,0x6d,0x61,0x78,0x20,0x62,0x72,0x69,0x63,
+  0x6b,0x73,0x20,0x74,0x68,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x70,0x20,
+  0x74,0x68,0x65,0x20,0x62,0x6f,0x78,0x20,0x5b,0x6c,0x6f,0x77,0x65,0x72,0x2c,0x20,
+  0x75,0x70,0x70,0x65,0x72,0x5d,0x20,0x61,0x72,0x65,0x20,0x65,0x6d,0x70,0x74,0x79,
+  0x2e,0xa,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,
+  0x20,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,0x20,0x74,0x68,0x65,0x20,0x76,0x6f,0x6c,
+  0x75,0x6d,0x65,0x20,0x61,0x72,0x65,0x20,0x63,0x6c,0x61,0x6d,0x70,0x65,0x64,0x20,
+  0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x65,0x64,0x67,0x65,0x2c,0x20,0x73,0x6f,0x20,
+  0x74,0x68,0x65,0x20,0x62,0x6f,0x78,0x20,0x69,0x73,0x20,0x63,0x6c,0x61,0x6d,0x70,
+  0x65,0x64,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x73,0x61,0x6d,0x65,0x20,0x77,
+  0x61,0x79,0x2e,0xa,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x45,0x6d,0x70,0x74,0x79,
+  0x52,0x65,0x67,0x69,0x6f,0x6e,0x28,0x76,0x65,0x63,0x33,0x20,0x6c,0x6f,0x77,0x65,
+  0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x75,0x70,0x70,0x65,0x72,0x29,0x20,0x7b,
+  0xa,0x9,0x69,0x76,0x65,0x63,0x33,0x20,0x6e,0x75,0x6d,0x42,0x72,0x69,0x63,0x6b,
+  0x73,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,0x28,
+  0x6d,0x69,0x6e,0x4d,0x61,0x78,0x42,0x72,0x69,0x63,0x6b,0x73,0x2c,0x20,0x30,0x29,
+  0x3b,0xa,0x9,0x69,0x76,0x65,0x63,0x33,0x20,0x62,0x30,0x20,0x3d,0x20,0x63,0x6c,
+  0x61,0x6d,0x70,0x28,0x69,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,
+  0x63,0x6c,0x61,0x6d,0x70,0x28,0x6c,0x6f,0x77,0x65,0x72,0x20,0x2a,0x20,0x67,0x72,
+  0x69,0x64,0x53,0x69,0x7a,0x65,0x20,0x2d,0x20,0x30,0x2e,0x35,0x2c,0x20,0x76,0x65,
+  0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,
+  0x65,0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x20,0x2f,0x20,0x62,0x72,0x69,0x63,0x6b,
+  0x53,0x69,0x7a,0x65,0x29,0x29,0x2c,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x30,0x29,
+  0x2c,0x20,0x6e,0x75,0x6d,0x42,0x72,0x69,0x63,0x6b,0x73,0x20,0x2d,0x20,0x31,0x29,
+  0x3b,0xa,0x9,0x69,0x76,0x65,0x63,0x33,0x20,0x62,0x31,0x20,0x3d,0x20,0x63,0x6c,
+  0x61,0x6d,0x70,0x28,0x69,0x76,0x65,0x63,0x33,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,
+  0x63,0x6c,0x61,0x6d,0x70,0x28,0x75,0x70,0x70,0x65,0x72,0x20,0x2a,0x20,0x67,0x72,
+  0x69,0x64,0x53,0x69,0x7a,0x65,0x20,0x2d,0x20,0x30,0x2e,0x35,0x2c,0x20,0x76,0x65,
+  0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x2c,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,
+  0x65,0x20,0x2d,0x20,0x31,0x2e,0x30,0x29,0x20,0x2f,0x20,0x62,0x72,0x69,0x63,0x6b,
+  0x53,0x69,0x7a,0x65,0x29,0x29,0x2c,0x20,0x69,0x76,0x65,0x63,0x33,0x28,0x30,0x29,
+  0x2c,0x20,0x6e,0x75,0x6d,0x42,0x72,0x69,0x63,0x6b,0x73,0x20,0x2d,0x20,0x31,0x29,
+  0x3b,0xa,0x9,0x69,0x76,0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,0x20,0x62,0x31,0x20,
+  0x2d,0x20,0x62,0x30,0x20,0x2b,0x20,0x31,0x3b,0xa,0x9,0x69,0x66,0x20,0x28,0x6e,
+  0x2e,0x78,0x20,0x2a,0x20,0x6e,0x2e,0x79,0x20,0x2a,0x20,0x6e,0x2e,0x7a,0x20,0x3e,
+  0x20,0x6d,0x61,0x78,0x46,0x6f,0x6f,0x74,0x70,0x72,0x69,0x6e,0x74,0x42,0x72,0x69,
+  0x63,0x6b,0x73,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,
+  0x65,0x3b,0xa,0xa,0x9,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x7a,0x20,
+  0x3d,0x20,0x62,0x30,0x2e,0x7a,0x3b,0x20,0x7a,0x20,0x3c,0x3d,0x20,0x62,0x31,0x2e,
+  0x7a,0x3b,0x20,0x2b,0x2b,0x7a,0x29,0x20,0x7b,0xa,0x9,0x9,0x66,0x6f,0x72,0x20,
+  0x28,0x69,0x6e,0x74,0x20,0x79,0x20,0x3d,0x20,0x62,0x30,0x2e,0x79,0x3b,0x20,0x79,
+  0x20,0x3c,0x3d,0x20,0x62,0x31,0x2e,0x79,0x3b,0x20,0x2b,0x2b,0x79,0x29,0x20,0x7b,
+  0xa,0x9,0x9,0x9,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,
+  0x20,0x62,0x30,0x2e,0x78,0x3b,0x20,0x78,0x20,0x3c,0x3d,0x20,0x62,0x31,0x2e,0x78,
+  0x3b,0x20,0x2b,0x2b,0x78,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x9,0x69,0x66,0x20,
+  0x28,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x6d,0x69,0x6e,0x4d,
+  0x61,0x78,0x42,0x72,0x69,0x63,0x6b,0x73,0x2c,0x20,0x69,0x76,0x65,0x63,0x33,0x28,
+  0x78,0x2c,0x20,0x79,0x2c,0x20,0x7a,0x29,0x2c,0x20,0x30,0x29,0x2e,0x79,0x20,0x3e,
+  0x20,0x30,0x2e,0x30,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,
+  0x73,0x65,0x3b,0xa,0x9,0x9,0x9,0x7d,0xa,0x9,0x9,0x7d,0xa,0x9,0x7d,0xa,
+  0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,0x72,0x75,0x65,0x3b,0xa,0x7d,0xa,
+  0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x23,0x69,0x66,0x20,0x53,0x54,0x41,0x54,
+  0x49,0x53,0x54,0x49,0x43,0x53,0xa,0x76,0x6f,0x69,0x64,0x20,0x77,0x72,0x69,0x74,
+  0x65,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x73,0x28,0x29,0x20,0x7b,0xa,
+  0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x53,0x74,0x61,0x74,0x73,0x20,0x3d,0x20,0x76,
+  0x65,0x63,0x34,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x73,0x74,0x61,0x74,0x49,0x74,
+  0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+  0x28,0x73,0x74,0x61,0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,0x73,0x29,0x2c,0x20,0x66,
+  0x6c,0x6f,0x61,0x74,0x28,0x73,0x74,0x61,0x74,0x4c,0x69,0x67,0x68,0x74,0x53,0x74,
+  0x65,0x70,0x73,0x29,0x2c,0x20,0x73,0x74,0x61,0x74,0x54,0x65,0x72,0x6d,0x69,0x6e,
+  0x61,0x74,0x65,0x64,0x20,0x3f,0x20,0x31,0x2e,0x30,0x20,0x3a,0x20,0x30,0x2e,0x30,
+  0x29,0x3b,0xa,0x7d,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x76,0x6f,0x69,
+  0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,0x23,0x69,0x66,0x20,0x4f,
+  0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,0x5f,0x50,0x41,0x53,0x53,0xa,0x9,0x2f,
+  0x2f,0x20,0x68,0x6f,0x77,0x20,0x6d,0x75,0x63,0x68,0x20,0x74,0x68,0x65,0x20,0x64,
+  0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x73,
+  0x20,0x66,0x72,0x6f,0x6d,0x20,0x74,0x68,0x69,0x73,0x20,0x63,0x6f,0x61,0x72,0x73,
+  0x65,0x20,0x72,0x61,0x79,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x78,
+  0x74,0x20,0x6f,0x6e,0x65,0x2e,0x20,0x74,0x68,0x65,0x20,0x64,0x65,0x72,0x69,0x76,
+  0x61,0x74,0x69,0x76,0x65,0x73,0x20,0x61,0x72,0x65,0x20,0x74,0x61,0x6b,0x65,0x6e,
+  0x20,0x62,0x65,0x66,0x6f,0x72,0x65,0xa,0x9,0x2f,0x2f,0x20,0x61,0x6e,0x79,0x20,
+  0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x61,0x74,
+  0x20,0x74,0x68,0x65,0x20,0x77,0x68,0x6f,0x6c,0x65,0x20,0x71,0x75,0x61,0x64,0x20,
+  0x69,0x73,0x20,0x73,0x74,0x69,0x6c,0x6c,0x20,0x61,0x63,0x74,0x69,0x76,0x65,0x2e,
+  0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x45,0x79,0x65,
+  0x20,0x3d,0x20,0x28,0x63,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x20,0x2b,0x20,
+  0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x20,
+  0x2f,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x3b,0xa,0x9,0x76,0x65,0x63,
+  0x33,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,
+  0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x28,0x76,0x50,0x6f,0x73,0x69,0x74,0x69,
+  0x6f,0x6e,0x20,0x2b,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x20,0x2a,0x20,
+  0x30,0x2e,0x35,0x29,0x20,0x2f,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x20,
+  0x2d,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x45,0x79,0x65,0x29,0x3b,0xa,0x9,0x76,
+  0x65,0x63,0x33,0x20,0x73,0x70,0x72,0x65,0x61,0x64,0x20,0x3d,0x20,0x61,0x62,0x73,
+  0x28,0x64,0x46,0x64,0x78,0x28,0x63,0x6f,0x61,0x72,0x73,0x65,0x44,0x69,0x72,0x29,
+  0x29,0x20,0x2b,0x20,0x61,0x62,0x73,0x28,0x64,0x46,0x64,0x79,0x28,0x63,0x6f,0x61,
+  0x72,0x73,0x65,0x44,0x69,0x72,0x29,0x29,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,
+  0xa,0xa,0x9,0x69,0x66,0x20,0x28,0x67,0x6c,0x5f,0x46,0x72,0x6f,0x6e,0x74,0x46,
+  0x61,0x63,0x69,0x6e,0x67,0x29,0x20,0x7b,0xa,0x9,0x9,0x64,0x69,0x73,0x63,0x61,
+  0x72,0x64,0x3b,0xa,0x9,0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x9,0x7d,
+  0xa,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x50,0x52,0x4f,0x4a,0x45,0x43,0x54,0x49,
+  0x4f,0x4e,0xa,0x9,0x2f,0x2f,0x20,0x72,0x65,0x75,0x73,0x65,0x20,0x74,0x68,0x65,
+  0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x70,0x72,
+  0x65,0x76,0x69,0x6f,0x75,0x73,0x20,0x66,0x72,0x61,0x6d,0x65,0x20,0x69,0x66,0x20,
+  0x69,0x74,0x20,0x77,0x61,0x73,0x20,0x72,0x65,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,
+  0x65,0x64,0x20,0x68,0x65,0x72,0x65,0xa,0x9,0x76,0x65,0x63,0x34,0x20,0x72,0x65,
+  0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x65,0x64,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,
+  0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x72,0x65,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,
+  0x65,0x64,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x69,0x76,0x65,0x63,
+  0x32,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,
+  0x79,0x29,0x2c,0x20,0x30,0x29,0x3b,0xa,0x9,0x69,0x66,0x20,0x28,0x72,0x65,0x70,
+  0x72,0x6f,0x6a,0x65,0x63,0x74,0x65,0x64,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,0x30,
+  0x29,0x20,0x7b,0xa,0x9,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+  0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x72,
+  0x65,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x65,0x64,0x43,0x6f,0x6c,0x6f,0x72,0x2c,
+  0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,
+  0x6f,0x72,0x64,0x2e,0x78,0x79,0x29,0x2c,0x20,0x30,0x29,0x3b,0xa,0x9,0x9,0x67,
+  0x6c,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+  0x76,0x65,0x63,0x34,0x28,0x72,0x65,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x65,0x64,
+  0x2e,0x78,0x79,0x7a,0x2c,0x20,0x72,0x65,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x65,
+  0x64,0x2e,0x77,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x9,0x72,0x65,
+  0x74,0x75,0x72,0x6e,0x3b,0xa,0x9,0x7d,0xa,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,
+  0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,
+  0x30,0x29,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x9,0x2f,0x2f,0x20,
+  0x63,0x6f,0x6e,0x6d,0x70,0x75,0x74,0x65,0x20,0x74,0x68,0x65,0x20,0x65,0x79,0x65,
+  0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,
+  0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x64,0x69,0x6e,0x61,
+  0x74,0x65,0x73,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x65,0x79,0x65,0x20,0x3d,0x20,
+  0x28,0x63,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x20,0x2b,0x20,0x67,0x72,0x69,
+  0x64,0x53,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x20,0x2f,0x20,0x67,
+  0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x3b,0xa,0xa,0x9,0x2f,0x2f,0x20,0x63,0x6f,
+  0x6d,0x70,0x75,0x74,0x65,0x20,0x74,0x68,0x65,0x20,0x6f,0x62,0x6a,0x65,0x63,0x74,
+  0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,
+  0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,
+  0x61,0x74,0x65,0x73,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x6f,0x62,0x6a,0x20,0x3d,
+  0x20,0x28,0x76,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x2b,0x20,0x67,0x72,
+  0x69,0x64,0x53,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x20,0x2f,0x20,
+  0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x3b,0xa,0xa,0x9,0x2f,0x2f,0x20,0x63,
+  0x6f,0x6d,0x70,0x75,0x74,0x65,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,0x20,0x64,
+  0x69,0x72,0x65,0x63,0x74,0x69,0x6f,0x6e,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x72,
+  0x61,0x79,0x20,0x3d,0x20,0x6f,0x62,0x6a,0x20,0x2d,0x20,0x65,0x79,0x65,0x3b,0xa,
+  0xa,0x9,0x69,0x6e,0x74,0x20,0x6e,0x75,0x6d,0x53,0x74,0x65,0x70,0x73,0x20,0x3d,
+  0x20,0x69,0x6e,0x74,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x72,0x61,0x79,0x29,
+  0x20,0x2f,0x20,0x73,0x74,0x65,0x70,0x53,0x69,0x7a,0x65,0x29,0x3b,0xa,0xa,0x9,
+  0x2f,0x2f,0x20,0x72,0x61,0x79,0x20,0x73,0x74,0x65,0x70,0x20,0x76,0x65,0x63,0x74,
+  0x6f,0x72,0x20,0x66,0x6f,0x72,0x20,0x65,0x61,0x63,0x68,0x20,0x73,0x74,0x65,0x70,
+  0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x64,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,
+  0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x72,0x61,0x79,0x29,0x3b,0xa,0x9,0x76,0x65,
+  0x63,0x33,0x20,0x73,0x74,0x65,0x70,0x20,0x3d,0x20,0x64,0x69,0x72,0x20,0x2a,0x20,
+  0x73,0x74,0x65,0x70,0x53,0x69,0x7a,0x65,0x3b,0xa,0xa,0x9,0x67,0x6c,0x46,0x72,
+  0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,
+  0x29,0x3b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x70,0x6f,0x73,0x20,0x3d,0x20,0x65,
+  0x79,0x65,0x3b,0xa,0x9,0x69,0x6e,0x74,0x20,0x66,0x69,0x72,0x73,0x74,0x53,0x74,
+  0x65,0x70,0x20,0x3d,0x20,0x30,0x3b,0xa,0xa,0x23,0x69,0x66,0x20,0x4f,0x43,0x43,
+  0x4c,0x55,0x53,0x49,0x4f,0x4e,0x5f,0x43,0x55,0x4c,0x4c,0x49,0x4e,0x47,0xa,0x9,
+  0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x65,0x6d,0x70,0x74,0x79,0x20,0x72,0x61,0x6e,
+  0x67,0x65,0x20,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x61,0x72,0x74,0x20,
+  0x63,0x6f,0x6d,0x65,0x73,0x20,0x66,0x72,0x6f,0x6d,0x20,0x74,0x68,0x65,0x20,0x6d,
+  0x69,0x6e,0x2d,0x6d,0x61,0x78,0x20,0x62,0x72,0x69,0x63,0x6b,0x73,0x20,0x61,0x72,
+  0x6f,0x75,0x6e,0x64,0x20,0x61,0x6c,0x6c,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,
+  0x73,0x20,0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x74,0x69,0x6c,0x65,0x2c,0x20,
+  0x73,0x6f,0x20,0x69,0x74,0x20,0x69,0x73,0x20,0x73,0x61,0x66,0x65,0xa,0x9,0x2f,
+  0x2f,0x20,0x74,0x6f,0x20,0x73,0x6b,0x69,0x70,0x2e,0x20,0x69,0x66,0x20,0x74,0x68,
+  0x65,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x72,0x61,0x79,0x20,0x6d,0x69,0x73,
+  0x73,0x65,0x64,0x20,0x74,0x68,0x65,0x20,0x62,0x6f,0x78,0x2c,0x20,0x6e,0x6f,0x74,
+  0x68,0x69,0x6e,0x67,0x20,0x69,0x73,0x20,0x6b,0x6e,0x6f,0x77,0x6e,0x20,0x61,0x62,
+  0x6f,0x75,0x74,0x20,0x74,0x68,0x69,0x73,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,
+  0x73,0x6f,0x20,0x74,0x72,0x61,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x77,0x68,0x6f,
+  0x6c,0x65,0x20,0x72,0x61,0x79,0x2e,0xa,0x9,0x69,0x76,0x65,0x63,0x32,0x20,0x6e,
+  0x75,0x6d,0x54,0x69,0x6c,0x65,0x73,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+  0x65,0x53,0x69,0x7a,0x65,0x28,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x54,
+  0x69,0x6c,0x65,0x73,0x2c,0x20,0x30,0x29,0x3b,0xa,0x9,0x69,0x76,0x65,0x63,0x32,
+  0x20,0x74,0x69,0x6c,0x65,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x69,0x76,0x65,0x63,
+  0x32,0x28,0x67,0x6c,0x5f,0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,
+  0x79,0x20,0x2a,0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x53,0x63,0x61,
+  0x6c,0x65,0x29,0x2c,0x20,0x6e,0x75,0x6d,0x54,0x69,0x6c,0x65,0x73,0x20,0x2d,0x20,
+  0x31,0x29,0x3b,0xa,0x9,0x76,0x65,0x63,0x34,0x20,0x74,0x69,0x6c,0x65,0x52,0x61,
+  0x6e,0x67,0x65,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,
+  0x28,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x54,0x69,0x6c,0x65,0x73,0x2c,
+  0x20,0x74,0x69,0x6c,0x65,0x2c,0x20,0x30,0x29,0x3b,0xa,0x9,0x69,0x66,0x20,0x28,
+  0x74,0x69,0x6c,0x65,0x52,0x61,0x6e,0x67,0x65,0x2e,0x78,0x20,0x3e,0x20,0x30,0x2e,
+  0x30,0x29,0x20,0x7b,0xa,0x9,0x9,0x69,0x66,0x20,0x28,0x74,0x69,0x6c,0x65,0x52,
+  0x61,0x6e,0x67,0x65,0x2e,0x79,0x20,0x3e,0x3d,0x20,0x31,0x65,0x32,0x30,0x29,0x20,
+  0x7b,0xa,0x9,0x9,0x9,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0xa,0x9,0x9,
+  0x9,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0xa,0x9,0x9,0x7d,0xa,0xa,0x9,0x9,
+  0x2f,0x2f,0x20,0x6f,0x6e,0x65,0x20,0x73,0x74,0x65,0x70,0x20,0x65,0x61,0x72,0x6c,
+  0x69,0x65,0x72,0x2c,0x20,0x73,0x69,0x6e,0x63,0x65,0x20,0x74,0x68,0x65,0x20,0x6a,
+  0x69,0x74,0x74,0x65,0x72,0x20,0x6d,0x61,0x79,0x20,0x6d,0x6f,0x76,0x65,0x20,0x74,
+  0x68,0x65,0x20,0x73,0x74,0x61,0x72,0x74,0x20,0x66,0x6f,0x72,0x77,0x61,0x72,0x64,
+  0x20,0x62,0x79,0x20,0x75,0x70,0x20,0x74,0x6f,0x20,0x6f,0x6e,0x65,0x20,0x73,0x74,
+  0x65,0x70,0xa,0x9,0x9,0x66,0x69,0x72,0x73,0x74,0x53,0x74,0x65,0x70,0x20,0x3d,
+  0x20,0x6d,0x61,0x78,0x28,0x69,0x6e,0x74,0x28,0x74,0x69,0x6c,0x65,0x52,0x61,0x6e,
+  0x67,0x65,0x2e,0x79,0x20,0x2f,0x20,0x73,0x74,0x65,0x70,0x53,0x69,0x7a,0x65,0x29,
+  0x20,0x2d,0x20,0x31,0x2c,0x20,0x30,0x29,0x3b,0xa,0x9,0x9,0x70,0x6f,0x73,0x20,
+  0x2b,0x3d,0x20,0x73,0x74,0x65,0x70,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,
+  0x66,0x69,0x72,0x73,0x74,0x53,0x74,0x65,0x70,0x29,0x3b,0xa,0x9,0x7d,0xa,0xa,
+  0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x72,
+  0x61,0x79,0x73,0x20,0x61,0x72,0x65,0x20,0x70,0x6f,0x69,0x6e,0x74,0x20,0x73,0x61,
+  0x6d,0x70,0x6c,0x65,0x73,0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x65,0x20,0x72,0x61,
+  0x79,0x20,0x69,0x73,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x63,0x75,0x74,0x20,0x73,0x68,
+  0x6f,0x72,0x74,0x20,0x77,0x68,0x65,0x72,0x65,0x20,0x61,0x6c,0x6c,0x20,0x6f,0x66,
+  0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x72,0x61,0x79,0x73,
+  0xa,0x9,0x2f,0x2f,0x20,0x6f,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x74,0x69,0x6c,
+  0x65,0x20,0x61,0x6e,0x64,0x20,0x69,0x74,0x73,0x20,0x6e,0x65,0x69,0x67,0x68,0x62,
+  0x6f,0x72,0x73,0x20,0x62,0x65,0x63,0x61,0x6d,0x65,0x20,0x6f,0x70,0x61,0x71,0x75,
+  0x65,0xa,0x9,0x62,0x6f,0x6f,0x6c,0x20,0x6f,0x70,0x61,0x71,0x75,0x65,0x20,0x3d,
+  0x20,0x74,0x72,0x75,0x65,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x61,
+  0x73,0x74,0x44,0x69,0x73,0x74,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0xa,0x9,0x66,
+  0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x79,0x20,0x3d,0x20,0x2d,0x31,0x3b,0x20,
+  0x79,0x20,0x3c,0x3d,0x20,0x31,0x3b,0x20,0x2b,0x2b,0x79,0x29,0x20,0x7b,0xa,0x9,
+  0x9,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x78,0x20,0x3d,0x20,0x2d,0x31,
+  0x3b,0x20,0x78,0x20,0x3c,0x3d,0x20,0x31,0x3b,0x20,0x2b,0x2b,0x78,0x29,0x20,0x7b,
+  0xa,0x9,0x9,0x9,0x76,0x65,0x63,0x34,0x20,0x72,0x61,0x6e,0x67,0x65,0x20,0x3d,
+  0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x6f,0x63,0x63,0x6c,
+  0x75,0x73,0x69,0x6f,0x6e,0x54,0x69,0x6c,0x65,0x73,0x2c,0x20,0x63,0x6c,0x61,0x6d,
+  0x70,0x28,0x74,0x69,0x6c,0x65,0x20,0x2b,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x78,
+  0x2c,0x20,0x79,0x29,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x30,0x29,0x2c,0x20,
+  0x6e,0x75,0x6d,0x54,0x69,0x6c,0x65,0x73,0x20,0x2d,0x20,0x31,0x29,0x2c,0x20,0x30,
+  0x29,0x3b,0xa,0x9,0x9,0x9,0x6f,0x70,0x61,0x71,0x75,0x65,0x20,0x3d,0x20,0x6f,
+  0x70,0x61,0x71,0x75,0x65,0x20,0x26,0x26,0x20,0x72,0x61,0x6e,0x67,0x65,0x2e,0x78,
+  0x20,0x3e,0x20,0x30,0x2e,0x30,0x20,0x26,0x26,0x20,0x72,0x61,0x6e,0x67,0x65,0x2e,
+  0x7a,0x20,0x3c,0x20,0x31,0x65,0x32,0x30,0x3b,0xa,0x9,0x9,0x9,0x6c,0x61,0x73,
+  0x74,0x44,0x69,0x73,0x74,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x6c,0x61,0x73,0x74,
+  0x44,0x69,0x73,0x74,0x2c,0x20,0x72,0x61,0x6e,0x67,0x65,0x2e,0x7a,0x29,0x3b,0xa,
+  0x9,0x9,0x7d,0xa,0x9,0x7d,0xa,0x9,0x69,0x66,0x20,0x28,0x6f,0x70,0x61,0x71,
+  0x75,0x65,0x29,0x20,0x7b,0xa,0x9,0x9,0x6e,0x75,0x6d,0x53,0x74,0x65,0x70,0x73,
+  0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x6e,0x75,0x6d,0x53,0x74,0x65,0x70,0x73,0x2c,
+  0x20,0x69,0x6e,0x74,0x28,0x28,0x6c,0x61,0x73,0x74,0x44,0x69,0x73,0x74,0x20,0x2b,
+  0x20,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x4d,0x61,0x72,0x67,0x69,0x6e,
+  0x29,0x20,0x2f,0x20,0x73,0x74,0x65,0x70,0x53,0x69,0x7a,0x65,0x29,0x20,0x2b,0x20,
+  0x31,0x29,0x3b,0xa,0x9,0x7d,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x23,
+  0x69,0x66,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,0x5f,0x50,0x41,0x53,
+  0x53,0xa,0x9,0x2f,0x2f,0x20,0x6d,0x61,0x72,0x63,0x68,0x20,0x74,0x68,0x65,0x20,
+  0x66,0x6f,0x6f,0x74,0x70,0x72,0x69,0x6e,0x74,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,
+  0x20,0x74,0x69,0x6c,0x65,0x20,0x75,0x6e,0x74,0x69,0x6c,0x20,0x69,0x74,0x20,0x72,
+  0x65,0x61,0x63,0x68,0x65,0x73,0x20,0x61,0x20,0x62,0x72,0x69,0x63,0x6b,0x20,0x74,
+  0x68,0x61,0x74,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x65,0x6d,0x70,0x74,0x79,
+  0x2e,0x20,0x74,0x68,0x65,0x20,0x66,0x6f,0x6f,0x74,0x70,0x72,0x69,0x6e,0x74,0x20,
+  0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x20,
+  0x74,0xa,0x9,0x2f,0x2f,0x20,0x69,0x73,0x20,0x62,0x6f,0x75,0x6e,0x64,0x65,0x64,
+  0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x73,0x70,0x72,0x65,0x61,0x64,0x20,0x74,
+  0x6f,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x69,0x67,0x68,0x62,0x6f,0x72,0x69,0x6e,
+  0x67,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x72,0x61,0x79,0x73,0x2c,0x20,0x77,
+  0x68,0x69,0x63,0x68,0x20,0x69,0x73,0x20,0x74,0x77,0x69,0x63,0x65,0x20,0x61,0x73,
+  0x20,0x77,0x69,0x64,0x65,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x20,0x74,0x69,0x6c,
+  0x65,0x2c,0x20,0x61,0x6e,0x64,0x20,0x69,0x74,0x20,0x61,0x6c,0x73,0x6f,0xa,0x9,
+  0x2f,0x2f,0x20,0x63,0x6f,0x76,0x65,0x72,0x73,0x20,0x74,0x68,0x65,0x20,0x73,0x74,
+  0x65,0x70,0x73,0x20,0x62,0x65,0x66,0x6f,0x72,0x65,0x20,0x61,0x6e,0x64,0x20,0x61,
+  0x66,0x74,0x65,0x72,0x20,0x74,0x2e,0x20,0x73,0x69,0x6e,0x63,0x65,0x20,0x74,0x68,
+  0x65,0x20,0x6e,0x65,0x69,0x67,0x68,0x62,0x6f,0x72,0x69,0x6e,0x67,0x20,0x72,0x61,
+  0x79,0x73,0x20,0x6d,0x61,0x79,0x20,0x62,0x65,0x20,0x6c,0x6f,0x6e,0x67,0x65,0x72,
+  0x20,0x74,0x68,0x61,0x6e,0x20,0x74,0x68,0x69,0x73,0x20,0x6f,0x6e,0x65,0x2c,0x20,
+  0x74,0x68,0x65,0x20,0x6d,0x61,0x72,0x63,0x68,0xa,0x9,0x2f,0x2f,0x20,0x63,0x6f,
+  0x6e,0x74,0x69,0x6e,0x75,0x65,0x73,0x20,0x75,0x6e,0x74,0x69,0x6c,0x20,0x74,0x68,
+  0x65,0x20,0x66,0x6f,0x6f,0x74,0x70,0x72,0x69,0x6e,0x74,0x20,0x68,0x61,0x73,0x20,
+  0x6c,0x65,0x66,0x74,0x20,0x74,0x68,0x65,0x20,0x62,0x6f,0x78,0x2e,0xa,0x9,0x66,
+  0x6c,0x6f,0x61,0x74,0x20,0x66,0x69,0x72,0x73,0x74,0x44,0x69,0x73,0x74,0x20,0x3d,
+  0x20,0x30,0x2e,0x30,0x3b,0xa,0x9,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,
+  0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x32,0x20,0x2a,0x20,0x6e,
+  0x75,0x6d,0x53,0x74,0x65,0x70,0x73,0x20,0x2b,0x20,0x36,0x34,0x3b,0x20,0x2b,0x2b,
+  0x69,0x29,0x20,0x7b,0xa,0x9,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x20,0x3d,
+  0x20,0x73,0x74,0x65,0x70,0x53,0x69,0x7a,0x65,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,
+  0x74,0x28,0x69,0x29,0x3b,0xa,0x9,0x9,0x76,0x65,0x63,0x33,0x20,0x63,0x65,0x6e,
+  0x74,0x65,0x72,0x20,0x3d,0x20,0x65,0x79,0x65,0x20,0x2b,0x20,0x64,0x69,0x72,0x20,
+  0x2a,0x20,0x74,0x3b,0xa,0x9,0x9,0x76,0x65,0x63,0x33,0x20,0x65,0x78,0x74,0x65,
+  0x6e,0x74,0x20,0x3d,0x20,0x73,0x70,0x72,0x65,0x61,0x64,0x20,0x2a,0x20,0x28,0x74,
+  0x20,0x2b,0x20,0x73,0x74,0x65,0x70,0x53,0x69,0x7a,0x65,0x29,0x20,0x2b,0x20,0x61,
+  0x62,0x73,0x28,0x64,0x69,0x72,0x29,0x20,0x2a,0x20,0x73,0x74,0x65,0x70,0x53,0x69,
+  0x7a,0x65,0x3b,0xa,0x9,0x9,0x76,0x65,0x63,0x33,0x20,0x6c,0x6f,0x77,0x65,0x72,
+  0x20,0x3d,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x20,0x2d,0x20,0x65,0x78,0x74,0x65,
+  0x6e,0x74,0x3b,0xa,0x9,0x9,0x76,0x65,0x63,0x33,0x20,0x75,0x70,0x70,0x65,0x72,
+  0x20,0x3d,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x20,0x2b,0x20,0x65,0x78,0x74,0x65,
+  0x6e,0x74,0x3b,0xa,0x9,0x9,0x69,0x66,0x20,0x28,0x61,0x6e,0x79,0x28,0x67,0x72,
+  0x65,0x61,0x74,0x65,0x72,0x54,0x68,0x61,0x6e,0x28,0x6c,0x6f,0x77,0x65,0x72,0x2c,
+  0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x2e,0x30,0x29,0x29,0x29,0x20,0x7c,0x7c,0x20,
+  0x61,0x6e,0x79,0x28,0x6c,0x65,0x73,0x73,0x54,0x68,0x61,0x6e,0x28,0x75,0x70,0x70,
+  0x65,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x30,0x29,0x29,0x29,0x29,
+  0x20,0x7b,0xa,0x9,0x9,0x9,0x69,0x66,0x20,0x28,0x69,0x20,0x3e,0x3d,0x20,0x6e,
+  0x75,0x6d,0x53,0x74,0x65,0x70,0x73,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x9,0x66,
+  0x69,0x72,0x73,0x74,0x44,0x69,0x73,0x74,0x20,0x3d,0x20,0x31,0x65,0x32,0x30,0x3b,
+  0xa,0x9,0x9,0x9,0x9,0x62,0x72,0x65,0x61,0x6b,0x3b,0xa,0x9,0x9,0x9,0x7d,
+  0xa,0x9,0x9,0x9,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0xa,0x9,0x9,
+  0x7d,0xa,0x9,0x9,0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x45,0x6d,0x70,0x74,0x79,
+  0x52,0x65,0x67,0x69,0x6f,0x6e,0x28,0x6c,0x6f,0x77,0x65,0x72,0x2c,0x20,0x75,0x70,
+  0x70,0x65,0x72,0x29,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x66,0x69,0x72,0x73,0x74,
+  0x44,0x69,0x73,0x74,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x74,0x20,0x2d,0x20,0x73,
+  0x74,0x65,0x70,0x53,0x69,0x7a,0x65,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0xa,0x9,
+  0x9,0x9,0x62,0x72,0x65,0x61,0x6b,0x3b,0xa,0x9,0x9,0x7d,0xa,0x9,0x7d,0xa,
+  0xa,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,
+  0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x72,
+  0x61,0x79,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x6e,0x65,0x65,0x64,0x73,0x20,0x74,0x6f,
+  0x20,0x62,0x65,0x20,0x74,0x72,0x61,0x63,0x65,0x64,0x20,0x66,0x72,0x6f,0x6d,0x20,
+  0x74,0x68,0x65,0x72,0x65,0xa,0x9,0x69,0x66,0x20,0x28,0x66,0x69,0x72,0x73,0x74,
+  0x44,0x69,0x73,0x74,0x20,0x3c,0x20,0x31,0x65,0x32,0x30,0x29,0x20,0x7b,0xa,0x9,
+  0x9,0x66,0x69,0x72,0x73,0x74,0x53,0x74,0x65,0x70,0x20,0x3d,0x20,0x69,0x6e,0x74,
+  0x28,0x66,0x69,0x72,0x73,0x74,0x44,0x69,0x73,0x74,0x20,0x2f,0x20,0x73,0x74,0x65,
+  0x70,0x53,0x69,0x7a,0x65,0x29,0x3b,0xa,0x9,0x9,0x70,0x6f,0x73,0x20,0x2b,0x3d,
+  0x20,0x73,0x74,0x65,0x70,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x66,0x69,
+  0x72,0x73,0x74,0x53,0x74,0x65,0x70,0x29,0x3b,0xa,0x9,0x7d,0x20,0x65,0x6c,0x73,
+  0x65,0x20,0x7b,0xa,0x9,0x9,0x6e,0x75,0x6d,0x53,0x74,0x65,0x70,0x73,0x20,0x3d,
+  0x20,0x30,0x3b,0xa,0x9,0x7d,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x23,
+  0x69,0x66,0x20,0x4a,0x49,0x54,0x54,0x45,0x52,0xa,0x9,0x2f,0x2f,0x20,0x6f,0x66,
+  0x66,0x73,0x65,0x74,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,0x20,0x62,0x79,0x20,
+  0x61,0x20,0x66,0x72,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x61,0x20,
+  0x73,0x74,0x65,0x70,0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,
+  0x65,0x20,0x66,0x69,0x78,0x65,0x64,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x20,0x70,
+  0x6c,0x61,0x6e,0x65,0x73,0x20,0x64,0x6f,0x20,0x6e,0x6f,0x74,0x20,0x73,0x68,0x6f,
+  0x77,0x20,0x75,0x70,0xa,0x9,0x2f,0x2f,0x20,0x61,0x73,0x20,0x77,0x6f,0x6f,0x64,
+  0x20,0x67,0x72,0x61,0x69,0x6e,0x2e,0x20,0x74,0x68,0x65,0x20,0x67,0x6f,0x6c,0x64,
+  0x65,0x6e,0x20,0x72,0x61,0x74,0x69,0x6f,0x20,0x73,0x65,0x71,0x75,0x65,0x6e,0x63,
+  0x65,0x20,0x67,0x69,0x76,0x65,0x73,0x20,0x65,0x61,0x63,0x68,0x20,0x61,0x63,0x63,
+  0x75,0x6d,0x75,0x6c,0x61,0x74,0x65,0x64,0x20,0x66,0x72,0x61,0x6d,0x65,0x20,0x61,
+  0x20,0x64,0x69,0x66,0x66,0x65,0x72,0x65,0x6e,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,
+  0x74,0x2e,0xa,0x9,0x69,0x76,0x65,0x63,0x32,0x20,0x6e,0x6f,0x69,0x73,0x65,0x53,
+  0x69,0x7a,0x65,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,0x7a,
+  0x65,0x28,0x62,0x6c,0x75,0x65,0x4e,0x6f,0x69,0x73,0x65,0x2c,0x20,0x30,0x29,0x3b,
+  0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,
+  0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,0x62,0x6c,0x75,0x65,
+  0x4e,0x6f,0x69,0x73,0x65,0x2c,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x5f,
+  0x46,0x72,0x61,0x67,0x43,0x6f,0x6f,0x72,0x64,0x2e,0x78,0x79,0x29,0x20,0x25,0x20,
+  0x6e,0x6f,0x69,0x73,0x65,0x53,0x69,0x7a,0x65,0x2c,0x20,0x30,0x29,0x2e,0x78,0x3b,
+  0xa,0x9,0x70,0x6f,0x73,0x20,0x2b,0x3d,0x20,0x73,0x74,0x65,0x70,0x20,0x2a,0x20,
+  0x66,0x72,0x61,0x63,0x74,0x28,0x6f,0x66,0x66,0x73,0x65,0x74,0x20,0x2b,0x20,0x66,
+  0x6c,0x6f,0x61,0x74,0x28,0x66,0x72,0x61,0x6d,0x65,0x49,0x6e,0x64,0x65,0x78,0x29,
+  0x20,0x2a,0x20,0x30,0x2e,0x36,0x31,0x38,0x30,0x33,0x34,0x29,0x3b,0xa,0x23,0x65,
+  0x6e,0x64,0x69,0x66,0xa,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,
+  0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,
+  0x56,0x4f,0x4c,0x55,0x4d,0x45,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6c,
+  0x70,0x68,0x61,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x20,0x2f,0x2f,0x69,0x6e,0x69,
+  0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x66,0x72,0x6f,0x6d,0x20,0x65,0x79,0x65,
+  0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,
+  0x65,0x63,0x33,0x28,0x30,0x29,0x3b,0xa,0x23,0x69,0x66,0x20,0x4f,0x43,0x43,0x4c,
+  0x55,0x53,0x49,0x4f,0x4e,0x5f,0x50,0x41,0x53,0x53,0xa,0x9,0x66,0x6c,0x6f,0x61,
+  0x74,0x20,0x6c,0x61,0x73,0x74,0x44,0x69,0x73,0x74,0x20,0x3d,0x20,0x31,0x65,0x32,
+  0x30,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x20,0x52,0x45,
+  0x50,0x52,0x4f,0x4a,0x45,0x43,0x54,0x49,0x4f,0x4e,0xa,0x9,0x2f,0x2f,0x20,0x74,
+  0x68,0x65,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x20,
+  0x77,0x68,0x65,0x72,0x65,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,0x20,0x62,0x65,
+  0x63,0x6f,0x6d,0x65,0x73,0x20,0x68,0x61,0x6c,0x66,0x20,0x6f,0x70,0x61,0x71,0x75,
+  0x65,0x2c,0x20,0x6f,0x72,0x20,0x74,0x68,0x65,0x20,0x66,0x69,0x72,0x73,0x74,0x20,
+  0x6e,0x6f,0x6e,0x2d,0x65,0x6d,0x70,0x74,0x79,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+  0x20,0x69,0x66,0x20,0x69,0x74,0x20,0x6e,0x65,0x76,0x65,0x72,0x20,0x64,0x6f,0x65,
+  0x73,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x66,0x69,0x72,0x73,0x74,0x53,0x61,0x6d,
+  0x70,0x6c,0x65,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x29,0x3b,0xa,0x9,
+  0x62,0x6f,0x6f,0x6c,0x20,0x68,0x61,0x73,0x46,0x69,0x72,0x73,0x74,0x53,0x61,0x6d,
+  0x70,0x6c,0x65,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0xa,0x23,0x65,0x6e,
+  0x64,0x69,0x66,0xa,0x23,0x65,0x6c,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,
+  0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,
+  0x49,0x53,0x4f,0x52,0x41,0x59,0x43,0x41,0x53,0x54,0xa,0x9,0x76,0x65,0x63,0x33,
+  0x20,0x70,0x72,0x65,0x76,0x50,0x6f,0x73,0x20,0x3d,0x20,0x65,0x79,0x65,0x3b,0xa,
+  0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x72,0x65,0x76,0x44,0x65,0x6e,0x73,0x20,
+  0x3d,0x20,0x30,0x2e,0x30,0x3b,0xa,0x23,0x65,0x6c,0x73,0x65,0xa,0x9,0x66,0x6c,
+  0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x52,0x45,0x4e,0x44,
+  0x45,0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,
+  0x52,0x5f,0x4d,0x49,0x4e,0x49,0x50,0x20,0x3f,0x20,0x31,0x65,0x32,0x30,0x20,0x3a,
+  0x20,0x30,0x2e,0x30,0x3b,0xa,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x6f,0x74,
+  0x61,0x6c,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0xa,0x9,0x69,0x6e,0x74,0x20,0x63,
+  0x6f,0x75,0x6e,0x74,0x20,0x3d,0x20,0x30,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,
+  0xa,0xa,0x23,0x69,0x66,0x20,0x45,0x4d,0x50,0x54,0x59,0x5f,0x53,0x4b,0x49,0x50,
+  0x50,0x49,0x4e,0x47,0xa,0x9,0x2f,0x2f,0x20,0x61,0x76,0x6f,0x69,0x64,0x20,0x74,
+  0x68,0x65,0x20,0x64,0x69,0x76,0x69,0x73,0x69,0x6f,0x6e,0x20,0x62,0x79,0x20,0x7a,
+  0x65,0x72,0x6f,0x20,0x77,0x68,0x65,0x6e,0x20,0x63,0x6f,0x6d,0x70,0x75,0x74,0x69,
+  0x6e,0x67,0x20,0x74,0x68,0x65,0x20,0x62,0x72,0x69,0x63,0x6b,0x20,0x65,0x78,0x69,
+  0x74,0xa,0x9,0x64,0x69,0x72,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x64,0x69,0x72,
+  0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x65,0x2d,0x36,0x29,0x2c,0x20,0x65,0x71,
+  0x75,0x61,0x6c,0x28,0x64,0x69,0x72,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,
+  0x30,0x29,0x29,0x29,0x3b,0xa,0x9,0x69,0x76,0x65,0x63,0x33,0x20,0x6e,0x75,0x6d,
+  0x42,0x72,0x69,0x63,0x6b,0x73,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+  0x53,0x69,0x7a,0x65,0x28,0x6d,0x69,0x6e,0x4d,0x61,0x78,0x42,0x72,0x69,0x63,0x6b,
+  0x73,0x2c,0x20,0x30,0x29,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x9,
+  0x2f,0x2f,0x20,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,0x20,0x66,0x6c,0x61,0x67,0xa,
+  0x9,0x2f,0x2f,0x20,0x69,0x66,0x20,0x74,0x68,0x69,0x73,0x20,0x69,0x73,0x20,0x66,
+  0x61,0x6c,0x73,0x65,0x2c,0x20,0x74,0x68,0x65,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,
+  0x74,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x6f,0x75,
+  0x74,0x73,0x69,0x64,0x65,0x20,0x74,0x68,0x65,0x20,0x62,0x6f,0x75,0x6e,0x64,0x69,
+  0x6e,0x67,0x20,0x62,0x6f,0x78,0x2e,0xa,0x9,0x2f,0x2f,0x20,0x6f,0x74,0x68,0x65,
+  0x72,0x77,0x69,0x73,0x65,0x2c,0x20,0x69,0x74,0x27,0x73,0x20,0x69,0x6e,0x73,0x69,
+  0x64,0x65,0x20,0x74,0x68,0x65,0x20,0x62,0x6f,0x75,0x6e,0x64,0x69,0x6e,0x67,0x20,
+  0x62,0x6f,0x78,0x2e,0xa,0x9,0x62,0x6f,0x6f,0x6c,0x20,0x6f,0x75,0x74,0x73,0x69,
+  0x64,0x65,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0xa,0x9,0x69,0x66,0x20,0x28,
+  0x70,0x6f,0x73,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x30,0x20,0x26,0x26,0x20,0x70,0x6f,
+  0x73,0x2e,0x78,0x20,0x3c,0x3d,0x20,0x31,0x20,0x26,0x26,0x20,0x70,0x6f,0x73,0x2e,
+  0x79,0x20,0x3e,0x3d,0x20,0x30,0x20,0x26,0x26,0x20,0x70,0x6f,0x73,0x2e,0x79,0x20,
+  0x3c,0x3d,0x20,0x31,0x20,0x26,0x26,0x20,0x70,0x6f,0x73,0x2e,0x7a,0x20,0x3e,0x3d,
+  0x20,0x30,0x20,0x26,0x26,0x20,0x70,0x6f,0x73,0x2e,0x7a,0x20,0x3c,0x3d,0x20,0x31,
+  0x29,0x20,0x7b,0xa,0x9,0x9,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,0x20,0x3d,0x20,
+  0x66,0x61,0x6c,0x73,0x65,0x3b,0xa,0x9,0x7d,0xa,0xa,0x9,0x66,0x6f,0x72,0x20,
+  0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x66,0x69,0x72,0x73,0x74,0x53,0x74,
+  0x65,0x70,0x3b,0x20,0x69,0x20,0x3c,0x20,0x6e,0x75,0x6d,0x53,0x74,0x65,0x70,0x73,
+  0x3b,0x20,0x2b,0x2b,0x69,0x29,0x20,0x7b,0xa,0x9,0x9,0x53,0x54,0x41,0x54,0x28,
+  0x73,0x74,0x61,0x74,0x49,0x74,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x73,0x2b,0x2b,
+  0x3b,0x29,0xa,0x9,0x9,0x69,0x66,0x20,0x28,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,
+  0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x69,0x66,0x20,0x28,0x70,0x6f,0x73,0x2e,0x78,
+  0x20,0x3c,0x20,0x30,0x20,0x7c,0x7c,0x20,0x70,0x6f,0x73,0x2e,0x78,0x20,0x3e,0x20,
+  0x31,0x20,0x7c,0x7c,0x20,0x70,0x6f,0x73,0x2e,0x79,0x20,0x3c,0x20,0x30,0x20,0x7c,
+  0x7c,0x20,0x70,0x6f,0x73,0x2e,0x79,0x20,0x3e,0x20,0x31,0x20,0x7c,0x7c,0x20,0x70,
+  0x6f,0x73,0x2e,0x7a,0x20,0x3c,0x20,0x30,0x20,0x7c,0x7c,0x20,0x70,0x6f,0x73,0x2e,
+  0x7a,0x20,0x3e,0x20,0x31,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x9,0x70,0x6f,0x73,
+  0x20,0x2b,0x3d,0x20,0x73,0x74,0x65,0x70,0x3b,0xa,0x9,0x9,0x9,0x9,0x63,0x6f,
+  0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0xa,0x9,0x9,0x9,0x7d,0x20,0x65,0x6c,0x73,
+  0x65,0x20,0x7b,0xa,0x9,0x9,0x9,0x9,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,0x20,
+  0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x4e,
+  0x44,0x45,0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,
+  0x45,0x52,0x5f,0x49,0x53,0x4f,0x52,0x41,0x59,0x43,0x41,0x53,0x54,0xa,0x9,0x9,
+  0x9,0x9,0x70,0x72,0x65,0x76,0x50,0x6f,0x73,0x20,0x3d,0x20,0x70,0x6f,0x73,0x3b,
+  0xa,0x9,0x9,0x9,0x9,0x70,0x72,0x65,0x76,0x44,0x65,0x6e,0x73,0x20,0x3d,0x20,
+  0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,0x73,0x69,0x74,0x79,0x28,0x70,0x6f,
+  0x73,0x29,0x3b,0xa,0x9,0x9,0x9,0x9,0x53,0x54,0x41,0x54,0x28,0x73,0x74,0x61,
+  0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,0x73,0x2b,0x2b,0x3b,0x29,0xa,0x9,0x9,0x9,
+  0x9,0x69,0x66,0x20,0x28,0x70,0x72,0x65,0x76,0x44,0x65,0x6e,0x73,0x20,0x3e,0x3d,
+  0x20,0x69,0x73,0x6f,0x56,0x61,0x6c,0x75,0x65,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,
+  0x9,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x72,0x61,0x79,0x20,0x65,0x6e,0x74,
+  0x65,0x72,0x73,0x20,0x74,0x68,0x65,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x69,
+  0x6e,0x73,0x69,0x64,0x65,0x20,0x74,0x68,0x65,0x20,0x73,0x75,0x72,0x66,0x61,0x63,
+  0x65,0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x65,0x20,0x68,0x69,0x74,0x20,0x69,0x73,
+  0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x62,0x6f,0x75,0x6e,0x64,0x61,0x72,0x79,
+  0xa,0x9,0x9,0x9,0x9,0x9,0x70,0x72,0x65,0x76,0x44,0x65,0x6e,0x73,0x20,0x3d,
+  0x20,0x30,0x2e,0x30,0x3b,0xa,0x9,0x9,0x9,0x9,0x7d,0xa,0x23,0x65,0x6e,0x64,
+  0x69,0x66,0xa,0x9,0x9,0x9,0x7d,0xa,0x9,0x9,0x7d,0xa,0xa,0x9,0x9,0x69,
+  0x66,0x20,0x28,0x70,0x6f,0x73,0x2e,0x78,0x20,0x3c,0x20,0x30,0x20,0x7c,0x7c,0x20,
+  0x70,0x6f,0x73,0x2e,0x78,0x20,0x3e,0x20,0x31,0x20,0x7c,0x7c,0x20,0x70,0x6f,0x73,
+  0x2e,0x79,0x20,0x3c,0x20,0x30,0x20,0x7c,0x7c,0x20,0x70,0x6f,0x73,0x2e,0x79,0x20,
+  0x3e,0x20,0x31,0x20,0x7c,0x7c,0x20,0x70,0x6f,0x73,0x2e,0x7a,0x20,0x3c,0x20,0x30,
+  0x20,0x7c,0x7c,0x20,0x70,0x6f,0x73,0x2e,0x7a,0x20,0x3e,0x20,0x31,0x29,0x20,0x7b,
+  0xa,0x9,0x9,0x9,0x62,0x72,0x65,0x61,0x6b,0x3b,0xa,0x9,0x9,0x7d,0xa,0xa,
+  0x23,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,
+  0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,
+  0xa,0x9,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,
+  0x65,0x6e,0x73,0x20,0x3d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,0x73,
+  0x69,0x74,0x79,0x28,0x70,0x6f,0x73,0x29,0x20,0x2a,0x20,0x64,0x65,0x6e,0x73,0x69,
+  0x74,0x79,0x53,0x63,0x61,0x6c,0x65,0x3b,0xa,0x9,0x9,0x53,0x54,0x41,0x54,0x28,
+  0x73,0x74,0x61,0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,0x73,0x2b,0x2b,0x3b,0x29,0xa,
+  0x9,0x9,0x69,0x66,0x20,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,0x73,
+  0x20,0x3e,0x20,0x31,0x65,0x2d,0x35,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x2f,0x2f,
+  0x20,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+  0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x72,
+  0x61,0x79,0x20,0x63,0x6f,0x76,0x65,0x72,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,
+  0x69,0x73,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x20,0x28,0x42,0x65,0x65,0x72,0x2d,
+  0x4c,0x61,0x6d,0x62,0x65,0x72,0x74,0x29,0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x61,
+  0x74,0xa,0x9,0x9,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x61,0x63,0x63,0x75,
+  0x6d,0x75,0x6c,0x61,0x74,0x65,0x64,0x20,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x20,
+  0x64,0x6f,0x65,0x73,0x20,0x6e,0x6f,0x74,0x20,0x64,0x65,0x70,0x65,0x6e,0x64,0x20,
+  0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x73,0x74,0x65,0x70,0x20,0x73,0x69,0x7a,0x65,
+  0xa,0x9,0x9,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,
+  0x41,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x65,0x78,
+  0x70,0x28,0x2d,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,0x73,0x20,0x2a,0x20,
+  0x61,0x62,0x73,0x6f,0x72,0x62,0x52,0x61,0x74,0x65,0x20,0x2a,0x20,0x73,0x74,0x65,
+  0x70,0x53,0x69,0x7a,0x65,0x29,0x3b,0xa,0x23,0x69,0x66,0x20,0x4f,0x43,0x43,0x4c,
+  0x55,0x53,0x49,0x4f,0x4e,0x5f,0x50,0x41,0x53,0x53,0xa,0x9,0x9,0x9,0x2f,0x2f,
+  0x20,0x6f,0x6e,0x6c,0x79,0x20,0x74,0x68,0x65,0x20,0x6f,0x70,0x61,0x63,0x69,0x74,
+  0x79,0x20,0x69,0x73,0x20,0x6e,0x65,0x65,0x64,0x65,0x64,0x20,0x69,0x6e,0x20,0x74,
+  0x68,0x65,0x20,0x63,0x6f,0x61,0x72,0x73,0x65,0x20,0x70,0x61,0x73,0x73,0xa,0x9,
+  0x9,0x9,0x61,0x6c,0x70,0x68,0x61,0x20,0x2b,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,
+  0x2d,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x20,0x2a,0x20,0x73,0x61,0x6d,0x70,0x6c,
+  0x65,0x41,0x6c,0x70,0x68,0x61,0x3b,0xa,0x9,0x9,0x9,0x69,0x66,0x20,0x28,0x61,
+  0x6c,0x70,0x68,0x61,0x20,0x3e,0x3d,0x20,0x74,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,
+  0x69,0x6f,0x6e,0x54,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x29,0x20,0x7b,0xa,
+  0x9,0x9,0x9,0x9,0x6c,0x61,0x73,0x74,0x44,0x69,0x73,0x74,0x20,0x3d,0x20,0x6c,
+  0x65,0x6e,0x67,0x74,0x68,0x28,0x70,0x6f,0x73,0x20,0x2d,0x20,0x65,0x79,0x65,0x29,
+  0x3b,0xa,0x9,0x9,0x9,0x9,0x62,0x72,0x65,0x61,0x6b,0x3b,0xa,0x9,0x9,0x9,
+  0x7d,0xa,0x23,0x65,0x6c,0x73,0x65,0xa,0x9,0x9,0x9,0x66,0x6c,0x6f,0x61,0x74,
+  0x20,0x6c,0x61,0x70,0x68,0x61,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0xa,0x23,0x69,
+  0x66,0x20,0x50,0x52,0x45,0x43,0x4f,0x4d,0x50,0x55,0x54,0x45,0x44,0x5f,0x4c,0x49,
+  0x47,0x48,0x54,0xa,0x9,0x9,0x9,0x2f,0x2f,0x20,0x74,0x72,0x61,0x6e,0x73,0x6d,
+  0x69,0x74,0x74,0x61,0x6e,0x63,0x65,0x20,0x66,0x72,0x6f,0x6d,0x20,0x74,0x68,0x65,
+  0x20,0x6c,0x69,0x67,0x68,0x74,0x2c,0x20,0x70,0x72,0x65,0x63,0x6f,0x6d,0x70,0x75,
+  0x74,0x65,0x64,0x20,0x62,0x79,0x20,0x61,0x20,0x70,0x6c,0x61,0x6e,0x65,0x20,0x73,
+  0x77,0x65,0x65,0x70,0x20,0x6f,0x6e,0x20,0x74,0x68,0x65,0x20,0x43,0x50,0x55,0xa,
+  0x9,0x9,0x9,0x6c,0x61,0x70,0x68,0x61,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,
+  0x72,0x65,0x28,0x6c,0x69,0x67,0x68,0x74,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x2c,0x20,
+  0x70,0x6f,0x73,0x29,0x2e,0x78,0x3b,0xa,0x23,0x65,0x6c,0x69,0x66,0x20,0x21,0x53,
+  0x48,0x41,0x44,0x49,0x4e,0x47,0xa,0x9,0x9,0x9,0x2f,0x2f,0x67,0x65,0x74,0x20,
+  0x6c,0x69,0x67,0x68,0x74,0x73,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x6f,0x6e,0x20,
+  0x74,0x68,0x65,0x20,0x70,0x69,0x78,0x65,0x6c,0xa,0x9,0x9,0x9,0x76,0x65,0x63,
+  0x33,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x20,0x3d,0x20,0x6e,0x6f,0x72,
+  0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x2d,
+  0x70,0x6f,0x73,0x29,0x2a,0x6c,0x69,0x67,0x68,0x74,0x53,0x74,0x65,0x70,0x53,0x69,
+  0x7a,0x65,0x3b,0xa,0x9,0x9,0x9,0x76,0x65,0x63,0x33,0x20,0x6c,0x70,0x6f,0x73,
+  0x20,0x3d,0x20,0x70,0x6f,0x73,0x20,0x2b,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,
+  0x72,0x3b,0xa,0xa,0x9,0x9,0x9,0x2f,0x2f,0x67,0x65,0x74,0x20,0x61,0x6c,0x70,
+  0x68,0x61,0x20,0x6f,0x66,0x20,0x68,0x6f,0x77,0x20,0x6d,0x61,0x6e,0x79,0x20,0x6c,
+  0x69,0x67,0x68,0x74,0x20,0x63,0x61,0x6e,0x20,0x72,0x65,0x61,0x63,0x68,0x20,0x74,
+  0x68,0x65,0x20,0x70,0x69,0x78,0x65,0x6c,0xa,0x9,0x9,0x9,0x66,0x6f,0x72,0x20,
+  0x28,0x69,0x6e,0x74,0x20,0x73,0x3d,0x30,0x3b,0x20,0x73,0x20,0x3c,0x20,0x6c,0x69,
+  0x67,0x68,0x74,0x73,0x61,0x6d,0x70,0x6c,0x65,0x4e,0x75,0x6d,0x3b,0x20,0x2b,0x2b,
+  0x73,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,
+  0x64,0x65,0x6e,0x73,0x20,0x3d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,
+  0x73,0x69,0x74,0x79,0x28,0x6c,0x70,0x6f,0x73,0x29,0x3b,0xa,0x9,0x9,0x9,0x9,
+  0x53,0x54,0x41,0x54,0x28,0x73,0x74,0x61,0x74,0x4c,0x69,0x67,0x68,0x74,0x53,0x74,
+  0x65,0x70,0x73,0x2b,0x2b,0x3b,0x29,0xa,0x9,0x9,0x9,0x9,0x6c,0x61,0x70,0x68,
+  0x61,0x20,0x2a,0x3d,0x20,0x31,0x2e,0x30,0x2d,0x6c,0x69,0x67,0x68,0x74,0x41,0x62,
+  0x73,0x6f,0x72,0x70,0x74,0x69,0x6f,0x6e,0x2a,0x6c,0x69,0x67,0x68,0x74,0x53,0x74,
+  0x65,0x70,0x53,0x69,0x7a,0x65,0x2a,0x6c,0x64,0x65,0x6e,0x73,0x3b,0x20,0xa,0x9,
+  0x9,0x9,0x9,0x69,0x66,0x20,0x28,0x6c,0x61,0x70,0x68,0x61,0x20,0x3c,0x3d,0x20,
+  0x30,0x2e,0x30,0x31,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x9,0x9,0x62,0x72,0x65,
+  0x61,0x6b,0x3b,0xa,0x9,0x9,0x9,0x9,0x7d,0xa,0x9,0x9,0x9,0x9,0x6c,0x70,
+  0x6f,0x73,0x20,0x2b,0x3d,0x20,0x6c,0x69,0x67,0x68,0x74,0x44,0x69,0x72,0x3b,0xa,
+  0x9,0x9,0x9,0x7d,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x9,0x9,0x9,0x76,
+  0x65,0x63,0x33,0x20,0x66,0x69,0x6e,0x61,0x6c,0x6c,0x69,0x67,0x68,0x74,0x43,0x6f,
+  0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x31,0x30,0x2e,0x30,0x29,
+  0x20,0x2a,0x20,0x6c,0x61,0x70,0x68,0x61,0x3b,0xa,0x23,0x69,0x66,0x20,0x53,0x48,
+  0x41,0x44,0x49,0x4e,0x47,0xa,0x9,0x9,0x9,0x66,0x69,0x6e,0x61,0x6c,0x6c,0x69,
+  0x67,0x68,0x74,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x3d,0x20,0x73,0x68,0x61,0x64,
+  0x65,0x28,0x70,0x6f,0x73,0x2c,0x20,0x65,0x79,0x65,0x29,0x3b,0xa,0x23,0x65,0x6e,
+  0x64,0x69,0x66,0xa,0x23,0x69,0x66,0x20,0x41,0x4d,0x42,0x49,0x45,0x4e,0x54,0x5f,
+  0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,0xa,0x9,0x9,0x9,0x2f,0x2f,0x20,
+  0x66,0x72,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+  0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,0x74,0x68,
+  0x61,0x74,0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x65,
+  0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x69,0x67,0x68,0x62,0x6f,
+  0x72,0x68,0x6f,0x6f,0x64,0xa,0x9,0x9,0x9,0x66,0x69,0x6e,0x61,0x6c,0x6c,0x69,
+  0x67,0x68,0x74,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x3d,0x20,0x74,0x65,0x78,0x74,
+  0x75,0x72,0x65,0x28,0x6f,0x63,0x63,0x6c,0x75,0x73,0x69,0x6f,0x6e,0x56,0x6f,0x6c,
+  0x75,0x6d,0x65,0x2c,0x20,0x70,0x6f,0x73,0x29,0x2e,0x78,0x3b,0xa,0x23,0x65,0x6e,
+  0x64,0x69,0x66,0xa,0xa,0x9,0x9,0x9,0x2f,0x2f,0x20,0x66,0x72,0x6f,0x6e,0x74,
+  0x2d,0x74,0x6f,0x2d,0x62,0x61,0x63,0x6b,0x20,0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,
+  0x74,0x69,0x6e,0x67,0x20,0x77,0x69,0x74,0x68,0x20,0x74,0x68,0x65,0x20,0x63,0x6f,
+  0x6c,0x6f,0x72,0x20,0x70,0x72,0x65,0x6d,0x75,0x6c,0x74,0x69,0x70,0x6c,0x69,0x65,
+  0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,
+  0x2e,0xa,0x9,0x9,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x67,0x68,
+  0x74,0x20,0x69,0x73,0x20,0x65,0x6d,0x69,0x74,0x74,0x65,0x64,0x20,0x69,0x6e,0x20,
+  0x70,0x72,0x6f,0x70,0x6f,0x72,0x74,0x69,0x6f,0x6e,0x20,0x74,0x6f,0x20,0x74,0x68,
+  0x65,0x20,0x64,0x65,0x6e,0x73,0x69,0x74,0x79,0x2c,0x20,0x61,0x6e,0x64,0x20,0x73,
+  0x6f,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x61,0x62,0x73,0x6f,0x72,0x70,0x74,
+  0x69,0x6f,0x6e,0x2e,0xa,0x9,0x9,0x9,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2b,0x3d,
+  0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x61,0x6c,0x70,0x68,0x61,0x29,0x20,0x2a,
+  0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x41,0x6c,0x70,0x68,0x61,0x20,0x2a,0x20,0x66,
+  0x69,0x6e,0x61,0x6c,0x6c,0x69,0x67,0x68,0x74,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2f,
+  0x20,0x61,0x62,0x73,0x6f,0x72,0x62,0x52,0x61,0x74,0x65,0x3b,0xa,0x9,0x9,0x9,
+  0x61,0x6c,0x70,0x68,0x61,0x20,0x2b,0x3d,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,
+  0x61,0x6c,0x70,0x68,0x61,0x29,0x20,0x2a,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x41,
+  0x6c,0x70,0x68,0x61,0x3b,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x50,0x52,0x4f,0x4a,
+  0x45,0x43,0x54,0x49,0x4f,0x4e,0xa,0x9,0x9,0x9,0x69,0x66,0x20,0x28,0x21,0x68,
+  0x61,0x73,0x46,0x69,0x72,0x73,0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,0x29,0x20,0x7b,
+  0xa,0x9,0x9,0x9,0x9,0x66,0x69,0x72,0x73,0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,
+  0x20,0x3d,0x20,0x70,0x6f,0x73,0x3b,0xa,0x9,0x9,0x9,0x9,0x68,0x61,0x73,0x46,
+  0x69,0x72,0x73,0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,0x20,0x3d,0x20,0x74,0x72,0x75,
+  0x65,0x3b,0xa,0x9,0x9,0x9,0x7d,0xa,0x9,0x9,0x9,0x69,0x66,0x20,0x28,0x61,
+  0x6c,0x70,0x68,0x61,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x35,0x20,0x26,0x26,0x20,0x67,
+  0x6c,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x77,0x20,
+  0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x9,0x67,0x6c,
+  0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,
+  0x65,0x63,0x34,0x28,0x70,0x6f,0x73,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,
+  0x9,0x9,0x7d,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x9,0x9,0x9,0x69,0x66,
+  0x20,0x28,0x61,0x6c,0x70,0x68,0x61,0x20,0x3e,0x3d,0x20,0x74,0x65,0x72,0x6d,0x69,
+  0x6e,0x61,0x74,0x69,0x6f,0x6e,0x54,0x68,0x72,0x65,0x73,0x68,0x6f,0x6c,0x64,0x29,
+  0x20,0x7b,0xa,0x9,0x9,0x9,0x9,0x53,0x54,0x41,0x54,0x28,0x73,0x74,0x61,0x74,
+  0x54,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,
+  0x65,0x3b,0x29,0xa,0x9,0x9,0x9,0x9,0x62,0x72,0x65,0x61,0x6b,0x3b,0xa,0x9,
+  0x9,0x9,0x7d,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x9,0x9,0x7d,0xa,0x23,
+  0x65,0x6c,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,0x44,0x45,
+  0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x49,0x53,0x4f,0x52,0x41,
+  0x59,0x43,0x41,0x53,0x54,0xa,0x9,0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,
+  0x6e,0x73,0x20,0x3d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,0x6e,0x73,0x69,
+  0x74,0x79,0x28,0x70,0x6f,0x73,0x29,0x3b,0xa,0x9,0x9,0x53,0x54,0x41,0x54,0x28,
+  0x73,0x74,0x61,0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,0x73,0x2b,0x2b,0x3b,0x29,0xa,
+  0x9,0x9,0x69,0x66,0x20,0x28,0x64,0x65,0x6e,0x73,0x20,0x3e,0x3d,0x20,0x69,0x73,
+  0x6f,0x56,0x61,0x6c,0x75,0x65,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x2f,0x2f,0x20,
+  0x66,0x69,0x72,0x73,0x74,0x20,0x68,0x69,0x74,0x3a,0x20,0x72,0x65,0x66,0x69,0x6e,
+  0x65,0x20,0x69,0x74,0x2c,0x20,0x73,0x68,0x61,0x64,0x65,0x20,0x69,0x74,0x20,0x61,
+  0x6e,0x64,0x20,0x73,0x74,0x6f,0x70,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,
+  0x63,0x6f,0x6d,0x70,0x6f,0x73,0x69,0x74,0x69,0x6e,0x67,0xa,0x9,0x9,0x9,0x76,
+  0x65,0x63,0x33,0x20,0x68,0x69,0x74,0x20,0x3d,0x20,0x70,0x72,0x65,0x76,0x50,0x6f,
+  0x73,0x20,0x3d,0x3d,0x20,0x70,0x6f,0x73,0x20,0x3f,0x20,0x70,0x6f,0x73,0x20,0x3a,
+  0x20,0x72,0x65,0x66,0x69,0x6e,0x65,0x48,0x69,0x74,0x28,0x70,0x72,0x65,0x76,0x50,
+  0x6f,0x73,0x2c,0x20,0x70,0x72,0x65,0x76,0x44,0x65,0x6e,0x73,0x2c,0x20,0x70,0x6f,
+  0x73,0x2c,0x20,0x64,0x65,0x6e,0x73,0x29,0x3b,0xa,0x9,0x9,0x9,0x67,0x6c,0x46,
+  0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,
+  0x48,0x69,0x74,0x28,0x68,0x69,0x74,0x2c,0x20,0x65,0x79,0x65,0x29,0x3b,0xa,0x23,
+  0x69,0x66,0x20,0x52,0x45,0x50,0x52,0x4f,0x4a,0x45,0x43,0x54,0x49,0x4f,0x4e,0xa,
+  0x9,0x9,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+  0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x68,0x69,0x74,0x2c,0x20,0x31,0x2e,
+  0x30,0x29,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x9,0x9,0x9,0x53,0x54,
+  0x41,0x54,0x28,0x73,0x74,0x61,0x74,0x54,0x65,0x72,0x6d,0x69,0x6e,0x61,0x74,0x65,
+  0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x29,0xa,0x9,0x9,0x9,0x53,0x54,
+  0x41,0x54,0x28,0x77,0x72,0x69,0x74,0x65,0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,
+  0x63,0x73,0x28,0x29,0x3b,0x29,0xa,0x9,0x9,0x9,0x72,0x65,0x74,0x75,0x72,0x6e,
+  0x3b,0xa,0x9,0x9,0x7d,0xa,0xa,0x9,0x9,0x70,0x72,0x65,0x76,0x50,0x6f,0x73,
+  0x20,0x3d,0x20,0x70,0x6f,0x73,0x3b,0xa,0x9,0x9,0x70,0x72,0x65,0x76,0x44,0x65,
+  0x6e,0x73,0x20,0x3d,0x20,0x64,0x65,0x6e,0x73,0x3b,0xa,0x23,0x65,0x6c,0x73,0x65,
+  0xa,0x23,0x69,0x66,0x20,0x45,0x4d,0x50,0x54,0x59,0x5f,0x53,0x4b,0x49,0x50,0x50,
+  0x49,0x4e,0x47,0xa,0x9,0x9,0x2f,0x2f,0x20,0x73,0x6b,0x69,0x70,0x20,0x74,0x68,
+  0x65,0x20,0x62,0x72,0x69,0x63,0x6b,0x73,0x20,0x74,0x68,0x61,0x74,0x20,0x63,0x61,
+  0x6e,0x6e,0x6f,0x74,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x20,0x74,0x68,0x65,0x20,
+  0x72,0x65,0x73,0x75,0x6c,0x74,0xa,0x9,0x9,0x76,0x65,0x63,0x33,0x20,0x62,0x72,
+  0x69,0x63,0x6b,0x20,0x3d,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x66,0x6c,0x6f,0x6f,
+  0x72,0x28,0x28,0x70,0x6f,0x73,0x20,0x2a,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,
+  0x65,0x20,0x2d,0x20,0x30,0x2e,0x35,0x29,0x20,0x2f,0x20,0x62,0x72,0x69,0x63,0x6b,
+  0x53,0x69,0x7a,0x65,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x29,0x2c,0x20,
+  0x76,0x65,0x63,0x33,0x28,0x6e,0x75,0x6d,0x42,0x72,0x69,0x63,0x6b,0x73,0x20,0x2d,
+  0x20,0x31,0x29,0x29,0x3b,0xa,0x9,0x9,0x76,0x65,0x63,0x32,0x20,0x72,0x61,0x6e,
+  0x67,0x65,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,0x68,0x28,
+  0x6d,0x69,0x6e,0x4d,0x61,0x78,0x42,0x72,0x69,0x63,0x6b,0x73,0x2c,0x20,0x69,0x76,
+  0x65,0x63,0x33,0x28,0x62,0x72,0x69,0x63,0x6b,0x29,0x2c,0x20,0x30,0x29,0x2e,0x78,
+  0x79,0x3b,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,
+  0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x49,0x50,
+  0xa,0x9,0x9,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x6b,0x69,0x70,0x20,0x3d,0x20,0x72,
+  0x61,0x6e,0x67,0x65,0x2e,0x79,0x20,0x3c,0x3d,0x20,0x76,0x61,0x6c,0x75,0x65,0x3b,
+  0xa,0x23,0x65,0x6c,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,
+  0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x49,0x4e,
+  0x49,0x50,0xa,0x9,0x9,0x62,0x6f,0x6f,0x6c,0x20,0x73,0x6b,0x69,0x70,0x20,0x3d,
+  0x20,0x72,0x61,0x6e,0x67,0x65,0x2e,0x78,0x20,0x3e,0x3d,0x20,0x76,0x61,0x6c,0x75,
+  0x65,0x3b,0xa,0x23,0x65,0x6c,0x73,0x65,0xa,0x9,0x9,0x2f,0x2f,0x20,0x65,0x6d,
+  0x70,0x74,0x79,0x20,0x62,0x72,0x69,0x63,0x6b,0x73,0x20,0x6f,0x6e,0x6c,0x79,0x20,
+  0x61,0x64,0x64,0x20,0x7a,0x65,0x72,0x6f,0x73,0x20,0x74,0x6f,0x20,0x74,0x68,0x65,
+  0x20,0x61,0x76,0x65,0x72,0x61,0x67,0x65,0xa,0x9,0x9,0x62,0x6f,0x6f,0x6c,0x20,
+  0x73,0x6b,0x69,0x70,0x20,0x3d,0x20,0x72,0x61,0x6e,0x67,0x65,0x2e,0x79,0x20,0x3c,
+  0x3d,0x20,0x30,0x2e,0x30,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x9,0x9,
+  0x69,0x66,0x20,0x28,0x73,0x6b,0x69,0x70,0x29,0x20,0x7b,0xa,0x9,0x9,0x9,0x69,
+  0x6e,0x74,0x20,0x6e,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x73,0x74,0x65,0x70,0x73,
+  0x54,0x6f,0x4c,0x65,0x61,0x76,0x65,0x42,0x72,0x69,0x63,0x6b,0x28,0x70,0x6f,0x73,
+  0x2c,0x20,0x64,0x69,0x72,0x2c,0x20,0x62,0x72,0x69,0x63,0x6b,0x29,0x2c,0x20,0x6e,
+  0x75,0x6d,0x53,0x74,0x65,0x70,0x73,0x20,0x2d,0x20,0x69,0x29,0x3b,0xa,0x23,0x69,
+  0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,0x3d,
+  0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x41,0x56,0x45,0x52,0x41,0x47,0x45,0xa,
+  0x9,0x9,0x9,0x63,0x6f,0x75,0x6e,0x74,0x20,0x2b,0x3d,0x20,0x6e,0x3b,0xa,0x23,
+  0x65,0x6e,0x64,0x69,0x66,0xa,0x9,0x9,0x9,0x70,0x6f,0x73,0x20,0x2b,0x3d,0x20,
+  0x73,0x74,0x65,0x70,0x20,0x2a,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x6e,0x29,0x3b,
+  0xa,0x9,0x9,0x9,0x69,0x20,0x2b,0x3d,0x20,0x6e,0x20,0x2d,0x20,0x31,0x3b,0xa,
+  0x9,0x9,0x9,0x63,0x6f,0x6e,0x74,0x69,0x6e,0x75,0x65,0x3b,0xa,0x9,0x9,0x7d,
+  0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x9,0x9,0x66,0x6c,0x6f,0x61,0x74,
+  0x20,0x64,0x65,0x6e,0x73,0x20,0x3d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x44,0x65,
+  0x6e,0x73,0x69,0x74,0x79,0x28,0x70,0x6f,0x73,0x29,0x3b,0xa,0x9,0x9,0x53,0x54,
+  0x41,0x54,0x28,0x73,0x74,0x61,0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,0x73,0x2b,0x2b,
+  0x3b,0x29,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,
+  0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x49,0x50,
+  0xa,0x9,0x9,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x76,
+  0x61,0x6c,0x75,0x65,0x2c,0x20,0x64,0x65,0x6e,0x73,0x29,0x3b,0xa,0x23,0x65,0x6c,
+  0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,
+  0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x49,0x4e,0x49,0x50,0xa,0x9,
+  0x9,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x76,0x61,0x6c,
+  0x75,0x65,0x2c,0x20,0x64,0x65,0x6e,0x73,0x29,0x3b,0xa,0x23,0x65,0x6c,0x73,0x65,
+  0xa,0x9,0x9,0x74,0x6f,0x74,0x61,0x6c,0x20,0x2b,0x3d,0x20,0x64,0x65,0x6e,0x73,
+  0x3b,0xa,0x9,0x9,0x63,0x6f,0x75,0x6e,0x74,0x2b,0x2b,0x3b,0xa,0x23,0x65,0x6e,
+  0x64,0x69,0x66,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0xa,0x9,0x9,0x70,0x6f,
+  0x73,0x20,0x2b,0x3d,0x20,0x73,0x74,0x65,0x70,0x3b,0xa,0x9,0x7d,0xa,0xa,0x23,
+  0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,
+  0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x56,0x4f,0x4c,0x55,0x4d,0x45,0xa,
+  0x23,0x69,0x66,0x20,0x4f,0x43,0x43,0x4c,0x55,0x53,0x49,0x4f,0x4e,0x5f,0x50,0x41,
+  0x53,0x53,0xa,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+  0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x31,0x2e,0x30,0x2c,0x20,0x66,0x69,0x72,0x73,
+  0x74,0x44,0x69,0x73,0x74,0x2c,0x20,0x6c,0x61,0x73,0x74,0x44,0x69,0x73,0x74,0x2c,
+  0x20,0x30,0x2e,0x30,0x29,0x3b,0xa,0x23,0x65,0x6c,0x73,0x65,0xa,0x9,0x2f,0x2f,
+  0x20,0x74,0x68,0x65,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x69,0x73,0x20,0x70,0x72,
+  0x65,0x6d,0x75,0x6c,0x74,0x69,0x70,0x6c,0x69,0x65,0x64,0x2c,0x20,0x73,0x6f,0x20,
+  0x74,0x68,0x69,0x73,0x20,0x69,0x73,0x20,0x62,0x6c,0x65,0x6e,0x64,0x65,0x64,0x20,
+  0x77,0x69,0x74,0x68,0x20,0x47,0x4c,0x5f,0x4f,0x4e,0x45,0x2c,0x20,0x47,0x4c,0x5f,
+  0x4f,0x4e,0x45,0x5f,0x4d,0x49,0x4e,0x55,0x53,0x5f,0x53,0x52,0x43,0x5f,0x41,0x4c,
+  0x50,0x48,0x41,0xa,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
+  0x2e,0x72,0x67,0x62,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0xa,0x9,0x67,
+  0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x2e,0x61,0x20,0x3d,0x20,0x61,
+  0x6c,0x70,0x68,0x61,0x3b,0xa,0x23,0x65,0x6e,0x64,0x69,0x66,0xa,0x23,0x69,0x66,
+  0x20,0x52,0x45,0x50,0x52,0x4f,0x4a,0x45,0x43,0x54,0x49,0x4f,0x4e,0xa,0x9,0x69,
+  0x66,0x20,0x28,0x67,0x6c,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+  0x6e,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x20,0x26,0x26,0x20,0x68,0x61,
+  0x73,0x46,0x69,0x72,0x73,0x74,0x53,0x61,0x6d,0x70,0x6c,0x65,0x29,0x20,0x7b,0xa,
+  0x9,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+  0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x66,0x69,0x72,0x73,0x74,0x53,0x61,0x6d,
+  0x70,0x6c,0x65,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x7d,0xa,0x23,0x65,
+  0x6e,0x64,0x69,0x66,0xa,0x23,0x65,0x6c,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,
+  0x52,0x5f,0x4d,0x4f,0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,
+  0x5f,0x4d,0x49,0x50,0x20,0x7c,0x7c,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,
+  0x4f,0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x49,
+  0x4e,0x49,0x50,0x20,0x7c,0x7c,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x4d,0x4f,
+  0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x41,0x56,0x45,
+  0x52,0x41,0x47,0x45,0xa,0x23,0x69,0x66,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,
+  0x4d,0x4f,0x44,0x45,0x20,0x3d,0x3d,0x20,0x52,0x45,0x4e,0x44,0x45,0x52,0x5f,0x41,
+  0x56,0x45,0x52,0x41,0x47,0x45,0xa,0x9,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+  0x63,0x6f,0x75,0x6e,0x74,0x20,0x3e,0x20,0x30,0x20,0x3f,0x20,0x74,0x6f,0x74,0x61,
+  0x6c,0x20,0x2f,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x63,0x6f,0x75,0x6e,0x74,0x29,
+  0x20,0x3a,0x20,0x30,0x2e,0x30,0x3b,0xa,0x23,0x65,0x6c,0x73,0x65,0xa,0x9,0x69,
+  0x66,0x20,0x28,0x76,0x61,0x6c,0x75,0x65,0x20,0x3e,0x3d,0x20,0x31,0x65,0x32,0x30,
+  0x29,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0xa,0x23,
+  0x65,0x6e,0x64,0x69,0x66,0xa,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
+  0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x76,0x65,0x63,0x33,0x28,0x63,
+  0x6c,0x61,0x6d,0x70,0x28,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+  0x20,0x31,0x2e,0x30,0x29,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x23,0x65,
+  0x6e,0x64,0x69,0x66,0xa,0x9,0x53,0x54,0x41,0x54,0x28,0x77,0x72,0x69,0x74,0x65,
+  0x53,0x74,0x61,0x74,0x69,0x73,0x74,0x69,0x63,0x73,0x28,0x29,0x3b,0x29,0xa,0x7d,
+  0xa,
+  // C:/Users/VolumeRendering/VolumeRendering/shader/meshfs.glsl
+  0x0,0x0,0x3,0x79,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,
+  0xa,0xa,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x50,0x6f,0x73,0x69,0x74,
+  0x69,0x6f,0x6e,0x3b,0xa,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x4e,0x6f,
+  0x72,0x6d,0x61,0x6c,0x3b,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x67,
+  0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0xa,0xa,0x75,0x6e,0x69,
+  0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x33,0x20,0x67,0x72,0x69,0x64,0x53,0x69,
+  0x7a,0x65,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x33,
+  0x20,0x63,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x3b,0xa,0x75,0x6e,0x69,0x66,
+  0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,
+  0x73,0x3b,0xa,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x73,
+  0x75,0x72,0x66,0x61,0x63,0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,
+  0x63,0x33,0x28,0x30,0x2e,0x39,0x2c,0x20,0x30,0x2e,0x38,0x35,0x2c,0x20,0x30,0x2e,
+  0x37,0x35,0x29,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+  0x20,0x61,0x6d,0x62,0x69,0x65,0x6e,0x74,0x20,0x3d,0x20,0x30,0x2e,0x32,0x3b,0xa,
+  0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x66,0x66,
+  0x75,0x73,0x65,0x20,0x3d,0x20,0x30,0x2e,0x37,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,
+  0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,
+  0x3d,0x20,0x30,0x2e,0x33,0x3b,0xa,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+  0x61,0x74,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,0x73,0x20,0x3d,0x20,0x33,
+  0x32,0x2e,0x30,0x3b,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
+  0x29,0x20,0x7b,0xa,0x9,0x2f,0x2f,0x20,0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,
+  0x20,0x69,0x73,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x74,0x65,0x78,0x74,0x75,
+  0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0x73,0x2c,0x20,
+  0x73,0x6f,0x20,0x63,0x6f,0x6e,0x76,0x65,0x72,0x74,0x20,0x69,0x74,0x20,0x74,0x6f,
+  0x20,0x74,0x68,0x65,0x20,0x73,0x61,0x6d,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,
+  0x6e,0x61,0x74,0x65,0x73,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x20,0x6d,0x65,0x73,
+  0x68,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x6c,0x69,0x67,0x68,0x74,0x20,0x3d,0x20,
+  0x6c,0x69,0x67,0x68,0x74,0x50,0x6f,0x73,0x20,0x2a,0x20,0x67,0x72,0x69,0x64,0x53,
+  0x69,0x7a,0x65,0x20,0x2d,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x20,0x2a,
+  0x20,0x30,0x2e,0x35,0x3b,0xa,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x6e,0x20,0x3d,
+  0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x76,0x4e,0x6f,0x72,0x6d,
+  0x61,0x6c,0x29,0x3b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x6c,0x20,0x3d,0x20,0x6e,
+  0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x69,0x67,0x68,0x74,0x20,0x2d,
+  0x20,0x76,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0xa,0x9,0x76,0x65,
+  0x63,0x33,0x20,0x76,0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,
+  0x28,0x63,0x61,0x6d,0x65,0x72,0x61,0x50,0x6f,0x73,0x20,0x2d,0x20,0x76,0x50,0x6f,
+  0x73,0x69,0x74,0x69,0x6f,0x6e,0x29,0x3b,0xa,0x9,0x76,0x65,0x63,0x33,0x20,0x68,
+  0x20,0x3d,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x28,0x6c,0x20,0x2b,
+  0x20,0x76,0x29,0x3b,0xa,0xa,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x69,0x6e,
+  0x73,0x69,0x64,0x65,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x73,0x75,0x72,0x66,
+  0x61,0x63,0x65,0x20,0x69,0x73,0x20,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x20,0x74,
+  0x68,0x72,0x6f,0x75,0x67,0x68,0x20,0x74,0x68,0x65,0x20,0x63,0x6c,0x69,0x70,0x70,
+  0x65,0x64,0x20,0x62,0x6f,0x75,0x6e,0x64,0x61,0x72,0x79,0x2c,0x20,0x73,0x6f,0x20,
+  0x6c,0x69,0x67,0x68,0x74,0x20,0x62,0x6f,0x74,0x68,0x20,0x73,0x69,0x64,0x65,0x73,
+  0xa,0x9,0x69,0x66,0x20,0x28,0x64,0x6f,0x74,0x28,0x6e,0x2c,0x20,0x76,0x29,0x20,
+  0x3c,0x20,0x30,0x2e,0x30,0x29,0x20,0x6e,0x20,0x3d,0x20,0x2d,0x6e,0x3b,0xa,0xa,
+  0x9,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6c,0x69,0x74,0x20,0x3d,0x20,0x61,0x6d,0x62,
+  0x69,0x65,0x6e,0x74,0x20,0x2b,0x20,0x64,0x69,0x66,0x66,0x75,0x73,0x65,0x20,0x2a,
+  0x20,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x2c,0x20,0x6c,0x29,0x2c,0x20,
+  0x30,0x2e,0x30,0x29,0x3b,0xa,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,
+  0x6f,0x72,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x73,0x75,0x72,0x66,0x61,0x63,
+  0x65,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x2a,0x20,0x6c,0x69,0x74,0x20,0x2b,0x20,0x76,
+  0x65,0x63,0x33,0x28,0x73,0x70,0x65,0x63,0x75,0x6c,0x61,0x72,0x20,0x2a,0x20,0x70,
+  0x6f,0x77,0x28,0x6d,0x61,0x78,0x28,0x64,0x6f,0x74,0x28,0x6e,0x2c,0x20,0x68,0x29,
+  0x2c,0x20,0x30,0x2e,0x30,0x29,0x2c,0x20,0x73,0x68,0x69,0x6e,0x69,0x6e,0x65,0x73,
+  0x73,0x29,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x7d,0xa,
+  // C:/Users/VolumeRendering/VolumeRendering/shader/meshvs.glsl
+  0x0,0x0,0x1,0x46,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,
+  0xa,0xa,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+  0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x67,
+  0x6c,0x56,0x65,0x72,0x74,0x65,0x78,0x3b,0xa,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+  0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,
+  0x20,0x76,0x65,0x63,0x33,0x20,0x67,0x6c,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0xa,
+  0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x50,0x6f,0x73,0x69,0x74,0x69,
+  0x6f,0x6e,0x3b,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x33,0x20,0x76,0x4e,0x6f,
+  0x72,0x6d,0x61,0x6c,0x3b,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x6d,
+  0x61,0x74,0x34,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x76,0x69,0x65,0x77,0x4d,0x61,0x74,
+  0x72,0x69,0x78,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x6d,0x61,0x74,
+  0x34,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,0x74,0x72,
+  0x69,0x78,0x3b,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+  0x20,0x7b,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+  0x3d,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,0x74,0x72,
+  0x69,0x78,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x76,0x69,0x65,0x77,0x4d,0x61,
+  0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x67,0x6c,0x56,0x65,
+  0x72,0x74,0x65,0x78,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x76,0x50,0x6f,
+  0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x56,0x65,0x72,0x74,0x65,
+  0x78,0x3b,0xa,0x9,0x76,0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x3d,0x20,0x67,0x6c,
+  0x4e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0xa,0x7d,0xa,
+  // C:/Users/VolumeRendering/VolumeRendering/shader/quadvs.glsl
+  0x0,0x0,0x0,0xe3,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,
+  0xa,0xa,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x67,0x6c,0x56,0x65,0x72,0x74,
+  0x65,0x78,0x3b,0xa,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x54,0x65,
+  0x78,0x43,0x6f,0x6f,0x72,0x64,0x3b,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+  0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x71,
+  0x75,0x61,0x64,0x20,0x63,0x6f,0x76,0x65,0x72,0x73,0x20,0x74,0x68,0x65,0x20,0x77,
+  0x68,0x6f,0x6c,0x65,0x20,0x76,0x69,0x65,0x77,0x70,0x6f,0x72,0x74,0x20,0x69,0x6e,
+  0x20,0x74,0x68,0x65,0x20,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x69,0x7a,0x65,0x64,0x20,
+  0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,
+  0x65,0x73,0xa,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+  0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x67,0x6c,0x56,0x65,0x72,0x74,0x65,0x78,0x2e,
+  0x78,0x79,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,
+  0x76,0x54,0x65,0x78,0x43,0x6f,0x6f,0x72,0x64,0x20,0x3d,0x20,0x67,0x6c,0x56,0x65,
+  0x72,0x74,0x65,0x78,0x2e,0x78,0x79,0x20,0x2a,0x20,0x30,0x2e,0x35,0x20,0x2b,0x20,
+  0x30,0x2e,0x35,0x3b,0xa,0x7d,0xa,
+  // C:/Users/VolumeRendering/VolumeRendering/shader/reprojectvs.glsl
+  0x0,0x0,0x4,0x60,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,
+  0xa,0xa,0x2f,0x2f,0x20,0x73,0x63,0x61,0x74,0x74,0x65,0x72,0x73,0x20,0x65,0x61,
+  0x63,0x68,0x20,0x70,0x69,0x78,0x65,0x6c,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,
+  0x70,0x72,0x65,0x76,0x69,0x6f,0x75,0x73,0x20,0x66,0x72,0x61,0x6d,0x65,0x20,0x74,
+  0x6f,0x20,0x74,0x68,0x65,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x6f,
+  0x66,0x20,0x69,0x74,0x73,0x20,0x66,0x69,0x72,0x73,0x74,0x20,0x73,0x69,0x67,0x6e,
+  0x69,0x66,0x69,0x63,0x61,0x6e,0x74,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0xa,0x2f,
+  0x2f,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,
+  0x20,0x76,0x69,0x65,0x77,0x2e,0x20,0x6f,0x6e,0x65,0x20,0x70,0x6f,0x69,0x6e,0x74,
+  0x20,0x69,0x73,0x20,0x64,0x72,0x61,0x77,0x6e,0x20,0x70,0x65,0x72,0x20,0x70,0x69,
+  0x78,0x65,0x6c,0x2c,0x20,0x61,0x6e,0x64,0x20,0x74,0x68,0x65,0x20,0x70,0x69,0x78,
+  0x65,0x6c,0x20,0x69,0x73,0x20,0x66,0x6f,0x75,0x6e,0x64,0x20,0x66,0x72,0x6f,0x6d,
+  0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x2e,0xa,0x6f,0x75,
+  0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0xa,0x6f,
+  0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+  0x6e,0x3b,0xa,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,
+  0x6c,0x65,0x72,0x32,0x44,0x20,0x70,0x72,0x65,0x76,0x69,0x6f,0x75,0x73,0x43,0x6f,
+  0x6c,0x6f,0x72,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,
+  0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x70,0x72,0x65,0x76,0x69,0x6f,0x75,0x73,0x50,
+  0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+  0x20,0x6d,0x61,0x74,0x34,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x76,0x69,0x65,0x77,0x4d,
+  0x61,0x74,0x72,0x69,0x78,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x6d,
+  0x61,0x74,0x34,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,
+  0x74,0x72,0x69,0x78,0x3b,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,
+  0x63,0x33,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,0x65,0x3b,0xa,0xa,0x2f,0x2f,
+  0x20,0x70,0x69,0x78,0x65,0x6c,0x73,0x20,0x74,0x68,0x61,0x74,0x20,0x68,0x61,0x76,
+  0x65,0x20,0x62,0x65,0x65,0x6e,0x20,0x72,0x65,0x75,0x73,0x65,0x64,0x20,0x74,0x68,
+  0x69,0x73,0x20,0x6d,0x61,0x6e,0x79,0x20,0x74,0x69,0x6d,0x65,0x73,0x20,0x61,0x72,
+  0x65,0x20,0x74,0x72,0x61,0x63,0x65,0x64,0x20,0x61,0x67,0x61,0x69,0x6e,0x2c,0x20,
+  0x73,0x6f,0x20,0x74,0x68,0x61,0x74,0x20,0x74,0x68,0x65,0x20,0x65,0x72,0x72,0x6f,
+  0x72,0x73,0x20,0x64,0x6f,0x20,0x6e,0x6f,0x74,0x20,0x70,0x69,0x6c,0x65,0x20,0x75,
+  0x70,0xa,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+  0x6d,0x61,0x78,0x41,0x67,0x65,0x3b,0xa,0xa,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+  0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,0x9,0x69,0x76,0x65,0x63,0x32,0x20,0x73,0x69,
+  0x7a,0x65,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x53,0x69,0x7a,0x65,
+  0x28,0x70,0x72,0x65,0x76,0x69,0x6f,0x75,0x73,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+  0x6e,0x2c,0x20,0x30,0x29,0x3b,0xa,0x9,0x69,0x76,0x65,0x63,0x32,0x20,0x70,0x69,
+  0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x67,0x6c,0x5f,0x56,
+  0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x25,0x20,0x73,0x69,0x7a,0x65,0x2e,0x78,
+  0x2c,0x20,0x67,0x6c,0x5f,0x56,0x65,0x72,0x74,0x65,0x78,0x49,0x44,0x20,0x2f,0x20,
+  0x73,0x69,0x7a,0x65,0x2e,0x78,0x29,0x3b,0xa,0xa,0x9,0x76,0x50,0x6f,0x73,0x69,
+  0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,0x74,0x63,
+  0x68,0x28,0x70,0x72,0x65,0x76,0x69,0x6f,0x75,0x73,0x50,0x6f,0x73,0x69,0x74,0x69,
+  0x6f,0x6e,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x3b,0xa,0x9,
+  0x76,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x46,0x65,
+  0x74,0x63,0x68,0x28,0x70,0x72,0x65,0x76,0x69,0x6f,0x75,0x73,0x43,0x6f,0x6c,0x6f,
+  0x72,0x2c,0x20,0x70,0x69,0x78,0x65,0x6c,0x2c,0x20,0x30,0x29,0x3b,0xa,0xa,0x9,
+  0x69,0x66,0x20,0x28,0x76,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x77,0x20,
+  0x3d,0x3d,0x20,0x30,0x2e,0x30,0x20,0x7c,0x7c,0x20,0x76,0x50,0x6f,0x73,0x69,0x74,
+  0x69,0x6f,0x6e,0x2e,0x77,0x20,0x3e,0x3d,0x20,0x6d,0x61,0x78,0x41,0x67,0x65,0x29,
+  0x20,0x7b,0xa,0x9,0x9,0x2f,0x2f,0x20,0x6f,0x75,0x74,0x73,0x69,0x64,0x65,0x20,
+  0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x63,0x6c,0x69,0x70,0x20,0x76,0x6f,0x6c,0x75,
+  0x6d,0x65,0x2c,0x20,0x73,0x6f,0x20,0x74,0x68,0x65,0x20,0x70,0x6f,0x69,0x6e,0x74,
+  0x20,0x69,0x73,0x20,0x6e,0x6f,0x74,0x20,0x64,0x72,0x61,0x77,0x6e,0xa,0x9,0x9,
+  0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,
+  0x63,0x34,0x28,0x32,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,
+  0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,
+  0x7b,0xa,0x9,0x9,0x2f,0x2f,0x20,0x74,0x68,0x65,0x20,0x70,0x6f,0x73,0x69,0x74,
+  0x69,0x6f,0x6e,0x20,0x69,0x73,0x20,0x69,0x6e,0x20,0x74,0x68,0x65,0x20,0x74,0x65,
+  0x78,0x74,0x75,0x72,0x65,0x20,0x63,0x6f,0x6f,0x72,0x64,0x69,0x6e,0x61,0x74,0x65,
+  0x73,0x2c,0x20,0x73,0x6f,0x20,0x63,0x6f,0x6e,0x76,0x65,0x72,0x74,0x20,0x69,0x74,
+  0x20,0x74,0x6f,0x20,0x74,0x68,0x65,0x20,0x73,0x61,0x6d,0x65,0x20,0x63,0x6f,0x6f,
+  0x72,0x64,0x69,0x6e,0x61,0x74,0x65,0x73,0x20,0x61,0x73,0x20,0x74,0x68,0x65,0x20,
+  0x62,0x6f,0x78,0xa,0x9,0x9,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+  0x6e,0x20,0x3d,0x20,0x70,0x72,0x6f,0x6a,0x65,0x63,0x74,0x69,0x6f,0x6e,0x4d,0x61,
+  0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x6d,0x6f,0x64,0x65,0x6c,0x76,0x69,0x65,0x77,
+  0x4d,0x61,0x74,0x72,0x69,0x78,0x20,0x2a,0x20,0x76,0x65,0x63,0x34,0x28,0x76,0x50,
+  0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x67,0x72,
+  0x69,0x64,0x53,0x69,0x7a,0x65,0x20,0x2d,0x20,0x67,0x72,0x69,0x64,0x53,0x69,0x7a,
+  0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0xa,0x9,
+  0x7d,0xa,0x7d,0xa,
+  // C:/Users/VolumeRendering/VolumeRendering/shader/reprojectfs.glsl
+  0x0,0x0,0x0,0xfd,0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,
+  0xa,0xa,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x43,0x6f,0x6c,0x6f,0x72,
+  0x3b,0xa,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x50,0x6f,0x73,0x69,0x74,
+  0x69,0x6f,0x6e,0x3b,0xa,0xa,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+  0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
+  0x65,0x63,0x34,0x20,0x67,0x6c,0x46,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,
+  0xa,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+  0x20,0x3d,0x20,0x31,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x67,
+  0x6c,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0xa,0xa,
+  0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x20,0x7b,0xa,0x9,0x2f,
+  0x2f,0x20,0x74,0x68,0x65,0x20,0x6e,0x65,0x61,0x72,0x65,0x73,0x74,0x20,0x70,0x6f,
+  0x69,0x6e,0x74,0x20,0x77,0x69,0x6e,0x73,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,
+  0x64,0x65,0x70,0x74,0x68,0x20,0x74,0x65,0x73,0x74,0xa,0x9,0x67,0x6c,0x46,0x72,
+  0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x76,0x43,0x6f,0x6c,0x6f,0x72,
+  0x3b,0xa,0x9,0x67,0x6c,0x46,0x72,0x61,0x67,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+  0x6e,0x20,0x3d,0x20,0x76,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0xa,0x7d,
+  0xa,
+};
+
+static const unsigned char qt_resource_name[] = {
+  // shader
+  0x0,0x6,0x7,0x9e,0x7a,0xc2,0x0,0x73,0x0,0x68,0x0,0x61,0x0,0x64,0x0,0x65,
+  0x0,0x72,
+  // accumulatefs.glsl
+  0x0,0x11,0x4,0x7f,0xdd,0xfc,0x0,0x61,0x0,0x63,0x0,0x63,0x0,0x75,0x0,0x6d,
+  0x0,0x75,0x0,0x6c,0x0,0x61,0x0,0x74,0x0,0x65,0x0,0x66,0x0,0x73,0x0,0x2e,
+  0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
+  // heatmapfs.glsl
+  0x0,0xe,0xa,0x72,0xc8,0xfc,0x0,0x68,0x0,0x65,0x0,0x61,0x0,0x74,0x0,0x6d,
+  0x0,0x61,0x0,0x70,0x0,0x66,0x0,0x73,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,
+  0x0,0x6c,
+  // raycastvs.glsl
+  0x0,0xe,0xc,0xd7,0xe8,0xdc,0x0,0x72,0x0,0x61,0x0,0x79,0x0,0x63,0x0,0x61,
+  0x0,0x73,0x0,0x74,0x0,0x76,0x0,0x73,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,
+  0x0,0x6c,
+  // raycastfs.glsl
+  0x0,0xe,0xc,0xd7,0xe8,0xfc,0x0,0x72,0x0,0x61,0x0,0x79,0x0,0x63,0x0,0x61,
+  0x0,0x73,0x0,0x74,0x0,0x66,0x0,0x73,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,
+  0x0,0x6c,
+  // meshfs.glsl
+  0x0,0xb,0xd,0xc3,0x70,0x5c,0x0,0x6d,0x0,0x65,0x0,0x73,0x0,0x68,0x0,0x66,
+  0x0,0x73,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
+  // meshvs.glsl
+  0x0,0xb,0xd,0xc3,0x70,0x7c,0x0,0x6d,0x0,0x65,0x0,0x73,0x0,0x68,0x0,0x76,
+  0x0,0x73,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
+  // quadvs.glsl
+  0x0,0xb,0xd,0xd5,0xcc,0xfc,0x0,0x71,0x0,0x75,0x0,0x61,0x0,0x64,0x0,0x76,
+  0x0,0x73,0x0,0x2e,0x0,0x67,0x0,0x6c,0x0,0x73,0x0,0x6c,
+  // reprojectvs.glsl
+  0x0,0x10,0xf,0xbb,0xa7,0x1c,0x0,0x72,0x0,0x65,0x0,0x70,0x0,0x72,0x0,0x6f,
+  0x0,0x6a,0x0,0x65,0x0,0x63,0x0,0x74,0x0,0x76,0x0,0x73,0x0,0x2e,0x0,0x67,
+  0x0,0x6c,0x0,0x73,0x0,0x6c,
+  // reprojectfs.glsl
+  0x0,0x10,0xf,0xbb,0xa7,0x3c,0x0,0x72,0x0,0x65,0x0,0x70,0x0,0x72,0x0,0x6f,
+  0x0,0x6a,0x0,0x65,0x0,0x63,0x0,0x74,0x0,0x66,0x0,0x73,0x0,0x2e,0x0,0x67,
+  0x0,0x6c,0x0,0x73,0x0,0x6c,
+};
+
+static const unsigned char qt_resource_struct[] = {
+  // /
+  0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,
+  // shader
+  0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x2,
+  // accumulatefs.glsl
+  0x0,0x0,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,
+  // heatmapfs.glsl
+  0x0,0x0,0x0,0x3a,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x1,0x38,
+  // raycastvs.glsl
+  0x0,0x0,0x0,0x5c,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x4,0x36,
+  // raycastfs.glsl
+  0x0,0x0,0x0,0x7e,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x5,0x20,
+  // meshfs.glsl
+  0x0,0x0,0x0,0xa0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x56,0xf1,
+  // meshvs.glsl
+  0x0,0x0,0x0,0xbc,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x5a,0x6e,
+  // quadvs.glsl
+  0x0,0x0,0x0,0xd8,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x5b,0xb8,
+  // reprojectvs.glsl
+  0x0,0x0,0x0,0xf4,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x5c,0x9f,
+  // reprojectfs.glsl
+  0x0,0x0,0x1,0x1a,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x61,0x3,
+};
+
 QT_BEGIN_NAMESPACE
 
+extern Q_CORE_EXPORT bool qRegisterResourceData
+    (int, const unsigned char *, const unsigned char *, const unsigned char *);
+
+extern Q_CORE_EXPORT bool qUnregisterResourceData
+    (int, const unsigned char *, const unsigned char *, const unsigned char *);
+
 QT_END_NAMESPACE
 
 
 int QT_MANGLE_NAMESPACE(qInitResources_MainWindow)()
 {
+    QT_PREPEND_NAMESPACE(qRegisterResourceData)
+        (0x01, qt_resource_struct, qt_resource_name, qt_resource_data);
     return 1;
 }
 
@@ -23,6 +1680,8 @@ Q_CONSTRUCTOR_FUNCTION(QT_MANGLE_NAMESPACE(qInitResources_MainWindow))
 
 int QT_MANGLE_NAMESPACE(qCleanupResources_MainWindow)()
 {
+    QT_PREPEND_NAMESPACE(qUnregisterResourceData)
+       (0x01, qt_resource_struct, qt_resource_name, qt_resource_data);
     return 1;
 }
 
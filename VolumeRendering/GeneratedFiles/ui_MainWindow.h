@@ -29,9 +29,42 @@ class Ui_MainWindowClass
 public:
     QAction *actionExit;
     QAction *actionOpen;
+    QAction *actionCompressVolume;
+    QAction *actionOpenSequence;
+    QAction *actionPlay;
+    QAction *actionDeltaPlayback;
+    QAction *actionSparseVolume;
+    QAction *actionShading;
+    QAction *actionPrecomputedLight;
+    QAction *actionAmbientOcclusion;
+    QAction *actionVolumeMode;
+    QAction *actionIsosurfaceMode;
+    QAction *actionIsoValue;
+    QAction *actionIsoRaycastMode;
+    QAction *actionMipMode;
+    QAction *actionMinipMode;
+    QAction *actionAverageMode;
+    QAction *actionProfiling;
+    QAction *actionSaveProfileTrace;
+    QAction *actionRayStatistics;
+    QAction *actionProgressive;
+    QAction *actionReprojection;
+    QAction *actionTerminationThreshold;
+    QAction *actionOcclusionCulling;
+    QAction *actionSaveScreenshot;
+    QAction *actionRecord;
+    QAction *actionAddKeyframe;
+    QAction *actionClearKeyframes;
+    QAction *actionLoadCameraPath;
+    QAction *actionSaveCameraPath;
+    QAction *actionRenderSequence;
     QWidget *centralWidget;
     QMenuBar *menuBar;
     QMenu *menuFile;
+    QMenu *menuOptions;
+    QMenu *menuRender;
+    QMenu *menuPlayback;
+    QMenu *menuAnimation;
     QToolBar *mainToolBar;
     QStatusBar *statusBar;
 
@@ -44,6 +77,84 @@ public:
         actionExit->setObjectName(QString::fromUtf8("actionExit"));
         actionOpen = new QAction(MainWindowClass);
         actionOpen->setObjectName(QString::fromUtf8("actionOpen"));
+        actionCompressVolume = new QAction(MainWindowClass);
+        actionCompressVolume->setObjectName(QString::fromUtf8("actionCompressVolume"));
+        actionCompressVolume->setCheckable(true);
+        actionOpenSequence = new QAction(MainWindowClass);
+        actionOpenSequence->setObjectName(QString::fromUtf8("actionOpenSequence"));
+        actionPlay = new QAction(MainWindowClass);
+        actionPlay->setObjectName(QString::fromUtf8("actionPlay"));
+        actionPlay->setCheckable(true);
+        actionDeltaPlayback = new QAction(MainWindowClass);
+        actionDeltaPlayback->setObjectName(QString::fromUtf8("actionDeltaPlayback"));
+        actionDeltaPlayback->setCheckable(true);
+        actionSparseVolume = new QAction(MainWindowClass);
+        actionSparseVolume->setObjectName(QString::fromUtf8("actionSparseVolume"));
+        actionSparseVolume->setCheckable(true);
+        actionShading = new QAction(MainWindowClass);
+        actionShading->setObjectName(QString::fromUtf8("actionShading"));
+        actionShading->setCheckable(true);
+        actionPrecomputedLight = new QAction(MainWindowClass);
+        actionPrecomputedLight->setObjectName(QString::fromUtf8("actionPrecomputedLight"));
+        actionPrecomputedLight->setCheckable(true);
+        actionAmbientOcclusion = new QAction(MainWindowClass);
+        actionAmbientOcclusion->setObjectName(QString::fromUtf8("actionAmbientOcclusion"));
+        actionAmbientOcclusion->setCheckable(true);
+        actionVolumeMode = new QAction(MainWindowClass);
+        actionVolumeMode->setObjectName(QString::fromUtf8("actionVolumeMode"));
+        actionVolumeMode->setCheckable(true);
+        actionVolumeMode->setChecked(true);
+        actionIsosurfaceMode = new QAction(MainWindowClass);
+        actionIsosurfaceMode->setObjectName(QString::fromUtf8("actionIsosurfaceMode"));
+        actionIsosurfaceMode->setCheckable(true);
+        actionIsoValue = new QAction(MainWindowClass);
+        actionIsoValue->setObjectName(QString::fromUtf8("actionIsoValue"));
+        actionIsoRaycastMode = new QAction(MainWindowClass);
+        actionIsoRaycastMode->setObjectName(QString::fromUtf8("actionIsoRaycastMode"));
+        actionIsoRaycastMode->setCheckable(true);
+        actionMipMode = new QAction(MainWindowClass);
+        actionMipMode->setObjectName(QString::fromUtf8("actionMipMode"));
+        actionMipMode->setCheckable(true);
+        actionMinipMode = new QAction(MainWindowClass);
+        actionMinipMode->setObjectName(QString::fromUtf8("actionMinipMode"));
+        actionMinipMode->setCheckable(true);
+        actionAverageMode = new QAction(MainWindowClass);
+        actionAverageMode->setObjectName(QString::fromUtf8("actionAverageMode"));
+        actionAverageMode->setCheckable(true);
+        actionProfiling = new QAction(MainWindowClass);
+        actionProfiling->setObjectName(QString::fromUtf8("actionProfiling"));
+        actionProfiling->setCheckable(true);
+        actionSaveProfileTrace = new QAction(MainWindowClass);
+        actionSaveProfileTrace->setObjectName(QString::fromUtf8("actionSaveProfileTrace"));
+        actionRayStatistics = new QAction(MainWindowClass);
+        actionRayStatistics->setObjectName(QString::fromUtf8("actionRayStatistics"));
+        actionRayStatistics->setCheckable(true);
+        actionProgressive = new QAction(MainWindowClass);
+        actionProgressive->setObjectName(QString::fromUtf8("actionProgressive"));
+        actionProgressive->setCheckable(true);
+        actionReprojection = new QAction(MainWindowClass);
+        actionReprojection->setObjectName(QString::fromUtf8("actionReprojection"));
+        actionReprojection->setCheckable(true);
+        actionTerminationThreshold = new QAction(MainWindowClass);
+        actionTerminationThreshold->setObjectName(QString::fromUtf8("actionTerminationThreshold"));
+        actionOcclusionCulling = new QAction(MainWindowClass);
+        actionOcclusionCulling->setObjectName(QString::fromUtf8("actionOcclusionCulling"));
+        actionOcclusionCulling->setCheckable(true);
+        actionSaveScreenshot = new QAction(MainWindowClass);
+        actionSaveScreenshot->setObjectName(QString::fromUtf8("actionSaveScreenshot"));
+        actionRecord = new QAction(MainWindowClass);
+        actionRecord->setObjectName(QString::fromUtf8("actionRecord"));
+        actionRecord->setCheckable(true);
+        actionAddKeyframe = new QAction(MainWindowClass);
+        actionAddKeyframe->setObjectName(QString::fromUtf8("actionAddKeyframe"));
+        actionClearKeyframes = new QAction(MainWindowClass);
+        actionClearKeyframes->setObjectName(QString::fromUtf8("actionClearKeyframes"));
+        actionLoadCameraPath = new QAction(MainWindowClass);
+        actionLoadCameraPath->setObjectName(QString::fromUtf8("actionLoadCameraPath"));
+        actionSaveCameraPath = new QAction(MainWindowClass);
+        actionSaveCameraPath->setObjectName(QString::fromUtf8("actionSaveCameraPath"));
+        actionRenderSequence = new QAction(MainWindowClass);
+        actionRenderSequence->setObjectName(QString::fromUtf8("actionRenderSequence"));
         centralWidget = new QWidget(MainWindowClass);
         centralWidget->setObjectName(QString::fromUtf8("centralWidget"));
         MainWindowClass->setCentralWidget(centralWidget);
@@ -52,6 +163,14 @@ public:
         menuBar->setGeometry(QRect(0, 0, 600, 21));
         menuFile = new QMenu(menuBar);
         menuFile->setObjectName(QString::fromUtf8("menuFile"));
+        menuOptions = new QMenu(menuBar);
+        menuOptions->setObjectName(QString::fromUtf8("menuOptions"));
+        menuRender = new QMenu(menuBar);
+        menuRender->setObjectName(QString::fromUtf8("menuRender"));
+        menuPlayback = new QMenu(menuBar);
+        menuPlayback->setObjectName(QString::fromUtf8("menuPlayback"));
+        menuAnimation = new QMenu(menuBar);
+        menuAnimation->setObjectName(QString::fromUtf8("menuAnimation"));
         MainWindowClass->setMenuBar(menuBar);
         mainToolBar = new QToolBar(MainWindowClass);
         mainToolBar->setObjectName(QString::fromUtf8("mainToolBar"));
@@ -61,9 +180,50 @@ public:
         MainWindowClass->setStatusBar(statusBar);
 
         menuBar->addAction(menuFile->menuAction());
+        menuBar->addAction(menuOptions->menuAction());
+        menuBar->addAction(menuRender->menuAction());
+        menuBar->addAction(menuPlayback->menuAction());
+        menuBar->addAction(menuAnimation->menuAction());
         menuFile->addAction(actionOpen);
+        menuFile->addAction(actionOpenSequence);
+        menuFile->addSeparator();
+        menuFile->addAction(actionSaveScreenshot);
+        menuFile->addAction(actionRecord);
         menuFile->addSeparator();
         menuFile->addAction(actionExit);
+        menuOptions->addAction(actionCompressVolume);
+        menuOptions->addAction(actionSparseVolume);
+        menuOptions->addSeparator();
+        menuOptions->addAction(actionShading);
+        menuOptions->addAction(actionPrecomputedLight);
+        menuOptions->addAction(actionAmbientOcclusion);
+        menuOptions->addSeparator();
+        menuOptions->addAction(actionProfiling);
+        menuOptions->addAction(actionSaveProfileTrace);
+        menuPlayback->addAction(actionPlay);
+        menuPlayback->addSeparator();
+        menuPlayback->addAction(actionDeltaPlayback);
+        menuRender->addAction(actionVolumeMode);
+        menuRender->addAction(actionIsosurfaceMode);
+        menuRender->addAction(actionIsoRaycastMode);
+        menuRender->addAction(actionMipMode);
+        menuRender->addAction(actionMinipMode);
+        menuRender->addAction(actionAverageMode);
+        menuRender->addSeparator();
+        menuRender->addAction(actionIsoValue);
+        menuRender->addAction(actionTerminationThreshold);
+        menuRender->addSeparator();
+        menuRender->addAction(actionRayStatistics);
+        menuRender->addAction(actionProgressive);
+        menuRender->addAction(actionReprojection);
+        menuRender->addAction(actionOcclusionCulling);
+        menuAnimation->addAction(actionAddKeyframe);
+        menuAnimation->addAction(actionClearKeyframes);
+        menuAnimation->addSeparator();
+        menuAnimation->addAction(actionLoadCameraPath);
+        menuAnimation->addAction(actionSaveCameraPath);
+        menuAnimation->addSeparator();
+        menuAnimation->addAction(actionRenderSequence);
 
         retranslateUi(MainWindowClass);
 
@@ -75,7 +235,40 @@ public:
         MainWindowClass->setWindowTitle(QApplication::translate("MainWindowClass", "MainWindow", 0, QApplication::UnicodeUTF8));
         actionExit->setText(QApplication::translate("MainWindowClass", "Exit", 0, QApplication::UnicodeUTF8));
         actionOpen->setText(QApplication::translate("MainWindowClass", "Open", 0, QApplication::UnicodeUTF8));
+        actionCompressVolume->setText(QApplication::translate("MainWindowClass", "Compress Volume (BC4)", 0, QApplication::UnicodeUTF8));
+        actionOpenSequence->setText(QApplication::translate("MainWindowClass", "Open Sequence...", 0, QApplication::UnicodeUTF8));
+        actionPlay->setText(QApplication::translate("MainWindowClass", "Play", 0, QApplication::UnicodeUTF8));
+        actionDeltaPlayback->setText(QApplication::translate("MainWindowClass", "Delta-Encoded Frames", 0, QApplication::UnicodeUTF8));
+        actionSparseVolume->setText(QApplication::translate("MainWindowClass", "Sparse Volume", 0, QApplication::UnicodeUTF8));
+        actionShading->setText(QApplication::translate("MainWindowClass", "Gradient Shading", 0, QApplication::UnicodeUTF8));
+        actionPrecomputedLight->setText(QApplication::translate("MainWindowClass", "Precomputed Light", 0, QApplication::UnicodeUTF8));
+        actionAmbientOcclusion->setText(QApplication::translate("MainWindowClass", "Ambient Occlusion", 0, QApplication::UnicodeUTF8));
+        actionVolumeMode->setText(QApplication::translate("MainWindowClass", "Volume Rendering", 0, QApplication::UnicodeUTF8));
+        actionIsosurfaceMode->setText(QApplication::translate("MainWindowClass", "Isosurface (Mesh)", 0, QApplication::UnicodeUTF8));
+        actionIsoValue->setText(QApplication::translate("MainWindowClass", "Iso Value...", 0, QApplication::UnicodeUTF8));
+        actionIsoRaycastMode->setText(QApplication::translate("MainWindowClass", "Isosurface (Ray Casting)", 0, QApplication::UnicodeUTF8));
+        actionMipMode->setText(QApplication::translate("MainWindowClass", "Maximum Intensity Projection", 0, QApplication::UnicodeUTF8));
+        actionMinipMode->setText(QApplication::translate("MainWindowClass", "Minimum Intensity Projection", 0, QApplication::UnicodeUTF8));
+        actionAverageMode->setText(QApplication::translate("MainWindowClass", "Average Intensity Projection", 0, QApplication::UnicodeUTF8));
+        actionProfiling->setText(QApplication::translate("MainWindowClass", "Profiling", 0, QApplication::UnicodeUTF8));
+        actionSaveProfileTrace->setText(QApplication::translate("MainWindowClass", "Save Profile Trace...", 0, QApplication::UnicodeUTF8));
+        actionRayStatistics->setText(QApplication::translate("MainWindowClass", "Ray Statistics", 0, QApplication::UnicodeUTF8));
+        actionProgressive->setText(QApplication::translate("MainWindowClass", "Progressive Refinement", 0, QApplication::UnicodeUTF8));
+        actionReprojection->setText(QApplication::translate("MainWindowClass", "Temporal Reprojection", 0, QApplication::UnicodeUTF8));
+        actionTerminationThreshold->setText(QApplication::translate("MainWindowClass", "Termination Threshold...", 0, QApplication::UnicodeUTF8));
+        actionOcclusionCulling->setText(QApplication::translate("MainWindowClass", "Occlusion Culling", 0, QApplication::UnicodeUTF8));
+        actionSaveScreenshot->setText(QApplication::translate("MainWindowClass", "Save Screenshot...", 0, QApplication::UnicodeUTF8));
+        actionRecord->setText(QApplication::translate("MainWindowClass", "Record...", 0, QApplication::UnicodeUTF8));
+        actionAddKeyframe->setText(QApplication::translate("MainWindowClass", "Add Keyframe", 0, QApplication::UnicodeUTF8));
+        actionClearKeyframes->setText(QApplication::translate("MainWindowClass", "Clear Keyframes", 0, QApplication::UnicodeUTF8));
+        actionLoadCameraPath->setText(QApplication::translate("MainWindowClass", "Load Camera Path...", 0, QApplication::UnicodeUTF8));
+        actionSaveCameraPath->setText(QApplication::translate("MainWindowClass", "Save Camera Path...", 0, QApplication::UnicodeUTF8));
+        actionRenderSequence->setText(QApplication::translate("MainWindowClass", "Render Sequence...", 0, QApplication::UnicodeUTF8));
         menuFile->setTitle(QApplication::translate("MainWindowClass", "File", 0, QApplication::UnicodeUTF8));
+        menuOptions->setTitle(QApplication::translate("MainWindowClass", "Options", 0, QApplication::UnicodeUTF8));
+        menuRender->setTitle(QApplication::translate("MainWindowClass", "Render", 0, QApplication::UnicodeUTF8));
+        menuPlayback->setTitle(QApplication::translate("MainWindowClass", "Playback", 0, QApplication::UnicodeUTF8));
+        menuAnimation->setTitle(QApplication::translate("MainWindowClass", "Animation", 0, QApplication::UnicodeUTF8));
     } // retranslateUi
 
 };
@@ -0,0 +1,128 @@
+﻿#include "GradientVolume.h"
+#include <emmintrin.h>
+#include <omp.h>
+
+/**
+ * 3Dデータの勾配を中心差分で計算し、RGBA8に量子化した勾配ボリュームを作成する。
+ * RGBには正規化した勾配（法線）を[0, 1]にマップして格納し、Aには勾配の大きさを
+ * 最大値で正規化して格納する。シェーダは、1回のフェッチで法線を得られる。
+ * 各行の計算はSSE2で4ボクセルずつ行い、行単位で全コアに分散する。
+ *
+ * @param width				幅
+ * @param height			高さ
+ * @param depth				奥行き
+ * @param data				3Dデータ
+ * @param gradients [OUT]	勾配ボリューム（ボクセル毎に4バイト）
+ */
+void GradientVolume::compute(int width, int height, int depth, const float* data, std::vector<unsigned char>& gradients) {
+	gradients.resize((size_t)width * height * depth * 4);
+
+	// 1パス目で勾配の大きさの最大値を求める（OpenMP 2.0にはmaxのreductionが無いので、スレッド毎に求める）
+	std::vector<float> threadMax(omp_get_max_threads(), 0.0f);
+	#pragma omp parallel for schedule(dynamic)
+	for (int z = 0; z < depth; ++z) {
+		float& maxMagnitude = threadMax[omp_get_thread_num()];
+		for (int y = 0; y < height; ++y) {
+			float m = computeRow(width, height, depth, data, y, z, 0.0f, NULL);
+			if (m > maxMagnitude) maxMagnitude = m;
+		}
+	}
+
+	float maxMagnitude = 0.0f;
+	for (int i = 0; i < (int)threadMax.size(); ++i) {
+		if (threadMax[i] > maxMagnitude) maxMagnitude = threadMax[i];
+	}
+	float scale = maxMagnitude > 0.0f ? 255.0f / maxMagnitude : 0.0f;
+
+	// 2パス目で量子化して書き込む
+	#pragma omp parallel for schedule(dynamic)
+	for (int z = 0; z < depth; ++z) {
+		for (int y = 0; y < height; ++y) {
+			computeRow(width, height, depth, data, y, z, scale, &gradients[((size_t)z * height + y) * width * 4]);
+		}
+	}
+}
+
+/**
+ * 1行分の勾配を計算する。dstがNULLの場合は、勾配の大きさの最大値だけを求める。
+ * 境界では片側差分となるように、範囲外の隣接ボクセルは端のボクセルで代用する。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @param data		3Dデータ
+ * @param y			行のy座標
+ * @param z			行のz座標
+ * @param scale		勾配の大きさをAに格納する時のスケール
+ * @param dst [OUT]	1行分の勾配（width * 4バイト）。NULL可
+ * @return			この行の勾配の大きさの最大値
+ */
+float GradientVolume::computeRow(int width, int height, int depth, const float* data, int y, int z, float scale, unsigned char* dst) {
+	const float* row = data + ((size_t)z * height + y) * width;
+	const float* rowYm = data + ((size_t)z * height + (y > 0 ? y - 1 : y)) * width;
+	const float* rowYp = data + ((size_t)z * height + (y < height - 1 ? y + 1 : y)) * width;
+	const float* rowZm = data + ((size_t)(z > 0 ? z - 1 : z) * height + y) * width;
+	const float* rowZp = data + ((size_t)(z < depth - 1 ? z + 1 : z) * height + y) * width;
+
+	__m128 half = _mm_set1_ps(0.5f);
+	__m128 tiny = _mm_set1_ps(1e-12f);
+	__m128 vscale = _mm_set1_ps(scale);
+	__m128 vmax = _mm_setzero_ps();
+
+	int x = 0;
+	while (x < width) {
+		float gx[4], gy[4], gz[4];
+		int num = width - x < 4 ? width - x : 4;
+
+		if (x > 0 && x + 4 < width) {
+			// 内側は4ボクセルまとめて中心差分を取る
+			_mm_storeu_ps(gx, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(row + x + 1), _mm_loadu_ps(row + x - 1)), half));
+			_mm_storeu_ps(gy, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(rowYp + x), _mm_loadu_ps(rowYm + x)), half));
+			_mm_storeu_ps(gz, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(rowZp + x), _mm_loadu_ps(rowZm + x)), half));
+		} else {
+			for (int i = 0; i < 4; ++i) {
+				int xi = x + i < width ? x + i : width - 1;
+				int xm = xi > 0 ? xi - 1 : xi;
+				int xp = xi < width - 1 ? xi + 1 : xi;
+				gx[i] = (row[xp] - row[xm]) * 0.5f;
+				gy[i] = (rowYp[xi] - rowYm[xi]) * 0.5f;
+				gz[i] = (rowZp[xi] - rowZm[xi]) * 0.5f;
+			}
+		}
+
+		__m128 vx = _mm_loadu_ps(gx);
+		__m128 vy = _mm_loadu_ps(gy);
+		__m128 vz = _mm_loadu_ps(gz);
+		__m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)));
+		vmax = _mm_max_ps(vmax, len);
+
+		if (dst != NULL) {
+			// 法線を[-1, 1]から[0, 255]に、大きさを[0, 最大値]から[0, 255]にマップする
+			__m128 inv = _mm_div_ps(_mm_set1_ps(127.5f), _mm_max_ps(len, tiny));
+			__m128 nx = _mm_add_ps(_mm_mul_ps(vx, inv), _mm_set1_ps(127.5f));
+			__m128 ny = _mm_add_ps(_mm_mul_ps(vy, inv), _mm_set1_ps(127.5f));
+			__m128 nz = _mm_add_ps(_mm_mul_ps(vz, inv), _mm_set1_ps(127.5f));
+			__m128 na = _mm_mul_ps(len, vscale);
+
+			int ix[4], iy[4], iz[4], ia[4];
+			_mm_storeu_si128((__m128i*)ix, _mm_cvtps_epi32(nx));
+			_mm_storeu_si128((__m128i*)iy, _mm_cvtps_epi32(ny));
+			_mm_storeu_si128((__m128i*)iz, _mm_cvtps_epi32(nz));
+			_mm_storeu_si128((__m128i*)ia, _mm_cvtps_epi32(_mm_min_ps(na, _mm_set1_ps(255.0f))));
+
+			for (int i = 0; i < num; ++i) {
+				unsigned char* texel = dst + (x + i) * 4;
+				texel[0] = (unsigned char)(ix[i] < 0 ? 0 : (ix[i] > 255 ? 255 : ix[i]));
+				texel[1] = (unsigned char)(iy[i] < 0 ? 0 : (iy[i] > 255 ? 255 : iy[i]));
+				texel[2] = (unsigned char)(iz[i] < 0 ? 0 : (iz[i] > 255 ? 255 : iz[i]));
+				texel[3] = (unsigned char)ia[i];
+			}
+		}
+
+		x += num;
+	}
+
+	vmax = _mm_max_ps(vmax, _mm_shuffle_ps(vmax, vmax, _MM_SHUFFLE(2, 3, 0, 1)));
+	vmax = _mm_max_ps(vmax, _mm_shuffle_ps(vmax, vmax, _MM_SHUFFLE(1, 0, 3, 2)));
+	return _mm_cvtss_f32(vmax);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vector>
+
+class GradientVolume {
+protected:
+	GradientVolume() {}
+
+public:
+	static void compute(int width, int height, int depth, const float* data, std::vector<unsigned char>& gradients);
+
+private:
+	static float computeRow(int width, int height, int depth, const float* data, int y, int z, float scale, unsigned char* dst);
+};
@@ -0,0 +1,98 @@
+﻿#include "LightVolume.h"
+#include <math.h>
+
+/**
+ * 点光源から各ボクセルに届く光の割合（透過率）を計算する。
+ * ボリュームの中心から見た光源の方向のうち、成分が最大の軸に沿って、光源に近いスライスから順に
+ * 1スライスずつ処理する（プレーンスイープ）。各ボクセルの透過率は、光源の方向に1スライス戻った
+ * 位置の透過率を、1つ前のスライスからバイリニア補間で取得し、そのボクセルの密度で減衰させて求める。
+ * スライス内の各ボクセルは互いに独立なので、スライス毎に全コアで並列に処理する。
+ * 光源を動かしても、データ全体を1回走査するだけで更新できる。
+ *
+ * @param width					幅
+ * @param height				高さ
+ * @param depth					奥行き
+ * @param data					3Dデータ
+ * @param lightX				光源のX座標（ボリュームを[0, 1]とするテクスチャ座標）
+ * @param lightY				光源のY座標
+ * @param lightZ				光源のZ座標
+ * @param absorption			テクスチャ座標での単位長さ、単位密度あたりの吸収率
+ * @param transmittance [OUT]	透過率
+ */
+void LightVolume::compute(int width, int height, int depth, const float* data, float lightX, float lightY, float lightZ, float absorption, std::vector<float>& transmittance) {
+	int size[3] = { width, height, depth };
+	transmittance.resize((size_t)width * height * depth);
+
+	// 光源の位置をボクセル座標に変換する
+	float light[3] = { lightX * width - 0.5f, lightY * height - 0.5f, lightZ * depth - 0.5f };
+
+	// ボリュームの中心から見た光源の方向で、スイープする軸と向きを決める
+	float dir[3] = { lightX - 0.5f, lightY - 0.5f, lightZ - 0.5f };
+	int axis = 0;
+	for (int i = 1; i < 3; ++i) {
+		if (fabs(dir[i]) > fabs(dir[axis])) axis = i;
+	}
+	int u = (axis + 1) % 3;
+	int v = (axis + 2) % 3;
+	int step = dir[axis] > 0.0f ? -1 : 1;
+	int first = step > 0 ? 0 : size[axis] - 1;
+
+	for (int n = 0; n < size[axis]; ++n) {
+		int s = first + n * step;
+
+		#pragma omp parallel for
+		for (int j = 0; j < size[v]; ++j) {
+			for (int i = 0; i < size[u]; ++i) {
+				int c[3];
+				c[axis] = s;
+				c[u] = i;
+				c[v] = j;
+				size_t index = ((size_t)c[2] * height + c[1]) * width + c[0];
+
+				// このボクセルから光源へ向かって、1つ前のスライスまで戻る
+				float toLight[3] = { light[0] - c[0], light[1] - c[1], light[2] - c[2] };
+				float prev = 1.0f;
+				float offset[3] = { 0.0f, 0.0f, 0.0f };
+				offset[axis] = (float)-step;
+				if (toLight[axis] * -step > 1e-3f) {
+					float t = 1.0f / fabs(toLight[axis]);
+					offset[u] = toLight[u] * t;
+					offset[v] = toLight[v] * t;
+				}
+
+				if (n > 0) {
+					// 1つ前のスライスの透過率をバイリニア補間する。スライスの外からは減衰せずに光が届く
+					float fu = c[u] + offset[u];
+					float fv = c[v] + offset[v];
+					if (fu >= 0.0f && fu <= size[u] - 1 && fv >= 0.0f && fv <= size[v] - 1) {
+						int u0 = (int)fu;
+						int v0 = (int)fv;
+						int u1 = u0 < size[u] - 1 ? u0 + 1 : u0;
+						int v1 = v0 < size[v] - 1 ? v0 + 1 : v0;
+						float ru = fu - u0;
+						float rv = fv - v0;
+
+						int p[3];
+						p[axis] = s - step;
+						float t[4];
+						int us[2] = { u0, u1 };
+						int vs[2] = { v0, v1 };
+						for (int k = 0; k < 4; ++k) {
+							p[u] = us[k & 1];
+							p[v] = vs[k >> 1];
+							t[k] = transmittance[((size_t)p[2] * height + p[1]) * width + p[0]];
+						}
+						prev = (t[0] * (1.0f - ru) + t[1] * ru) * (1.0f - rv) + (t[2] * (1.0f - ru) + t[3] * ru) * rv;
+					}
+				}
+
+				// 戻った距離をテクスチャ座標での長さに直して、このボクセルの密度で減衰させる
+				float dx = offset[0] / width;
+				float dy = offset[1] / height;
+				float dz = offset[2] / depth;
+				float length = sqrt(dx * dx + dy * dy + dz * dz);
+				transmittance[index] = prev * exp(-absorption * data[index] * length);
+			}
+		}
+	}
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <vector>
+
+class LightVolume {
+protected:
+	LightVolume() {}
+
+public:
+	static void compute(int width, int height, int depth, const float* data, float lightX, float lightY, float lightZ, float absorption, std::vector<float>& transmittance);
+};
@@ -1,12 +1,47 @@
 #include "MainWindow.h"
 #include <QFileDialog>
+#include <QActionGroup>
+#include <QInputDialog>
 #include "Util.h"
 
 MainWindow::MainWindow(QWidget *parent, Qt::WFlags flags) : QMainWindow(parent, flags) {
 	ui.setupUi(this);
 
 	connect(ui.actionOpen, SIGNAL(triggered()), this, SLOT(onOpen()));
+	connect(ui.actionOpenSequence, SIGNAL(triggered()), this, SLOT(onOpenSequence()));
+	connect(ui.actionPlay, SIGNAL(toggled(bool)), this, SLOT(onPlay(bool)));
+	connect(ui.actionDeltaPlayback, SIGNAL(toggled(bool)), this, SLOT(onDeltaPlayback(bool)));
+	connect(ui.actionSaveScreenshot, SIGNAL(triggered()), this, SLOT(onSaveScreenshot()));
+	connect(ui.actionRecord, SIGNAL(toggled(bool)), this, SLOT(onRecord(bool)));
 	connect(ui.actionExit, SIGNAL(triggered()), this, SLOT(close()));
+	connect(ui.actionCompressVolume, SIGNAL(toggled(bool)), this, SLOT(onCompressVolume(bool)));
+	connect(ui.actionSparseVolume, SIGNAL(toggled(bool)), this, SLOT(onSparseVolume(bool)));
+	connect(ui.actionShading, SIGNAL(toggled(bool)), this, SLOT(onShading(bool)));
+	connect(ui.actionPrecomputedLight, SIGNAL(toggled(bool)), this, SLOT(onPrecomputedLight(bool)));
+	connect(ui.actionAmbientOcclusion, SIGNAL(toggled(bool)), this, SLOT(onAmbientOcclusion(bool)));
+	connect(ui.actionIsoValue, SIGNAL(triggered()), this, SLOT(onIsoValue()));
+	connect(ui.actionRayStatistics, SIGNAL(toggled(bool)), this, SLOT(onRayStatistics(bool)));
+	connect(ui.actionProgressive, SIGNAL(toggled(bool)), this, SLOT(onProgressive(bool)));
+	connect(ui.actionReprojection, SIGNAL(toggled(bool)), this, SLOT(onReprojection(bool)));
+	connect(ui.actionTerminationThreshold, SIGNAL(triggered()), this, SLOT(onTerminationThreshold()));
+	connect(ui.actionOcclusionCulling, SIGNAL(toggled(bool)), this, SLOT(onOcclusionCulling(bool)));
+	connect(ui.actionProfiling, SIGNAL(toggled(bool)), this, SLOT(onProfiling(bool)));
+	connect(ui.actionSaveProfileTrace, SIGNAL(triggered()), this, SLOT(onSaveProfileTrace()));
+	connect(ui.actionAddKeyframe, SIGNAL(triggered()), this, SLOT(onAddKeyframe()));
+	connect(ui.actionClearKeyframes, SIGNAL(triggered()), this, SLOT(onClearKeyframes()));
+	connect(ui.actionLoadCameraPath, SIGNAL(triggered()), this, SLOT(onLoadCameraPath()));
+	connect(ui.actionSaveCameraPath, SIGNAL(triggered()), this, SLOT(onSaveCameraPath()));
+	connect(ui.actionRenderSequence, SIGNAL(triggered()), this, SLOT(onRenderSequence()));
+
+	// the render modes are exclusive
+	QActionGroup* renderModeGroup = new QActionGroup(this);
+	renderModeGroup->addAction(ui.actionVolumeMode);
+	renderModeGroup->addAction(ui.actionIsosurfaceMode);
+	renderModeGroup->addAction(ui.actionIsoRaycastMode);
+	renderModeGroup->addAction(ui.actionMipMode);
+	renderModeGroup->addAction(ui.actionMinipMode);
+	renderModeGroup->addAction(ui.actionAverageMode);
+	connect(renderModeGroup, SIGNAL(triggered(QAction*)), this, SLOT(onRenderMode(QAction*)));
 
 	glWidget = new GLWidget3D();
 	setCentralWidget(glWidget);
@@ -21,3 +56,161 @@ void MainWindow::onOpen() {
 
 	glWidget->loadVTK(filename.toUtf8().data());
 }
+
+void MainWindow::onOpenSequence() {
+	QStringList filenames = QFileDialog::getOpenFileNames(this, tr("Open VTK sequence..."), "", tr("VTK Files (*.vtk)"));
+	if (filenames.isEmpty()) return;
+
+	// frames are played in the order of their file names
+	filenames.sort();
+
+	std::vector<std::string> files;
+	for (int i = 0; i < filenames.size(); ++i) {
+		files.push_back(filenames[i].toUtf8().data());
+	}
+
+	ui.actionPlay->setChecked(false);
+	glWidget->loadVTKSequence(files);
+}
+
+void MainWindow::onSaveScreenshot() {
+	QString filename = QFileDialog::getSaveFileName(this, tr("Save screenshot..."), "screenshot.png", tr("Image Files (*.png *.jpg *.bmp)"));
+	if (filename.isEmpty()) return;
+
+	glWidget->saveScreenshot(filename.toUtf8().data());
+}
+
+void MainWindow::onRecord(bool checked) {
+	if (!checked) {
+		glWidget->stopRecording();
+		return;
+	}
+
+	// a .raw file gets the raw BGRA frames, anything else is the prefix of a PNG sequence
+	QString filename = QFileDialog::getSaveFileName(this, tr("Record..."), "frames", tr("PNG Sequence (*);;Raw Video (*.raw)"));
+	int format = filename.endsWith(".raw", Qt::CaseInsensitive) ? FrameRecorder::FORMAT_RAW : FrameRecorder::FORMAT_PNG;
+	if (filename.isEmpty() || !glWidget->startRecording(filename.toUtf8().data(), format)) {
+		ui.actionRecord->setChecked(false);
+	}
+}
+
+void MainWindow::onPlay(bool checked) {
+	glWidget->setPlaying(checked);
+}
+
+void MainWindow::onDeltaPlayback(bool checked) {
+	glWidget->setDeltaPlayback(checked);
+}
+
+void MainWindow::onCompressVolume(bool checked) {
+	glWidget->setCompressVolume(checked);
+}
+
+void MainWindow::onSparseVolume(bool checked) {
+	glWidget->setSparseVolume(checked);
+}
+
+void MainWindow::onShading(bool checked) {
+	glWidget->setShading(checked);
+}
+
+void MainWindow::onPrecomputedLight(bool checked) {
+	glWidget->setPrecomputedLight(checked);
+}
+
+void MainWindow::onAmbientOcclusion(bool checked) {
+	glWidget->setAmbientOcclusion(checked);
+}
+
+void MainWindow::onRenderMode(QAction* action) {
+	if (action == ui.actionIsosurfaceMode) {
+		glWidget->setRenderMode(VolumeRendering::RENDER_ISOSURFACE);
+	} else if (action == ui.actionIsoRaycastMode) {
+		glWidget->setRenderMode(VolumeRendering::RENDER_ISORAYCAST);
+	} else if (action == ui.actionMipMode) {
+		glWidget->setRenderMode(VolumeRendering::RENDER_MIP);
+	} else if (action == ui.actionMinipMode) {
+		glWidget->setRenderMode(VolumeRendering::RENDER_MINIP);
+	} else if (action == ui.actionAverageMode) {
+		glWidget->setRenderMode(VolumeRendering::RENDER_AVERAGE);
+	} else {
+		glWidget->setRenderMode(VolumeRendering::RENDER_VOLUME);
+	}
+}
+
+void MainWindow::onIsoValue() {
+	bool ok;
+	double isoValue = QInputDialog::getDouble(this, tr("Iso Value"), tr("Iso value (density in the window, 0 - 1):"), glWidget->getIsoValue(), 0.0, 10.0, 3, &ok);
+	if (!ok) return;
+
+	glWidget->setIsoValue(isoValue);
+}
+
+void MainWindow::onTerminationThreshold() {
+	bool ok;
+	double threshold = QInputDialog::getDouble(this, tr("Termination Threshold"), tr("Opacity to terminate the rays (0 - 1):"), glWidget->getTerminationThreshold(), 0.0, 1.0, 3, &ok);
+	if (!ok) return;
+
+	glWidget->setTerminationThreshold(threshold);
+}
+
+void MainWindow::onRayStatistics(bool checked) {
+	glWidget->setRayStatistics(checked);
+}
+
+void MainWindow::onProgressive(bool checked) {
+	glWidget->setProgressive(checked);
+}
+
+void MainWindow::onReprojection(bool checked) {
+	glWidget->setReprojection(checked);
+}
+
+void MainWindow::onOcclusionCulling(bool checked) {
+	glWidget->setOcclusionCulling(checked);
+}
+
+void MainWindow::onProfiling(bool checked) {
+	glWidget->setProfiling(checked);
+}
+
+void MainWindow::onSaveProfileTrace() {
+	QString filename = QFileDialog::getSaveFileName(this, tr("Save profile trace..."), "trace.json", tr("Chrome Trace Files (*.json)"));
+	if (filename.isEmpty()) return;
+
+	glWidget->saveProfileTrace(filename.toUtf8().data());
+}
+
+void MainWindow::onAddKeyframe() {
+	glWidget->addCameraKeyframe();
+}
+
+void MainWindow::onClearKeyframes() {
+	glWidget->clearCameraPath();
+}
+
+void MainWindow::onLoadCameraPath() {
+	QString filename = QFileDialog::getOpenFileName(this, tr("Load camera path..."), "", tr("Camera Path Files (*.txt)"));
+	if (filename.isEmpty()) return;
+
+	glWidget->loadCameraPath(filename.toUtf8().data());
+}
+
+void MainWindow::onSaveCameraPath() {
+	QString filename = QFileDialog::getSaveFileName(this, tr("Save camera path..."), "camera.txt", tr("Camera Path Files (*.txt)"));
+	if (filename.isEmpty()) return;
+
+	glWidget->saveCameraPath(filename.toUtf8().data());
+}
+
+void MainWindow::onRenderSequence() {
+	// the frames are written as prefix_00000.png, ...
+	QString prefix = QFileDialog::getSaveFileName(this, tr("Render sequence..."), "frames", tr("PNG Sequence (*)"));
+	if (prefix.isEmpty()) return;
+
+	bool ok;
+	int fps = QInputDialog::getInt(this, tr("Render Sequence"), tr("Frames per second:"), 30, 1, 120, 1, &ok);
+	if (!ok) return;
+
+	glWidget->renderCameraPath(prefix.toUtf8().data(), fps);
+}
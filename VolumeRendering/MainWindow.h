@@ -20,6 +20,30 @@ public:
 
 public slots:
 	void onOpen();
+	void onOpenSequence();
+	void onSaveScreenshot();
+	void onRecord(bool checked);
+	void onPlay(bool checked);
+	void onDeltaPlayback(bool checked);
+	void onCompressVolume(bool checked);
+	void onSparseVolume(bool checked);
+	void onShading(bool checked);
+	void onPrecomputedLight(bool checked);
+	void onAmbientOcclusion(bool checked);
+	void onRenderMode(QAction* action);
+	void onIsoValue();
+	void onTerminationThreshold();
+	void onRayStatistics(bool checked);
+	void onProgressive(bool checked);
+	void onReprojection(bool checked);
+	void onOcclusionCulling(bool checked);
+	void onProfiling(bool checked);
+	void onSaveProfileTrace();
+	void onAddKeyframe();
+	void onClearKeyframes();
+	void onLoadCameraPath();
+	void onSaveCameraPath();
+	void onRenderSequence();
 };
 
 #endif // MAINWINDOW_H
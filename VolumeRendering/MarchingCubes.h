@@ -0,0 +1,22 @@
+#pragma once
+
+#include <vector>
+#include "MinMaxBricks.h"
+
+class MarchingCubes {
+public:
+	struct Vertex {
+		float x, y, z;
+		float nx, ny, nz;
+	};
+
+protected:
+	MarchingCubes() {}
+
+public:
+	static void extract(int width, int height, int depth, const float* data, const MinMaxBricks& bricks, float isoValue, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+
+private:
+	static void extractBrick(int width, int height, int depth, const float* data, const MinMaxBricks& bricks, int bx, int by, int bz, float isoValue, std::vector<int>& edgeVertices, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+	static void gradient(int width, int height, int depth, const float* data, int x, int y, int z, float* g);
+};
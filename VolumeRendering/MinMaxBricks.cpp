@@ -0,0 +1,105 @@
+﻿#include "MinMaxBricks.h"
+
+MinMaxBricks::MinMaxBricks() {
+	width = 0;
+	height = 0;
+	depth = 0;
+	bricksX = 0;
+	bricksY = 0;
+	bricksZ = 0;
+}
+
+/**
+ * 3DデータのセルをBRICK_SIZE^3のブリックに分割し、ブリック毎に最小値と最大値を求める。
+ * セル(x, y, z)は、ボクセル(x, y, z)から(x+1, y+1, z+1)までの立方体なので、
+ * 各ブリックは、隣のブリックと1ボクセル重なる範囲の値を見る。
+ * ブリックは互いに独立なので、全コアで並列に処理する。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @param data		3Dデータ
+ */
+void MinMaxBricks::build(int width, int height, int depth, const float* data) {
+	this->width = width;
+	this->height = height;
+	this->depth = depth;
+
+	// セルの数は、各軸でボクセルの数-1
+	bricksX = (width - 2) / BRICK_SIZE + 1;
+	bricksY = (height - 2) / BRICK_SIZE + 1;
+	bricksZ = (depth - 2) / BRICK_SIZE + 1;
+
+	int numBricks = bricksX * bricksY * bricksZ;
+	minValues.resize(numBricks);
+	maxValues.resize(numBricks);
+
+	#pragma omp parallel for schedule(dynamic)
+	for (int i = 0; i < numBricks; ++i) {
+		int x0, y0, z0, x1, y1, z1;
+		getCellRange(i % bricksX, (i / bricksX) % bricksY, i / (bricksX * bricksY), x0, y0, z0, x1, y1, z1);
+
+		float minVal = data[((size_t)z0 * height + y0) * width + x0];
+		float maxVal = minVal;
+		for (int z = z0; z <= z1; ++z) {
+			for (int y = y0; y <= y1; ++y) {
+				const float* row = data + ((size_t)z * height + y) * width;
+				for (int x = x0; x <= x1; ++x) {
+					if (row[x] < minVal) minVal = row[x];
+					if (row[x] > maxVal) maxVal = row[x];
+				}
+			}
+		}
+		minValues[i] = minVal;
+		maxValues[i] = maxVal;
+	}
+}
+
+/**
+ * ブリックを破棄する。
+ */
+void MinMaxBricks::clear() {
+	minValues.clear();
+	maxValues.clear();
+	bricksX = 0;
+	bricksY = 0;
+	bricksZ = 0;
+}
+
+/**
+ * 指定したブリックの中に、isoValueの等値面が通るセルがあり得るかどうかを返却する。
+ * ボクセルの値がisoValue未満かどうかでセルを分類するので、最小値がisoValue未満で、
+ * 最大値がisoValue以上のブリックだけが対象となる。
+ *
+ * @param bx		ブリックのX座標
+ * @param by		ブリックのY座標
+ * @param bz		ブリックのZ座標
+ * @param isoValue	等値面の値
+ * @return			等値面が通り得るならtrue
+ */
+bool MinMaxBricks::crosses(int bx, int by, int bz, float isoValue) const {
+	return getMin(bx, by, bz) < isoValue && getMax(bx, by, bz) >= isoValue;
+}
+
+/**
+ * 指定したブリックに含まれるセルの範囲を、ボクセル座標で返却する。
+ * [x0, x1]などはボクセルの範囲で、セルは[x0, x1 - 1]となる。
+ *
+ * @param bx		ブリックのX座標
+ * @param by		ブリックのY座標
+ * @param bz		ブリックのZ座標
+ * @param x0 [OUT]	最小X座標
+ * @param y0 [OUT]	最小Y座標
+ * @param z0 [OUT]	最小Z座標
+ * @param x1 [OUT]	最大X座標
+ * @param y1 [OUT]	最大Y座標
+ * @param z1 [OUT]	最大Z座標
+ */
+void MinMaxBricks::getCellRange(int bx, int by, int bz, int& x0, int& y0, int& z0, int& x1, int& y1, int& z1) const {
+	x0 = bx * BRICK_SIZE;
+	y0 = by * BRICK_SIZE;
+	z0 = bz * BRICK_SIZE;
+	x1 = x0 + BRICK_SIZE < width - 1 ? x0 + BRICK_SIZE : width - 1;
+	y1 = y0 + BRICK_SIZE < height - 1 ? y0 + BRICK_SIZE : height - 1;
+	z1 = z0 + BRICK_SIZE < depth - 1 ? z0 + BRICK_SIZE : depth - 1;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+class MinMaxBricks {
+public:
+	static const int BRICK_SIZE = 8;
+
+private:
+	int width;
+	int height;
+	int depth;
+	int bricksX;
+	int bricksY;
+	int bricksZ;
+	std::vector<float> minValues;
+	std::vector<float> maxValues;
+
+public:
+	MinMaxBricks();
+
+	void build(int width, int height, int depth, const float* data);
+	void clear();
+	bool isEmpty() const { return minValues.empty(); }
+
+	int getBricksX() const { return bricksX; }
+	int getBricksY() const { return bricksY; }
+	int getBricksZ() const { return bricksZ; }
+	float getMin(int bx, int by, int bz) const { return minValues[(bz * bricksY + by) * bricksX + bx]; }
+	float getMax(int bx, int by, int bz) const { return maxValues[(bz * bricksY + by) * bricksX + bx]; }
+	bool crosses(int bx, int by, int bz, float isoValue) const;
+	void getCellRange(int bx, int by, int bz, int& x0, int& y0, int& z0, int& x1, int& y1, int& z1) const;
+};
@@ -0,0 +1,264 @@
+﻿#include "OffscreenContext.h"
+#include <iostream>
+#include <string.h>
+
+OffscreenContext::OffscreenContext() {
+	width = 0;
+	height = 0;
+
+#if defined(OFFSCREEN_EGL)
+	display = EGL_NO_DISPLAY;
+	surface = EGL_NO_SURFACE;
+	context = EGL_NO_CONTEXT;
+#elif defined(OFFSCREEN_OSMESA)
+	context = NULL;
+#endif
+
+	fbo = 0;
+	colorBuffer = 0;
+	depthBuffer = 0;
+}
+
+OffscreenContext::~OffscreenContext() {
+	if (fbo > 0 && makeCurrent()) {
+		glDeleteFramebuffers(1, &fbo);
+		glDeleteRenderbuffers(1, &colorBuffer);
+		glDeleteRenderbuffers(1, &depthBuffer);
+	}
+	destroyContext();
+}
+
+/**
+ * ウィンドウシステムを使わずにOpenGLのコンテキストを生成し、描画先のフレームバッファを用意する。
+ * バックエンドは、ビルド時にOFFSCREEN_EGL（EGLのsurfacelessコンテキスト）か、
+ * OFFSCREEN_OSMESA（OSMesa、llvmpipeならGPUも不要）を定義して選択する。
+ * どちらの場合も、GLEWはそのバックエンドに対応したもの（GLEW_EGL、GLEW_OSMESA）を使うこと。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @return			生成できた場合はtrue
+ */
+bool OffscreenContext::create(int width, int height) {
+	if (!createContext()) return false;
+
+	glewExperimental = GL_TRUE;
+	GLenum err = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+	// GLXのディスプレイが無いだけなら、OpenGLの関数は読み込まれている
+	if (err == GLEW_ERROR_NO_GLX_DISPLAY) err = GLEW_OK;
+#endif
+	if (err != GLEW_OK) {
+		std::cout << "Error: " << glewGetErrorString(err) << std::endl;
+		destroyContext();
+		return false;
+	}
+	// glewExperimentalで、対応していない拡張の問い合わせによるエラーが残るので、捨てておく
+	glGetError();
+
+	std::cout << "Offscreen context: " << glGetString(GL_RENDERER) << ", " << glGetString(GL_VERSION) << std::endl;
+
+	glGenFramebuffers(1, &fbo);
+	glGenRenderbuffers(1, &colorBuffer);
+	glGenRenderbuffers(1, &depthBuffer);
+	resize(width, height);
+
+	return true;
+}
+
+/**
+ * このコンテキストを、呼び出したスレッドのカレントにする。
+ *
+ * @return		成功した場合はtrue
+ */
+bool OffscreenContext::makeCurrent() {
+#if defined(OFFSCREEN_EGL)
+	return context != EGL_NO_CONTEXT && eglMakeCurrent(display, surface, surface, context) == EGL_TRUE;
+#elif defined(OFFSCREEN_OSMESA)
+	return context != NULL && OSMesaMakeCurrent(context, &buffer[0], GL_UNSIGNED_BYTE, 1, 1) == GL_TRUE;
+#else
+	return false;
+#endif
+}
+
+/**
+ * 描画先のフレームバッファのサイズを変更し、ビューポートを合わせる。
+ *
+ * @param width		幅
+ * @param height	高さ
+ */
+void OffscreenContext::resize(int width, int height) {
+	this->width = width > 0 ? width : 1;
+	this->height = height > 0 ? height : 1;
+
+	makeCurrent();
+	allocateFramebuffer();
+	glViewport(0, 0, this->width, this->height);
+}
+
+/**
+ * 描画先のフレームバッファの内容を読み戻す。
+ * VolumeRenderingは不透明度を乗じた色を出力するので、QImage::Format_ARGB32_Premultipliedとして返却する。
+ *
+ * @param image [OUT]	読み戻した画像
+ */
+void OffscreenContext::readPixels(QImage& image) {
+	image = QImage(width, height, QImage::Format_ARGB32_Premultiplied);
+
+	// QImageのARGB32は、リトルエンディアンではメモリ上B, G, R, Aの順に並ぶので、GL_BGRAでそのまま読める
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glReadPixels(0, 0, width, height, GL_BGRA, GL_UNSIGNED_BYTE, image.bits());
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+	// OpenGLは下の行から並ぶので、上下を反転する
+	image = image.mirrored();
+}
+
+/**
+ * バックエンドのコンテキストを生成し、カレントにする。
+ * 既存の描画はコンパティビリティプロファイルの関数も使うので、まずそれを要求し、
+ * 生成できない場合はコアプロファイルで生成する。
+ *
+ * @return		生成できた場合はtrue
+ */
+bool OffscreenContext::createContext() {
+#if defined(OFFSCREEN_EGL)
+	// EGL_MESA_platform_surfacelessがあれば、ディスプレイサーバが無くてもディスプレイを取得できる
+	const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+	if (clientExtensions != NULL && strstr(clientExtensions, "EGL_MESA_platform_surfaceless") != NULL) {
+		PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay != NULL) {
+			display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+		}
+	}
+	if (display == EGL_NO_DISPLAY) {
+		display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	}
+
+	EGLint major, minor;
+	if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+		std::cout << "Unable to initialize EGL." << std::endl;
+		display = EGL_NO_DISPLAY;
+		return false;
+	}
+	if (!eglBindAPI(EGL_OPENGL_API)) {
+		std::cout << "EGL does not support OpenGL." << std::endl;
+		destroyContext();
+		return false;
+	}
+
+	// 描画はフレームバッファに対して行うので、surfacelessコンテキストが使えればサーフェスは不要
+	const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+	bool surfaceless = extensions != NULL && strstr(extensions, "EGL_KHR_surfaceless_context") != NULL;
+
+	EGLint configAttribs[] = {
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+		EGL_NONE
+	};
+	EGLConfig config;
+	EGLint numConfigs = 0;
+	if (!eglChooseConfig(display, configAttribs, &config, 1, &numConfigs) || numConfigs == 0) {
+		std::cout << "No EGL config supports OpenGL." << std::endl;
+		destroyContext();
+		return false;
+	}
+
+	EGLint profiles[2] = { EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR };
+	for (int i = 0; i < 2 && context == EGL_NO_CONTEXT; ++i) {
+		EGLint contextAttribs[] = {
+			EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+			EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, profiles[i],
+			EGL_NONE
+		};
+		context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+	}
+	if (context == EGL_NO_CONTEXT) {
+		std::cout << "Unable to create an OpenGL 3.3 context with EGL." << std::endl;
+		destroyContext();
+		return false;
+	}
+
+	if (!surfaceless) {
+		EGLint surfaceAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+		surface = eglCreatePbufferSurface(display, config, surfaceAttribs);
+		if (surface == EGL_NO_SURFACE) {
+			std::cout << "Unable to create an EGL pbuffer." << std::endl;
+			destroyContext();
+			return false;
+		}
+	}
+#elif defined(OFFSCREEN_OSMESA)
+	int profiles[2] = { OSMESA_COMPAT_PROFILE, OSMESA_CORE_PROFILE };
+	for (int i = 0; i < 2 && context == NULL; ++i) {
+		int attribs[] = {
+			OSMESA_FORMAT, OSMESA_RGBA,
+			OSMESA_DEPTH_BITS, 24,
+			OSMESA_PROFILE, profiles[i],
+			OSMESA_CONTEXT_MAJOR_VERSION, 3,
+			OSMESA_CONTEXT_MINOR_VERSION, 3,
+			0
+		};
+		context = OSMesaCreateContextAttribs(attribs, NULL);
+	}
+	if (context == NULL) {
+		std::cout << "Unable to create an OpenGL 3.3 context with OSMesa." << std::endl;
+		return false;
+	}
+
+	// 描画はフレームバッファに対して行うので、OSMesaのバッファはカレントにするためだけの1x1でよい
+	buffer.assign(4, 0);
+#else
+	std::cout << "Offscreen rendering is not available in this build. Define OFFSCREEN_EGL or OFFSCREEN_OSMESA." << std::endl;
+	return false;
+#endif
+
+	if (!makeCurrent()) {
+		std::cout << "Unable to make the offscreen context current." << std::endl;
+		destroyContext();
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * バックエンドのコンテキストを破棄する。
+ */
+void OffscreenContext::destroyContext() {
+#if defined(OFFSCREEN_EGL)
+	if (display != EGL_NO_DISPLAY) {
+		eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		if (context != EGL_NO_CONTEXT) eglDestroyContext(display, context);
+		if (surface != EGL_NO_SURFACE) eglDestroySurface(display, surface);
+		eglTerminate(display);
+	}
+	display = EGL_NO_DISPLAY;
+	surface = EGL_NO_SURFACE;
+	context = EGL_NO_CONTEXT;
+#elif defined(OFFSCREEN_OSMESA)
+	if (context != NULL) {
+		OSMesaDestroyContext(context);
+	}
+	context = NULL;
+#endif
+}
+
+/**
+ * 描画先のフレームバッファに、現在のサイズの色（RGBA8）と深度のレンダーバッファを割り当てる。
+ */
+void OffscreenContext::allocateFramebuffer() {
+	glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+		std::cout << "Offscreen framebuffer is incomplete." << std::endl;
+	}
+}
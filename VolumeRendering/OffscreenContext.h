@@ -0,0 +1,49 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+#include <QImage>
+#if defined(OFFSCREEN_EGL)
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#elif defined(OFFSCREEN_OSMESA)
+#include <GL/osmesa.h>
+#endif
+
+class OffscreenContext {
+private:
+	int width;
+	int height;
+
+#if defined(OFFSCREEN_EGL)
+	EGLDisplay display;
+	EGLSurface surface;
+	EGLContext context;
+#elif defined(OFFSCREEN_OSMESA)
+	OSMesaContext context;
+	std::vector<unsigned char> buffer;
+#endif
+
+	GLuint fbo;
+	GLuint colorBuffer;
+	GLuint depthBuffer;
+
+public:
+	OffscreenContext();
+	~OffscreenContext();
+
+	bool create(int width, int height);
+	bool isValid() const { return fbo != 0; }
+	bool makeCurrent();
+	void resize(int width, int height);
+	GLuint getFramebuffer() const { return fbo; }
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+	void readPixels(QImage& image);
+
+private:
+	bool createContext();
+	void destroyContext();
+	void allocateFramebuffer();
+};
+
@@ -0,0 +1,107 @@
+﻿#include "OffscreenRenderer.h"
+#include <iostream>
+#include <stdio.h>
+#include <QMatrix4x4>
+#include "Util.h"
+#include "Profiler.h"
+
+OffscreenRenderer::OffscreenRenderer() {
+	vr = NULL;
+}
+
+OffscreenRenderer::~OffscreenRenderer() {
+	if (vr != NULL && context.makeCurrent()) {
+		delete vr;
+	}
+}
+
+/**
+ * オフスクリーンのコンテキストを生成し、その上にVolumeRenderingを初期化する。
+ * VolumeRenderingは、コンテキストのフレームバッファに描画する。
+ *
+ * @param width		画像の幅
+ * @param height	画像の高さ
+ * @return			生成できた場合はtrue
+ */
+bool OffscreenRenderer::create(int width, int height) {
+	if (!context.create(width, height)) return false;
+
+	vr = new VolumeRendering();
+	vr->setTargetFramebuffer(context.getFramebuffer());
+
+	return true;
+}
+
+/**
+ * 画像のサイズを変更する。
+ *
+ * @param width		画像の幅
+ * @param height	画像の高さ
+ */
+void OffscreenRenderer::resize(int width, int height) {
+	context.resize(width, height);
+}
+
+/**
+ * VTKファイルを読み込み、GLWidget3Dと同じく、ヒストグラムから窓を設定する。
+ *
+ * @param filename	ファイル名
+ * @return			読み込めた場合はtrue
+ */
+bool OffscreenRenderer::loadVTK(char* filename) {
+	float* data;
+	int width, height, depth;
+	VolumeHistogram histogram;
+	if (!Util::loadVTK(filename, width, height, depth, &data, &histogram)) {
+		std::cout << "Unable to load " << filename << std::endl;
+		return false;
+	}
+
+	float windowMin, windowMax;
+	histogram.getAutoWindow(windowMin, windowMax);
+
+	context.makeCurrent();
+	vr->setWindow(windowMin, windowMax);
+	vr->setVolumeData(width, height, depth, data);
+
+	delete [] data;
+
+	return true;
+}
+
+/**
+ * 現在のカメラで描画し、画像を読み戻す。
+ * 固定機能の行列スタックは使わず、GLWidget3Dと同じ行列をQMatrix4x4で計算する。
+ * 段階的な描画が有効な場合は、平均し終わるまで描画する。
+ *
+ * @param image [OUT]	描画した画像
+ */
+void OffscreenRenderer::render(QImage& image) {
+	PROFILE_SCOPE("offscreenRender");
+
+	context.makeCurrent();
+	Profiler::beginFrame();
+
+	// GLWidget3D::resizeGLのgluPerspectiveと同じ投影
+	QMatrix4x4 projection;
+	projection.perspective(45, (float)context.getWidth() / context.getHeight(), 0.1, 10000);
+	QMatrix4x4 modelview = camera.getModelviewMatrix();
+	for (int i = 0; i < 16; ++i) {
+		vr->projectionMatrix[i] = (GLfloat)projection.constData()[i];
+		vr->modelviewMatrix[i] = (GLfloat)modelview.constData()[i];
+	}
+	QVector3D cameraPos = (modelview.inverted() * QVector4D(0, 0, 0, 1)).toVector3D();
+
+	glBindFramebuffer(GL_FRAMEBUFFER, context.getFramebuffer());
+	glViewport(0, 0, context.getWidth(), context.getHeight());
+	glClearColor(0, 0, 0, 0);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	vr->render(cameraPos);
+	while (vr->needsRefinement()) {
+		vr->render(cameraPos);
+	}
+
+	context.readPixels(image);
+	Profiler::endFrame();
+}
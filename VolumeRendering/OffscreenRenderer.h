@@ -0,0 +1,28 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <QImage>
+#include <QVector3D>
+#include "Camera.h"
+#include "OffscreenContext.h"
+#include "VolumeRendering.h"
+
+class OffscreenRenderer {
+public:
+	Camera camera;
+
+private:
+	OffscreenContext context;
+	VolumeRendering* vr;
+
+public:
+	OffscreenRenderer();
+	~OffscreenRenderer();
+
+	bool create(int width, int height);
+	void resize(int width, int height);
+	bool loadVTK(char* filename);
+	VolumeRendering* getVolumeRendering() { return vr; }
+	void render(QImage& image);
+};
+
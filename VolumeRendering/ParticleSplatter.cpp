@@ -0,0 +1,182 @@
+﻿#include "ParticleSplatter.h"
+#include <math.h>
+#include <omp.h>
+
+#ifndef M_PI
+#define M_PI	3.14159265358979323846
+#endif
+
+/**
+ * SPHの粒子から、格子状の3Dデータ（密度）を再構成する。
+ * 格子の原点(minX, minY, minZ)にボクセル(0, 0, 0)の中心があり、各ボクセルの間隔はvoxelSizeとする。
+ *
+ * @param width				幅
+ * @param height			高さ
+ * @param depth				奥行き
+ * @param minX				格子の原点のx座標
+ * @param minY				格子の原点のy座標
+ * @param minZ				格子の原点のz座標
+ * @param voxelSize			ボクセルの間隔
+ * @param smoothingLength	SPHカーネルの影響半径
+ */
+ParticleSplatter::ParticleSplatter(int width, int height, int depth, float minX, float minY, float minZ, float voxelSize, float smoothingLength) {
+	this->width = width;
+	this->height = height;
+	this->depth = depth;
+	this->minX = minX;
+	this->minY = minY;
+	this->minZ = minZ;
+	this->voxelSize = voxelSize;
+	this->smoothingLength = smoothingLength;
+	densityScale = 1.0f;
+
+	// セルの一辺を影響半径にすると、各ボクセルは周囲27セルの粒子だけを調べればよい
+	cellsX = (int)ceil(width * voxelSize / smoothingLength) + 1;
+	cellsY = (int)ceil(height * voxelSize / smoothingLength) + 1;
+	cellsZ = (int)ceil(depth * voxelSize / smoothingLength) + 1;
+}
+
+/**
+ * 粒子の密度をSPHカーネルで格子上に評価し、3Dデータに書き込む。
+ * 各ボクセルが周囲のセルの粒子を集める（gather）方式なので、スレッド間で書き込みが競合せず、
+ * アトミック演算なしにz方向のスライス単位で並列化できる。
+ * 結果はdensityScale倍されるので、そのままVolumeRendering::setVolumeDataに渡せる。
+ *
+ * @param particles		粒子
+ * @param data [OUT]	3Dデータ（width * height * depth個の領域を確保しておくこと）
+ */
+void ParticleSplatter::splat(const std::vector<Particle>& particles, float* data) {
+	binParticles(particles);
+
+	float h2 = smoothingLength * smoothingLength;
+
+	#pragma omp parallel for schedule(dynamic)
+	for (int k = 0; k < depth; ++k) {
+		float pz = minZ + k * voxelSize;
+		int cz = (int)((pz - minZ) / smoothingLength);
+
+		for (int j = 0; j < height; ++j) {
+			float py = minY + j * voxelSize;
+			int cy = (int)((py - minY) / smoothingLength);
+
+			for (int i = 0; i < width; ++i) {
+				float px = minX + i * voxelSize;
+				int cx = (int)((px - minX) / smoothingLength);
+
+				float density = 0.0f;
+				for (int z = cz - 1; z <= cz + 1; ++z) {
+					if (z < 0 || z >= cellsZ) continue;
+					for (int y = cy - 1; y <= cy + 1; ++y) {
+						if (y < 0 || y >= cellsY) continue;
+
+						// x方向に隣接する３セルの粒子は、連続して格納されている
+						int x0 = cx > 0 ? cx - 1 : 0;
+						int x1 = cx + 1 < cellsX ? cx + 1 : cellsX - 1;
+						int start = cellStart[(z * cellsY + y) * cellsX + x0];
+						int end = cellStart[(z * cellsY + y) * cellsX + x1 + 1];
+
+						for (int n = start; n < end; ++n) {
+							const Particle& p = sorted[n];
+							float dx = p.x - px;
+							float dy = p.y - py;
+							float dz = p.z - pz;
+							float r2 = dx * dx + dy * dy + dz * dz;
+							if (r2 < h2) {
+								density += p.mass * kernel(r2);
+							}
+						}
+					}
+				}
+
+				data[(k * height + j) * width + i] = density * densityScale;
+			}
+		}
+	}
+}
+
+/**
+ * 粒子を、影響半径を一辺とするセルに分類し、セル順に並べ替える（カウンティングソート）。
+ * スレッド毎に粒子の範囲を分担してセル毎の個数を数え、その累積和から各スレッドの書き込み位置を決めるので、
+ * アトミック演算を使わずに並列化できる。格子の外にある粒子は、端のセルに含める。
+ * 並列領域のスレッド数はomp_get_max_threadsより少ないことがあるので、実際のスレッド数で分担を決める。
+ *
+ * @param particles		粒子
+ */
+void ParticleSplatter::binParticles(const std::vector<Particle>& particles) {
+	int numParticles = particles.size();
+	int numCells = cellsX * cellsY * cellsZ;
+	int numThreads = 1;
+
+	std::vector<int> cellOf(numParticles);
+	std::vector<int> counts;
+	sorted.resize(numParticles);
+	cellStart.resize(numCells + 1);
+
+	#pragma omp parallel
+	{
+		// スレッド毎の個数の領域は、実際のスレッド数が分かってから確保する（singleの終わりで全スレッドが待つ）
+		#pragma omp single
+		{
+			numThreads = omp_get_num_threads();
+			counts.assign((size_t)numThreads * numCells, 0);
+		}
+
+		int t = omp_get_thread_num();
+		int begin = (int)((long long)numParticles * t / numThreads);
+		int end = (int)((long long)numParticles * (t + 1) / numThreads);
+		int* count = &counts[(size_t)t * numCells];
+
+		for (int n = begin; n < end; ++n) {
+			int cx = (int)floor((particles[n].x - minX) / smoothingLength);
+			int cy = (int)floor((particles[n].y - minY) / smoothingLength);
+			int cz = (int)floor((particles[n].z - minZ) / smoothingLength);
+			cx = cx < 0 ? 0 : (cx >= cellsX ? cellsX - 1 : cx);
+			cy = cy < 0 ? 0 : (cy >= cellsY ? cellsY - 1 : cy);
+			cz = cz < 0 ? 0 : (cz >= cellsZ ? cellsZ - 1 : cz);
+
+			cellOf[n] = (cz * cellsY + cy) * cellsX + cx;
+			count[cellOf[n]]++;
+		}
+
+		#pragma omp barrier
+
+		// セル毎、スレッド毎の書き込み開始位置を求める
+		#pragma omp single
+		{
+			int offset = 0;
+			for (int c = 0; c < numCells; ++c) {
+				cellStart[c] = offset;
+				for (int s = 0; s < numThreads; ++s) {
+					int num = counts[(size_t)s * numCells + c];
+					counts[(size_t)s * numCells + c] = offset;
+					offset += num;
+				}
+			}
+			cellStart[numCells] = offset;
+		}
+
+		for (int n = begin; n < end; ++n) {
+			sorted[count[cellOf[n]]++] = particles[n];
+		}
+	}
+}
+
+/**
+ * 3次元のcubic spline カーネル（Monaghan）を評価する。
+ *
+ * @param r2		粒子との距離の２乗
+ * @return			カーネルの値
+ */
+float ParticleSplatter::kernel(float r2) const {
+	float q = sqrt(r2) / smoothingLength;
+	float sigma = 8.0f / ((float)M_PI * smoothingLength * smoothingLength * smoothingLength);
+
+	if (q <= 0.5f) {
+		return sigma * (6.0f * (q * q * q - q * q) + 1.0f);
+	} else if (q <= 1.0f) {
+		float t = 1.0f - q;
+		return sigma * 2.0f * t * t * t;
+	} else {
+		return 0.0f;
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+
+class ParticleSplatter {
+public:
+	struct Particle {
+		float x;
+		float y;
+		float z;
+		float mass;
+	};
+
+private:
+	int width;
+	int height;
+	int depth;
+	float minX;
+	float minY;
+	float minZ;
+	float voxelSize;
+	float smoothingLength;
+	float densityScale;
+
+	int cellsX;
+	int cellsY;
+	int cellsZ;
+	std::vector<int> cellStart;
+	std::vector<Particle> sorted;
+
+public:
+	ParticleSplatter(int width, int height, int depth, float minX, float minY, float minZ, float voxelSize, float smoothingLength);
+
+	void setDensityScale(float scale) { densityScale = scale; }
+	void splat(const std::vector<Particle>& particles, float* data);
+
+private:
+	void binParticles(const std::vector<Particle>& particles);
+	float kernel(float r2) const;
+};
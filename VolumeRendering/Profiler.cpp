@@ -0,0 +1,280 @@
+﻿#include "Profiler.h"
+#include <stdio.h>
+#include <algorithm>
+#include <QMutexLocker>
+
+bool Profiler::enabled = false;
+QElapsedTimer Profiler::clock;
+QMutex Profiler::mutex;
+std::vector<Profiler::Event> Profiler::events;
+int Profiler::oldestEvent = 0;
+std::map<std::string, Profiler::Stage> Profiler::stages;
+std::map<Qt::HANDLE, int> Profiler::threads;
+int Profiler::droppedEvents = 0;
+
+std::vector<Profiler::GpuQuery> Profiler::gpuQueries[2];
+int Profiler::numGpuQueries[2] = { 0, 0 };
+long long Profiler::gpuOffset[2] = { 0, 0 };
+int Profiler::frameSlot = 0;
+int Profiler::droppedGpuQueries = 0;
+
+int Profiler::summaryFrames = 0;
+long long Profiler::lastSummary = 0;
+
+/**
+ * プロファイリングの有効／無効を切り替える。
+ * 無効な間は、ProfileScopeとGpuProfileScopeはフラグを見るだけで何もしないので、ほぼコストがかからない。
+ * 有効にした時は、前回のイベントを破棄して新しいトレースを始め、無効にした時は、それまでの集計を出力する。
+ *
+ * @param enabled	有効にする場合はtrue
+ */
+void Profiler::setEnabled(bool enabled) {
+	if (enabled == Profiler::enabled) return;
+
+	if (enabled) {
+		clear();
+		if (!clock.isValid()) clock.start();
+		lastSummary = now();
+		summaryFrames = 0;
+	} else {
+		printSummary();
+	}
+
+	// 無効な間に発行されたクエリは無いので、未回収のクエリは捨てる
+	numGpuQueries[0] = 0;
+	numGpuQueries[1] = 0;
+
+	Profiler::enabled = enabled;
+}
+
+/**
+ * プロファイラの時計の現在時刻を返却する。
+ *
+ * @return		現在時刻 [ns]
+ */
+long long Profiler::now() {
+	return clock.nsecsElapsed();
+}
+
+/**
+ * CPUのスコープの計測結果を記録する。
+ * 読み込みスレッドなどからも呼ばれるので、排他制御する。
+ *
+ * @param name		スコープ名（文字列リテラルなど、トレースを出力するまで有効なもの）
+ * @param start		開始時刻 [ns]
+ * @param end		終了時刻 [ns]
+ */
+void Profiler::addCpuEvent(const char* name, long long start, long long end) {
+	QMutexLocker locker(&mutex);
+
+	// スレッド毎にトレースの行を分ける（0はGPU）
+	Qt::HANDLE handle = QThread::currentThreadId();
+	std::map<Qt::HANDLE, int>::iterator it = threads.find(handle);
+	int thread;
+	if (it == threads.end()) {
+		thread = (int)threads.size() + 1;
+		threads[handle] = thread;
+	} else {
+		thread = it->second;
+	}
+
+	addEvent(name, thread, start, end - start);
+}
+
+/**
+ * GPUのスコープの開始時刻を記録するタイムスタンプクエリを発行する。
+ * クエリはフレーム毎に２組を交互に使い、結果は次に同じ組を使う時に回収するので、
+ * 結果を待ってパイプラインが止まることはない。
+ *
+ * @param name		スコープ名
+ * @return			endGpuQueryに渡すクエリの番号（GPUタイマーが使えない場合は-1）
+ */
+int Profiler::beginGpuQuery(const char* name) {
+	if (!GLEW_ARB_timer_query) return -1;
+
+	std::vector<GpuQuery>& queries = gpuQueries[frameSlot];
+	int index = numGpuQueries[frameSlot]++;
+	if (index == (int)queries.size()) {
+		GpuQuery query;
+		glGenQueries(2, query.queries);
+		queries.push_back(query);
+	}
+
+	queries[index].name = name;
+	glQueryCounter(queries[index].queries[0], GL_TIMESTAMP);
+
+	// 組の番号も含めておき、スコープの途中でフレームが切り替わっても正しいクエリを閉じる
+	return (frameSlot << 24) | index;
+}
+
+/**
+ * GPUのスコープの終了時刻を記録するタイムスタンプクエリを発行する。
+ *
+ * @param query		beginGpuQueryが返却したクエリの番号
+ */
+void Profiler::endGpuQuery(int query) {
+	std::vector<GpuQuery>& queries = gpuQueries[query >> 24];
+	int index = query & 0xffffff;
+	if (index >= (int)queries.size()) return;
+
+	glQueryCounter(queries[index].queries[1], GL_TIMESTAMP);
+}
+
+/**
+ * フレームの開始時に呼び出す。
+ * これから使う組のクエリは前々フレームに発行したものなので、その結果を回収してから再利用する。
+ * また、GPUの時刻をCPUの時計に合わせるためのオフセットを記録する。
+ */
+void Profiler::beginFrame() {
+	if (!enabled) return;
+
+	frameSlot = 1 - frameSlot;
+	if (GLEW_ARB_timer_query) {
+		collectGpuQueries(frameSlot);
+
+		GLint64 gpuNow;
+		glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+		gpuOffset[frameSlot] = now() - gpuNow;
+	}
+}
+
+/**
+ * フレームの終了時に呼び出す。
+ * SUMMARY_INTERVAL [ms]毎に、その間のステージ毎の集計を出力する。
+ */
+void Profiler::endFrame() {
+	if (!enabled) return;
+
+	summaryFrames++;
+	if (now() - lastSummary >= SUMMARY_INTERVAL * 1000000LL) {
+		printSummary();
+	}
+}
+
+/**
+ * 前回の出力以降の、ステージ毎の平均と最大の時間を出力し、集計をリセットする。
+ */
+void Profiler::printSummary() {
+	QMutexLocker locker(&mutex);
+
+	long long current = now();
+	double seconds = (current - lastSummary) / 1e9;
+	if (!stages.empty()) {
+		printf("Profile: %.1f s, %d frames, %.1f fps\n", seconds, summaryFrames, seconds > 0.0 ? summaryFrames / seconds : 0.0);
+		for (std::map<std::string, Stage>::iterator it = stages.begin(); it != stages.end(); ++it) {
+			printf("  %-28s avg %8.3f ms  max %8.3f ms  x%d\n", it->first.c_str(), it->second.total / 1e6 / it->second.count, it->second.max / 1e6, it->second.count);
+		}
+		if (droppedGpuQueries > 0) {
+			printf("  (%d GPU queries were not ready and dropped)\n", droppedGpuQueries);
+		}
+	}
+
+	stages.clear();
+	droppedGpuQueries = 0;
+	summaryFrames = 0;
+	lastSummary = current;
+}
+
+/**
+ * 記録したイベントを、Chromeのトレース形式（chrome://tracingやPerfettoで開けるJSON）で出力する。
+ * イベントはリングバッファに入っているので、古い順に並べ直して出力する。
+ *
+ * @param filename	出力ファイル名
+ * @return			出力できた場合はtrue
+ */
+bool Profiler::writeChromeTrace(const char* filename) {
+	QMutexLocker locker(&mutex);
+
+	FILE* fp = fopen(filename, "w");
+	if (fp == NULL) return false;
+
+	fprintf(fp, "{\"traceEvents\":[\n");
+	fprintf(fp, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"GPU\"}}", GPU_THREAD);
+	for (std::map<Qt::HANDLE, int>::iterator it = threads.begin(); it != threads.end(); ++it) {
+		fprintf(fp, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"CPU %d\"}}", it->second, it->second);
+	}
+	for (int i = 0; i < (int)events.size(); ++i) {
+		const Event& event = events[(oldestEvent + i) % events.size()];
+		fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}", event.name, event.thread == GPU_THREAD ? "gpu" : "cpu", event.thread, event.start / 1e3, event.duration / 1e3);
+	}
+	fprintf(fp, "\n]}\n");
+	fclose(fp);
+
+	printf("Wrote %d events to %s", (int)events.size(), filename);
+	if (droppedEvents > 0) {
+		printf(" (%d older events were overwritten to keep the last %d)", droppedEvents, MAX_EVENTS);
+	}
+	printf("\n");
+
+	return true;
+}
+
+/**
+ * 記録したイベントと集計を全て破棄する。
+ */
+void Profiler::clear() {
+	QMutexLocker locker(&mutex);
+
+	events.clear();
+	oldestEvent = 0;
+	stages.clear();
+	droppedEvents = 0;
+	droppedGpuQueries = 0;
+}
+
+/**
+ * イベントをトレースと集計に追加する。
+ * トレースは最新のMAX_EVENTS個だけを残すリングバッファで、一杯の場合は最も古いイベントを上書きする。
+ * 呼び出し側で排他制御すること。
+ *
+ * @param name		スコープ名
+ * @param thread	トレースの行（0はGPU）
+ * @param start		開始時刻 [ns]
+ * @param duration	時間 [ns]
+ */
+void Profiler::addEvent(const char* name, int thread, long long start, long long duration) {
+	Event event;
+	event.name = name;
+	event.thread = thread;
+	event.start = start;
+	event.duration = duration;
+	if ((int)events.size() < MAX_EVENTS) {
+		events.push_back(event);
+	} else {
+		events[oldestEvent] = event;
+		oldestEvent = (oldestEvent + 1) % MAX_EVENTS;
+		droppedEvents++;
+	}
+
+	Stage& stage = stages[std::string(thread == GPU_THREAD ? "gpu " : "cpu ") + name];
+	stage.total += duration;
+	stage.max = std::max(stage.max, duration);
+	stage.count++;
+}
+
+/**
+ * 指定した組のGPUのクエリの結果を回収する。
+ * まだ結果が出ていないクエリは、待たずに捨てる。
+ *
+ * @param slot	組の番号
+ */
+void Profiler::collectGpuQueries(int slot) {
+	QMutexLocker locker(&mutex);
+
+	std::vector<GpuQuery>& queries = gpuQueries[slot];
+	for (int i = 0; i < numGpuQueries[slot]; ++i) {
+		GLint available = 0;
+		glGetQueryObjectiv(queries[i].queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) {
+			droppedGpuQueries++;
+			continue;
+		}
+
+		GLuint64 start, end;
+		glGetQueryObjectui64v(queries[i].queries[0], GL_QUERY_RESULT, &start);
+		glGetQueryObjectui64v(queries[i].queries[1], GL_QUERY_RESULT, &end);
+		addEvent(queries[i].name, GPU_THREAD, (long long)start + gpuOffset[slot], (long long)(end - start));
+	}
+
+	numGpuQueries[slot] = 0;
+}
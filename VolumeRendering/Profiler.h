@@ -0,0 +1,98 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <vector>
+#include <map>
+#include <string>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QThread>
+
+#define PROFILE_CONCAT_IMPL(a, b)	a##b
+#define PROFILE_CONCAT(a, b)		PROFILE_CONCAT_IMPL(a, b)
+#define PROFILE_SCOPE(name)			ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_GPU_SCOPE(name)		GpuProfileScope PROFILE_CONCAT(gpuProfileScope, __LINE__)(name)
+
+class Profiler {
+public:
+	static const int GPU_THREAD = 0;
+	static const int MAX_EVENTS = 1000000;
+	static const int SUMMARY_INTERVAL = 1000;
+
+private:
+	struct Event {
+		const char* name;
+		int thread;
+		long long start;
+		long long duration;
+	};
+
+	struct Stage {
+		long long total;
+		long long max;
+		int count;
+	};
+
+	struct GpuQuery {
+		const char* name;
+		GLuint queries[2];
+	};
+
+	static bool enabled;
+	static QElapsedTimer clock;
+	static QMutex mutex;
+	static std::vector<Event> events;
+	static int oldestEvent;
+	static std::map<std::string, Stage> stages;
+	static std::map<Qt::HANDLE, int> threads;
+	static int droppedEvents;
+
+	static std::vector<GpuQuery> gpuQueries[2];
+	static int numGpuQueries[2];
+	static long long gpuOffset[2];
+	static int frameSlot;
+	static int droppedGpuQueries;
+
+	static int summaryFrames;
+	static long long lastSummary;
+
+protected:
+	Profiler() {}
+
+public:
+	static void setEnabled(bool enabled);
+	static bool isEnabled() { return enabled; }
+	static long long now();
+	static void addCpuEvent(const char* name, long long start, long long end);
+	static int beginGpuQuery(const char* name);
+	static void endGpuQuery(int query);
+	static void beginFrame();
+	static void endFrame();
+	static void printSummary();
+	static bool writeChromeTrace(const char* filename);
+	static void clear();
+
+private:
+	static void addEvent(const char* name, int thread, long long start, long long duration);
+	static void collectGpuQueries(int slot);
+};
+
+class ProfileScope {
+private:
+	const char* name;
+	long long start;
+
+public:
+	ProfileScope(const char* name) : name(name), start(Profiler::isEnabled() ? Profiler::now() : -1) {}
+	~ProfileScope() { if (start >= 0) Profiler::addCpuEvent(name, start, Profiler::now()); }
+};
+
+class GpuProfileScope {
+private:
+	int query;
+
+public:
+	GpuProfileScope(const char* name) : query(Profiler::isEnabled() ? Profiler::beginGpuQuery(name) : -1) {}
+	~GpuProfileScope() { if (query >= 0) Profiler::endGpuQuery(query); }
+};
+
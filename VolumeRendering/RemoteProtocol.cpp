@@ -0,0 +1,52 @@
+﻿#include "RemoteProtocol.h"
+#include <QDataStream>
+
+/**
+ * メッセージの長さ（4バイト）に続けてメッセージを送り、送り終わるまで待つ。
+ * サーバーもクライアントもイベントループを回さないので、ここで送信を完了させる。
+ * メッセージの最初の1バイトは、MESSAGE_CAMERAなどの種類である。
+ *
+ * @param socket	ソケット
+ * @param message	メッセージ
+ * @return			送れた場合はtrue
+ */
+bool RemoteProtocol::writeMessage(QTcpSocket* socket, const QByteArray& message) {
+	QByteArray header;
+	QDataStream out(&header, QIODevice::WriteOnly);
+	out << (quint32)message.size();
+
+	socket->write(header);
+	socket->write(message);
+	while (socket->bytesToWrite() > 0) {
+		if (!socket->waitForBytesWritten(WRITE_TIMEOUT)) return false;
+	}
+
+	return true;
+}
+
+/**
+ * 受信済みのデータから、メッセージを１つ取り出す。待たないので、メッセージが全て届いていなければfalseを返却する。
+ * 長さが不正なメッセージを受け取った場合は、以降のデータの区切りがわからないので接続を切る。
+ *
+ * @param socket		ソケット
+ * @param message [OUT]	メッセージ
+ * @return				メッセージを取り出せた場合はtrue
+ */
+bool RemoteProtocol::readMessage(QTcpSocket* socket, QByteArray& message) {
+	if (socket->bytesAvailable() < 4) return false;
+
+	QByteArray header = socket->peek(4);
+	QDataStream in(header);
+	quint32 size;
+	in >> size;
+	if (size > (quint32)MAX_MESSAGE_SIZE) {
+		socket->abort();
+		return false;
+	}
+	if (socket->bytesAvailable() < 4 + (qint64)size) return false;
+
+	socket->read(4);
+	message = socket->read(size);
+
+	return true;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <QByteArray>
+#include <QTcpSocket>
+
+class RemoteProtocol {
+public:
+	enum { MESSAGE_CAMERA = 1, MESSAGE_ACK, MESSAGE_FRAME };
+
+	static const int DEFAULT_PORT = 7227;
+	static const int MAX_MESSAGE_SIZE = 64 * 1024 * 1024;
+	static const int WRITE_TIMEOUT = 5000;
+
+protected:
+	RemoteProtocol() {}
+
+public:
+	static bool writeMessage(QTcpSocket* socket, const QByteArray& message);
+	static bool readMessage(QTcpSocket* socket, QByteArray& message);
+};
+
@@ -0,0 +1,124 @@
+﻿#include "RenderClient.h"
+#include <GL/glew.h>
+#include <iostream>
+#include <stdio.h>
+#include <vector>
+#include <algorithm>
+#include <QTcpSocket>
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QImage>
+#include "Camera.h"
+#include "TileCodec.h"
+#include "RemoteProtocol.h"
+
+// マウスの操作の代わりに、カメラを送るレート [Hz]
+#define CAMERA_UPDATE_RATE	60
+
+// カメラがY軸の周りを一周する時間 [s]
+#define ORBIT_PERIOD		8.0f
+
+// 接続を待つ時間 [ms]
+#define CONNECT_TIMEOUT		5000
+
+/**
+ * 遅延を測るための最小限のクライアント。
+ * マウスで操作する代わりに、カメラをY軸の周りに回しながらCAMERA_UPDATE_RATEで送り、届いたフレームを復元して受け取りを返す。
+ * 各フレームについて、そのフレームのきっかけになったカメラを送ってから復元し終わるまでの時間を遅延として集計し、
+ * 終了時にフレームレート、帯域、遅延の分布、サーバーでの描画と符号化の時間を出力する。
+ *
+ * @param host		サーバーのホスト名
+ * @param port		サーバーのポート番号
+ * @param seconds	測定する時間 [s]
+ * @param output	最後に受け取ったフレームを保存するファイル名（NULLなら保存しない）
+ * @return			接続できた場合はtrue
+ */
+bool RenderClient::run(const char* host, int port, float seconds, const char* output) {
+	QTcpSocket socket;
+	socket.connectToHost(host, port);
+	if (!socket.waitForConnected(CONNECT_TIMEOUT)) {
+		std::cout << "Unable to connect to " << host << ":" << port << ": " << socket.errorString().toStdString() << std::endl;
+		return false;
+	}
+	socket.setSocketOption(QAbstractSocket::LowDelayOption, 1);
+
+	QElapsedTimer clock;
+	clock.start();
+
+	Camera camera;
+	QImage frame;
+	quint32 sequence = 0;
+	double nextUpdate = 0.0;
+	std::vector<double> latencies;
+	long long totalBytes = 0;
+	double totalRender = 0.0;
+	double totalEncode = 0.0;
+	long long totalTiles = 0;
+	int corruptFrames = 0;
+
+	while (clock.elapsed() < seconds * 1000.0f && socket.state() == QAbstractSocket::ConnectedState) {
+		QByteArray message;
+		while (RemoteProtocol::readMessage(&socket, message)) {
+			QDataStream in(message);
+			quint8 type;
+			in >> type;
+			if (type != RemoteProtocol::MESSAGE_FRAME) continue;
+
+			quint32 frameIndex, frameSequence, renderMicros, encodeMicros, numTiles;
+			qint64 sentTime;
+			QByteArray tiles;
+			in >> frameIndex >> frameSequence >> sentTime >> renderMicros >> encodeMicros >> numTiles >> tiles;
+			if (!TileCodec::decode(tiles, frame)) {
+				corruptFrames++;
+			}
+
+			// 復元し終わった時点を、表示できる時点とする
+			latencies.push_back((clock.nsecsElapsed() - sentTime) / 1e6);
+			totalBytes += message.size();
+			totalRender += renderMicros / 1000.0;
+			totalEncode += encodeMicros / 1000.0;
+			totalTiles += numTiles;
+
+			QByteArray ack;
+			QDataStream out(&ack, QIODevice::WriteOnly);
+			out << (quint8)RemoteProtocol::MESSAGE_ACK << frameIndex;
+			RemoteProtocol::writeMessage(&socket, ack);
+		}
+
+		if (clock.elapsed() >= nextUpdate) {
+			camera.setYRotation(360.0f * clock.elapsed() / 1000.0f / ORBIT_PERIOD);
+
+			QByteArray update;
+			QDataStream out(&update, QIODevice::WriteOnly);
+			out << (quint8)RemoteProtocol::MESSAGE_CAMERA << sequence++ << (qint64)clock.nsecsElapsed();
+			out << camera.xrot << camera.yrot << camera.zrot << camera.dx << camera.dy << camera.dz << camera.lookAtX << camera.lookAtY << camera.lookAtZ;
+			RemoteProtocol::writeMessage(&socket, update);
+
+			nextUpdate += 1000.0 / CAMERA_UPDATE_RATE;
+		}
+
+		socket.waitForReadyRead(std::max((int)(nextUpdate - clock.elapsed()), 1));
+	}
+
+	double elapsed = clock.elapsed() / 1000.0;
+	socket.disconnectFromHost();
+
+	int frames = latencies.size();
+	printf("Sent %u camera updates, received %d frames in %.1f s (%.1f fps)\n", sequence, frames, elapsed, frames / elapsed);
+	if (frames > 0) {
+		std::sort(latencies.begin(), latencies.end());
+		double sum = 0.0;
+		for (int i = 0; i < frames; ++i) sum += latencies[i];
+		printf("  latency: avg %.2f ms, median %.2f ms, 95%% %.2f ms, max %.2f ms\n", sum / frames, latencies[frames / 2], latencies[std::min((int)(frames * 0.95), frames - 1)], latencies[frames - 1]);
+		printf("  server: render %.2f ms, encode %.2f ms\n", totalRender / frames, totalEncode / frames);
+		printf("  stream: %.1f KB per frame, %.2f MB/s, %.1f tiles per frame", totalBytes / 1024.0 / frames, totalBytes / 1048576.0 / elapsed, (double)totalTiles / frames);
+		if (corruptFrames > 0) printf(", %d frames could not be decoded", corruptFrames);
+		printf("\n");
+	}
+
+	if (output != NULL && !frame.isNull()) {
+		frame.save(output);
+	}
+
+	return true;
+}
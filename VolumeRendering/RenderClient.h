@@ -0,0 +1,10 @@
+#pragma once
+
+class RenderClient {
+protected:
+	RenderClient() {}
+
+public:
+	static bool run(const char* host, int port, float seconds, const char* output);
+};
+
@@ -0,0 +1,212 @@
+﻿#include "RenderServer.h"
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <QTcpServer>
+#include <QHostAddress>
+#include <QDataStream>
+#include <QElapsedTimer>
+#include "Util.h"
+#include "Profiler.h"
+#include "TileCodec.h"
+#include "RemoteProtocol.h"
+
+// フレームを送る最大のレート [fps]
+#define MAX_FRAME_RATE			60
+
+// クライアントが受け取りを確認していないフレームの最大数
+// これ以上は描画せずに待ち、その間に届いたカメラは最新のものだけを使うので、遅延が溜まらない
+#define MAX_FRAMES_IN_FLIGHT	2
+
+// 次のフレームを描画できない間に、切断を確かめる間隔 [ms]
+#define IDLE_TIMEOUT			100
+
+RenderServer::RenderServer() {
+	backend = BACKEND_GPU;
+	width = 0;
+	height = 0;
+	offscreen = NULL;
+	raycaster = NULL;
+	volumeData = NULL;
+}
+
+RenderServer::~RenderServer() {
+	delete offscreen;
+	delete raycaster;
+	delete [] volumeData;
+}
+
+/**
+ * VTKファイルを読み込み、指定したバックエンドで描画できるようにする。
+ * GPUのバックエンドはOffscreenRendererで、CPUのバックエンドはCpuRaycasterで描画する。
+ *
+ * @param filename	ファイル名
+ * @param width		フレームの幅
+ * @param height	フレームの高さ
+ * @param backend	BACKEND_GPUまたはBACKEND_CPU
+ * @return			準備できた場合はtrue
+ */
+bool RenderServer::create(char* filename, int width, int height, int backend) {
+	this->width = width;
+	this->height = height;
+	this->backend = backend;
+
+	if (backend == BACKEND_GPU) {
+		offscreen = new OffscreenRenderer();
+		return offscreen->create(width, height) && offscreen->loadVTK(filename);
+	}
+
+	int gridWidth, gridHeight, gridDepth;
+	VolumeHistogram histogram;
+	if (!Util::loadVTK(filename, gridWidth, gridHeight, gridDepth, &volumeData, &histogram)) {
+		std::cout << "Unable to load " << filename << std::endl;
+		return false;
+	}
+
+	float windowMin, windowMax;
+	histogram.getAutoWindow(windowMin, windowMax);
+	raycaster = new CpuRaycaster(gridWidth, gridHeight, gridDepth, volumeData);
+	raycaster->setWindow(windowMin, windowMax);
+
+	return true;
+}
+
+/**
+ * ローカルホストのポートで接続を待ち、クライアントを１つずつ処理する。
+ * クライアントが切断したら、次の接続を待つ。
+ *
+ * @param port	ポート番号
+ * @return		待ち受けられなかった場合はfalse（それ以外は戻らない）
+ */
+bool RenderServer::run(int port) {
+	QTcpServer server;
+	if (!server.listen(QHostAddress::LocalHost, port)) {
+		std::cout << "Unable to listen on port " << port << ": " << server.errorString().toStdString() << std::endl;
+		return false;
+	}
+	printf("Listening on port %d (%dx%d, %s)\n", port, width, height, backend == BACKEND_GPU ? "GPU" : "CPU");
+
+	while (true) {
+		if (!server.waitForNewConnection(-1)) continue;
+
+		QTcpSocket* socket = server.nextPendingConnection();
+		socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+		printf("Client connected from %s\n", socket->peerAddress().toString().toStdString().c_str());
+		serve(socket);
+		delete socket;
+	}
+
+	return true;
+}
+
+/**
+ * １つのクライアントから受け取ったカメラで描画し、フレームを送り返す。
+ * フレームは前回送ったフレームからの差分として符号化し、接続直後の最初のフレームだけキーフレームとする。
+ * フレームのペースは、最大のレートと、受け取りが確認されていないフレームの数で制限する。
+ * 待っている間に届いたカメラは、最新のものだけを描画する。
+ * フレームには、描画のきっかけになったカメラの番号と、クライアントの時刻をそのまま返すので、
+ * クライアントは操作してから表示するまでの遅延を測れる。
+ *
+ * @param socket	クライアントのソケット
+ */
+void RenderServer::serve(QTcpSocket* socket) {
+	QElapsedTimer clock;
+	clock.start();
+
+	QImage reference;
+	bool dirty = false;
+	quint32 sequence = 0;
+	qint64 clientTime = 0;
+	quint32 sentFrames = 0;
+	quint32 ackedFrames = 0;
+	int cameraUpdates = 0;
+	long long nextFrame = 0;
+	long long totalBytes = 0;
+	double totalRender = 0.0;
+	double totalEncode = 0.0;
+
+	while (socket->state() == QAbstractSocket::ConnectedState) {
+		QByteArray message;
+		while (RemoteProtocol::readMessage(socket, message)) {
+			QDataStream in(message);
+			quint8 type;
+			in >> type;
+			if (type == RemoteProtocol::MESSAGE_CAMERA) {
+				in >> sequence >> clientTime;
+				in >> camera.xrot >> camera.yrot >> camera.zrot >> camera.dx >> camera.dy >> camera.dz >> camera.lookAtX >> camera.lookAtY >> camera.lookAtZ;
+				dirty = true;
+				cameraUpdates++;
+			} else if (type == RemoteProtocol::MESSAGE_ACK) {
+				quint32 frame;
+				in >> frame;
+				ackedFrames = std::min(std::max(ackedFrames, frame + 1), sentFrames);
+			}
+		}
+
+		long long now = clock.elapsed();
+		if (!dirty || sentFrames - ackedFrames >= MAX_FRAMES_IN_FLIGHT || now < nextFrame) {
+			int timeout = dirty && now < nextFrame ? (int)(nextFrame - now) : IDLE_TIMEOUT;
+			socket->waitForReadyRead(timeout);
+			continue;
+		}
+
+		PROFILE_SCOPE("serveFrame");
+		nextFrame = now + 1000 / MAX_FRAME_RATE;
+		dirty = false;
+
+		long long start = clock.nsecsElapsed();
+		QImage image;
+		renderFrame(image);
+		long long rendered = clock.nsecsElapsed();
+		QByteArray tiles;
+		int numTiles = TileCodec::encode(image, reference, sentFrames == 0, tiles);
+		long long encoded = clock.nsecsElapsed();
+
+		QByteArray frame;
+		QDataStream out(&frame, QIODevice::WriteOnly);
+		out << (quint8)RemoteProtocol::MESSAGE_FRAME << sentFrames << sequence << clientTime;
+		out << (quint32)((rendered - start) / 1000) << (quint32)((encoded - rendered) / 1000) << (quint32)numTiles << tiles;
+		if (!RemoteProtocol::writeMessage(socket, frame)) break;
+
+		sentFrames++;
+		totalBytes += frame.size();
+		totalRender += (rendered - start) / 1e6;
+		totalEncode += (encoded - rendered) / 1e6;
+	}
+
+	double seconds = clock.elapsed() / 1000.0;
+	printf("Client disconnected: %u frames for %d camera updates in %.1f s", sentFrames, cameraUpdates, seconds);
+	if (sentFrames > 0) {
+		printf(", render %.2f ms, encode %.2f ms, %.1f KB per frame", totalRender / sentFrames, totalEncode / sentFrames, totalBytes / 1024.0 / sentFrames);
+	}
+	printf("\n");
+}
+
+/**
+ * 現在のカメラでフレームを描画する。
+ * GPUの描画結果は不透明度を掛けた色なので、アルファを捨てれば黒の背景に合成したことになる。
+ *
+ * @param image [OUT]	描画したフレーム（Format_RGB32）
+ */
+void RenderServer::renderFrame(QImage& image) {
+	if (backend == BACKEND_CPU) {
+		QMatrix4x4 projection;
+		projection.perspective(45, (float)width / height, 0.1, 10000);
+		raycaster->render(camera.getModelviewMatrix(), projection, width, height, image);
+		return;
+	}
+
+	offscreen->camera = camera;
+	QImage rendered;
+	offscreen->render(rendered);
+
+	image = QImage(width, height, QImage::Format_RGB32);
+	for (int y = 0; y < height; ++y) {
+		const QRgb* src = (const QRgb*)rendered.scanLine(y);
+		QRgb* dst = (QRgb*)image.scanLine(y);
+		for (int x = 0; x < width; ++x) {
+			dst[x] = src[x] | 0xff000000;
+		}
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <QImage>
+#include <QTcpSocket>
+#include "Camera.h"
+#include "OffscreenRenderer.h"
+#include "CpuRaycaster.h"
+
+class RenderServer {
+public:
+	enum { BACKEND_GPU = 0, BACKEND_CPU };
+
+private:
+	int backend;
+	int width;
+	int height;
+	Camera camera;
+	OffscreenRenderer* offscreen;
+	CpuRaycaster* raycaster;
+	float* volumeData;
+
+public:
+	RenderServer();
+	~RenderServer();
+
+	bool create(char* filename, int width, int height, int backend);
+	bool run(int port);
+
+private:
+	void serve(QTcpSocket* socket);
+	void renderFrame(QImage& image);
+};
+
@@ -0,0 +1,103 @@
+﻿#include "SequenceRenderer.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QMutexLocker>
+#include <omp.h>
+#include "Profiler.h"
+
+/**
+ * ワーカースレッドで1フレームを描画し、PNGファイルに保存するタスク。
+ * フレーム単位で既にプールのスレッドに分けているので、CpuRaycaster::renderのOpenMPのスレッドは1つに制限し、
+ * フレームのタイルは、このタスクのスレッドが順に描画する。
+ * レイの統計は、描画が終わった後で全体の合計に加える。
+ */
+class SequenceFrameTask : public QRunnable {
+private:
+	const CpuRaycaster& raycaster;
+	QMatrix4x4 modelview;
+	QMatrix4x4 projection;
+	int width;
+	int height;
+	std::string filename;
+	VolumeRendering::RayStatistics& total;
+	QMutex& mutex;
+
+public:
+	SequenceFrameTask(const CpuRaycaster& raycaster, const QMatrix4x4& modelview, const QMatrix4x4& projection, int width, int height, const std::string& filename, VolumeRendering::RayStatistics& total, QMutex& mutex) : raycaster(raycaster), modelview(modelview), projection(projection), width(width), height(height), filename(filename), total(total), mutex(mutex) {}
+
+	void run() {
+		PROFILE_SCOPE("sequenceFrame");
+
+		// プールのスレッド毎にOpenMPのスレッドを作ると、コア数を大きく超えてしまう
+		omp_set_num_threads(1);
+
+		QImage image;
+		VolumeRendering::RayStatistics stats;
+		raycaster.render(modelview, projection, width, height, image, &stats);
+		if (!image.save(filename.c_str(), "PNG")) {
+			printf("Unable to write %s\n", filename.c_str());
+		}
+
+		QMutexLocker locker(&mutex);
+		total.rays += stats.rays;
+		total.iterations += stats.iterations;
+		total.samples += stats.samples;
+		total.lightSteps += stats.lightSteps;
+		total.terminated += stats.terminated;
+		total.maxCost = std::max(total.maxCost, stats.maxCost);
+	}
+};
+
+/**
+ * カメラのパスに沿って、fps毎秒のフレームをCPUで描画し、prefix_00000.pngから順に番号を付けて保存する。
+ * フレームは互いに独立なので、フレーム単位でスレッドプールのワーカーに割り当てる。
+ * 全てのフレームが終わるまで待ち、全体のフレームレートと、全フレームのレイの統計を出力する。
+ *
+ * @param raycaster	描画に使うレイキャスター
+ * @param path		カメラのパス
+ * @param fps		1秒あたりのフレーム数
+ * @param width		画像の幅
+ * @param height	画像の高さ
+ * @param prefix	出力ファイル名の接頭辞
+ * @return			描画したフレーム数
+ */
+int SequenceRenderer::render(const CpuRaycaster& raycaster, const CameraPath& path, float fps, int width, int height, const std::string& prefix) {
+	if (path.numKeyframes() == 0 || fps <= 0.0f || width <= 0 || height <= 0) return 0;
+
+	int numFrames = (int)(path.getDuration() * fps) + 1;
+
+	// GLWidget3D::resizeGLのgluPerspectiveと同じ投影
+	QMatrix4x4 projection;
+	projection.perspective(45, (float)width / height, 0.1, 10000);
+
+	VolumeRendering::RayStatistics stats;
+	memset(&stats, 0, sizeof(stats));
+	QMutex mutex;
+
+	QThreadPool pool;
+	QElapsedTimer clock;
+	clock.start();
+
+	for (int i = 0; i < numFrames; ++i) {
+		Camera camera;
+		path.evaluate(i / fps, camera);
+
+		char suffix[16];
+		sprintf(suffix, "_%05d.png", i);
+		pool.start(new SequenceFrameTask(raycaster, camera.getModelviewMatrix(), projection, width, height, prefix + suffix, stats, mutex));
+	}
+	pool.waitForDone();
+
+	double seconds = clock.elapsed() / 1000.0;
+	printf("Rendered %d frames (%dx%d) with %d threads in %.2f s, %.2f fps\n", numFrames, width, height, pool.maxThreadCount(), seconds, seconds > 0.0 ? numFrames / seconds : 0.0);
+	if (stats.rays > 0) {
+		printf("Rays: %d, per ray: %.1f iterations, %.1f samples, %.1f light steps, terminated %.1f%%, max cost %.0f, total %.0f samples\n", stats.rays, stats.iterations / stats.rays, stats.samples / stats.rays, stats.lightSteps / stats.rays, stats.terminated * 100.0 / stats.rays, stats.maxCost, stats.samples + stats.lightSteps);
+	}
+
+	return numFrames;
+}
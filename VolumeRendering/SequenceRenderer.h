@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+#include "CpuRaycaster.h"
+#include "CameraPath.h"
+
+class SequenceRenderer {
+protected:
+	SequenceRenderer() {}
+
+public:
+	static int render(const CpuRaycaster& raycaster, const CameraPath& path, float fps, int width, int height, const std::string& prefix);
+};
+
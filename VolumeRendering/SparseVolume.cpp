@@ -0,0 +1,132 @@
+﻿#include "SparseVolume.h"
+#include <math.h>
+
+SparseVolume::SparseVolume() {
+	width = 0;
+	height = 0;
+	depth = 0;
+	bricksX = 0;
+	bricksY = 0;
+	bricksZ = 0;
+	numOccupied = 0;
+	slotsX = 0;
+	slotsY = 0;
+	slotsZ = 0;
+}
+
+/**
+ * 3Dデータを、BRICK_SIZE^3のブリックに分割し、thresholdより大きい値を含むブリックだけを
+ * アトラスに詰めて格納する。空のブリックはインデックステーブル上で-1となり、メモリを消費しない。
+ * 各ブリックは、隣のブリックとの間を正しく補間できるように、周囲1ボクセル分の境界を含めて格納する。
+ * ブリックの判定とアトラスへのコピーは、ブリック単位で全コアに分散して行う。
+ *
+ * @param width				幅
+ * @param height			高さ
+ * @param depth				奥行き
+ * @param data				3Dデータ
+ * @param threshold			空とみなす値の上限
+ * @param maxTextureSize	アトラスの各辺の最大サイズ（GL_MAX_3D_TEXTURE_SIZE）
+ */
+void SparseVolume::build(int width, int height, int depth, const float* data, float threshold, int maxTextureSize) {
+	this->width = width;
+	this->height = height;
+	this->depth = depth;
+	bricksX = (width + BRICK_SIZE - 1) / BRICK_SIZE;
+	bricksY = (height + BRICK_SIZE - 1) / BRICK_SIZE;
+	bricksZ = (depth + BRICK_SIZE - 1) / BRICK_SIZE;
+	int numBricks = bricksX * bricksY * bricksZ;
+
+	// 境界を含めて、thresholdより大きい値があるブリックを探す
+	std::vector<char> occupied(numBricks);
+	#pragma omp parallel for schedule(dynamic)
+	for (int brick = 0; brick < numBricks; ++brick) {
+		int x0 = (brick % bricksX) * BRICK_SIZE - 1;
+		int y0 = (brick / bricksX % bricksY) * BRICK_SIZE - 1;
+		int z0 = (brick / bricksX / bricksY) * BRICK_SIZE - 1;
+
+		bool found = false;
+		for (int z = z0 < 0 ? 0 : z0; z < z0 + SLOT_SIZE && z < depth && !found; ++z) {
+			for (int y = y0 < 0 ? 0 : y0; y < y0 + SLOT_SIZE && y < height && !found; ++y) {
+				for (int x = x0 < 0 ? 0 : x0; x < x0 + SLOT_SIZE && x < width; ++x) {
+					if (data[(z * height + y) * width + x] > threshold) {
+						found = true;
+						break;
+					}
+				}
+			}
+		}
+		occupied[brick] = found ? 1 : 0;
+	}
+
+	// 占有されたブリックに、アトラス内のスロットを割り当てる
+	brickSlots.resize(numBricks);
+	numOccupied = 0;
+	for (int brick = 0; brick < numBricks; ++brick) {
+		brickSlots[brick] = occupied[brick] ? numOccupied++ : -1;
+	}
+
+	// アトラスは、各辺がmaxTextureSizeを超えない範囲で立方体に近い形にする
+	int maxSlots = maxTextureSize / SLOT_SIZE;
+	slotsX = (int)ceil(pow((double)(numOccupied > 0 ? numOccupied : 1), 1.0 / 3.0));
+	if (slotsX > maxSlots) slotsX = maxSlots;
+	slotsY = slotsX;
+	slotsZ = (numOccupied + slotsX * slotsY - 1) / (slotsX * slotsY);
+	if (slotsZ < 1) slotsZ = 1;
+
+	atlas.assign((size_t)getAtlasWidth() * getAtlasHeight() * getAtlasDepth(), 0.0f);
+
+	#pragma omp parallel for schedule(dynamic)
+	for (int brick = 0; brick < numBricks; ++brick) {
+		if (brickSlots[brick] < 0) continue;
+
+		int x0 = (brick % bricksX) * BRICK_SIZE - 1;
+		int y0 = (brick / bricksX % bricksY) * BRICK_SIZE - 1;
+		int z0 = (brick / bricksX / bricksY) * BRICK_SIZE - 1;
+
+		for (int k = 0; k < SLOT_SIZE; ++k) {
+			int z = z0 + k < 0 ? 0 : (z0 + k >= depth ? depth - 1 : z0 + k);
+			for (int j = 0; j < SLOT_SIZE; ++j) {
+				int y = y0 + j < 0 ? 0 : (y0 + j >= height ? height - 1 : y0 + j);
+				float* dst = &atlas[atlasIndex(brickSlots[brick], 0, j, k)];
+				for (int i = 0; i < SLOT_SIZE; ++i) {
+					int x = x0 + i < 0 ? 0 : (x0 + i >= width ? width - 1 : x0 + i);
+					dst[i] = data[(z * height + y) * width + x];
+				}
+			}
+		}
+	}
+}
+
+/**
+ * シェーダで使うインデックステーブル（GL_RGBA16UI）を作成する。
+ * 各ブリックについて、アトラス内のスロットの座標(x, y, z)と、占有されているか(w)を格納する。
+ *
+ * @param table [OUT]	インデックステーブル（ブリック毎に4要素）
+ */
+void SparseVolume::getIndirectionTable(std::vector<unsigned short>& table) const {
+	table.resize(brickSlots.size() * 4);
+	for (int brick = 0; brick < (int)brickSlots.size(); ++brick) {
+		int slot = brickSlots[brick];
+		table[brick * 4 + 0] = slot >= 0 ? slot % slotsX : 0;
+		table[brick * 4 + 1] = slot >= 0 ? slot / slotsX % slotsY : 0;
+		table[brick * 4 + 2] = slot >= 0 ? slot / slotsX / slotsY : 0;
+		table[brick * 4 + 3] = slot >= 0 ? 1 : 0;
+	}
+}
+
+/**
+ * アトラス内の、指定したスロットの(x, y, z)の位置のインデックスを返却する。
+ *
+ * @param slot		スロット
+ * @param x			スロット内のx座標（境界を含めて0〜SLOT_SIZE-1）
+ * @param y			スロット内のy座標
+ * @param z			スロット内のz座標
+ * @return			アトラス内のインデックス
+ */
+int SparseVolume::atlasIndex(int slot, int x, int y, int z) const {
+	int ax = (slot % slotsX) * SLOT_SIZE + x;
+	int ay = (slot / slotsX % slotsY) * SLOT_SIZE + y;
+	int az = (slot / slotsX / slotsY) * SLOT_SIZE + z;
+
+	return (az * getAtlasHeight() + ay) * getAtlasWidth() + ax;
+}
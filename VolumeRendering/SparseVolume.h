@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+
+class SparseVolume {
+public:
+	static const int BRICK_SIZE = 8;
+	static const int SLOT_SIZE = BRICK_SIZE + 2;
+
+private:
+	int width;
+	int height;
+	int depth;
+	int bricksX;
+	int bricksY;
+	int bricksZ;
+
+	std::vector<int> brickSlots;
+	int numOccupied;
+	int slotsX;
+	int slotsY;
+	int slotsZ;
+	std::vector<float> atlas;
+
+public:
+	SparseVolume();
+
+	void build(int width, int height, int depth, const float* data, float threshold, int maxTextureSize = 2048);
+
+	int getBricksX() const { return bricksX; }
+	int getBricksY() const { return bricksY; }
+	int getBricksZ() const { return bricksZ; }
+	int getNumOccupied() const { return numOccupied; }
+	int getAtlasWidth() const { return slotsX * SLOT_SIZE; }
+	int getAtlasHeight() const { return slotsY * SLOT_SIZE; }
+	int getAtlasDepth() const { return slotsZ * SLOT_SIZE; }
+	const float* getAtlas() const { return atlas.empty() ? 0 : &atlas[0]; }
+	void getIndirectionTable(std::vector<unsigned short>& table) const;
+
+private:
+	int atlasIndex(int slot, int x, int y, int z) const;
+};
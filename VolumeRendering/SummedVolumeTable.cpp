@@ -0,0 +1,115 @@
+﻿#include "SummedVolumeTable.h"
+
+SummedVolumeTable::SummedVolumeTable() {
+	width = 0;
+	height = 0;
+	depth = 0;
+}
+
+/**
+ * 3Dデータの累積和テーブルを作成する。
+ * table(x, y, z)は、[0, x) x [0, y) x [0, z)の範囲の値の合計で、各軸の先頭に0の面を1枚ずつ持つ。
+ * X、Y、Zの順に1次元の累積和を取ればよく、各パスのラインは独立なので、全コアで並列に処理する。
+ * 大きなボリュームでも桁落ちしないように、倍精度で保持する（ボクセル毎に8バイト）。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @param data		3Dデータ
+ */
+void SummedVolumeTable::build(int width, int height, int depth, const float* data) {
+	this->width = width;
+	this->height = height;
+	this->depth = depth;
+
+	int tw = width + 1;
+	int th = height + 1;
+	int td = depth + 1;
+	table.assign((size_t)tw * th * td, 0.0);
+
+	// X方向の累積和（元のデータからコピーしながら）
+	#pragma omp parallel for
+	for (int z = 0; z < depth; ++z) {
+		for (int y = 0; y < height; ++y) {
+			const float* src = data + ((size_t)z * height + y) * width;
+			double* dst = &table[((size_t)(z + 1) * th + y + 1) * tw];
+			for (int x = 0; x < width; ++x) {
+				dst[x + 1] = dst[x] + src[x];
+			}
+		}
+	}
+
+	// Y方向の累積和
+	#pragma omp parallel for
+	for (int z = 1; z < td; ++z) {
+		for (int y = 1; y < th; ++y) {
+			double* prev = &table[((size_t)z * th + y - 1) * tw];
+			double* dst = &table[((size_t)z * th + y) * tw];
+			for (int x = 1; x < tw; ++x) {
+				dst[x] += prev[x];
+			}
+		}
+	}
+
+	// Z方向の累積和（スライスの中の行毎に並列化する）
+	#pragma omp parallel for
+	for (int y = 1; y < th; ++y) {
+		for (int z = 1; z < td; ++z) {
+			double* prev = &table[((size_t)(z - 1) * th + y) * tw];
+			double* dst = &table[((size_t)z * th + y) * tw];
+			for (int x = 1; x < tw; ++x) {
+				dst[x] += prev[x];
+			}
+		}
+	}
+}
+
+/**
+ * [x0, x1) x [y0, y1) x [z0, z1)の範囲の値の合計を、テーブルの8点から定数時間で返却する。
+ * 範囲はボリュームの内側にクリップする。
+ *
+ * @param x0	範囲の最小X座標
+ * @param y0	範囲の最小Y座標
+ * @param z0	範囲の最小Z座標
+ * @param x1	範囲の最大X座標+1
+ * @param y1	範囲の最大Y座標+1
+ * @param z1	範囲の最大Z座標+1
+ * @return		範囲の値の合計
+ */
+double SummedVolumeTable::sum(int x0, int y0, int z0, int x1, int y1, int z1) const {
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (z0 < 0) z0 = 0;
+	if (x1 > width) x1 = width;
+	if (y1 > height) y1 = height;
+	if (z1 > depth) z1 = depth;
+	if (x0 >= x1 || y0 >= y1 || z0 >= z1) return 0.0;
+
+	return at(x1, y1, z1) - at(x0, y1, z1) - at(x1, y0, z1) - at(x1, y1, z0)
+		 + at(x0, y0, z1) + at(x0, y1, z0) + at(x1, y0, z0) - at(x0, y0, z0);
+}
+
+/**
+ * [x0, x1) x [y0, y1) x [z0, z1)の範囲の値の平均を返却する。
+ * 範囲はボリュームの内側にクリップし、範囲外のボクセルは平均に含めない。
+ *
+ * @param x0	範囲の最小X座標
+ * @param y0	範囲の最小Y座標
+ * @param z0	範囲の最小Z座標
+ * @param x1	範囲の最大X座標+1
+ * @param y1	範囲の最大Y座標+1
+ * @param z1	範囲の最大Z座標+1
+ * @return		範囲の値の平均。範囲が空なら0
+ */
+float SummedVolumeTable::average(int x0, int y0, int z0, int x1, int y1, int z1) const {
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (z0 < 0) z0 = 0;
+	if (x1 > width) x1 = width;
+	if (y1 > height) y1 = height;
+	if (z1 > depth) z1 = depth;
+	if (x0 >= x1 || y0 >= y1 || z0 >= z1) return 0.0f;
+
+	double count = (double)(x1 - x0) * (y1 - y0) * (z1 - z0);
+	return (float)(sum(x0, y0, z0, x1, y1, z1) / count);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+class SummedVolumeTable {
+private:
+	int width;
+	int height;
+	int depth;
+	std::vector<double> table;
+
+public:
+	SummedVolumeTable();
+
+	void build(int width, int height, int depth, const float* data);
+	double sum(int x0, int y0, int z0, int x1, int y1, int z1) const;
+	float average(int x0, int y0, int z0, int x1, int y1, int z1) const;
+
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+	int getDepth() const { return depth; }
+
+private:
+	double at(int x, int y, int z) const { return table[((size_t)z * (height + 1) + y) * (width + 1) + x]; }
+};
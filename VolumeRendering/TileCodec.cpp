@@ -0,0 +1,143 @@
+﻿#include "TileCodec.h"
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <QDataStream>
+
+// zlibの圧縮レベル（遅延を優先して、最も速いレベルを使う）
+#define COMPRESSION_LEVEL	1
+
+/**
+ * フレームをTILE_SIZE四方のタイルに分け、参照フレーム（前回送ったフレーム）から変わったタイルだけを符号化する。
+ * 変わったタイルは参照フレームとのXORとして並べてからまとめてzlibで圧縮するので、
+ * 少しだけ変わったタイルや、常に0xffのアルファはほとんど0になって小さく圧縮される。
+ * 符号化したタイルは参照フレームに書き戻すので、参照フレームは常に受信側で復元されたフレームと一致する。
+ * キーフレームは黒のフレームを参照とし、全てのタイルを送る。
+ *
+ * @param frame					符号化するフレーム（1ピクセル4バイトの形式）
+ * @param reference [IN/OUT]	参照フレーム（サイズが異なる場合はキーフレームとする）
+ * @param keyframe				キーフレームとするか
+ * @param data [OUT]			符号化したデータ
+ * @return						送ったタイルの数
+ */
+int TileCodec::encode(const QImage& frame, QImage& reference, bool keyframe, QByteArray& data) {
+	int width = frame.width();
+	int height = frame.height();
+	if (reference.width() != width || reference.height() != height) keyframe = true;
+	if (keyframe) {
+		reference = QImage(width, height, QImage::Format_RGB32);
+		reference.fill(0);
+	}
+
+	// 変わったタイルを探す
+	int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+	int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+	std::vector<quint32> tiles;
+	int numBytes = 0;
+	for (int ty = 0; ty < tilesY; ++ty) {
+		for (int tx = 0; tx < tilesX; ++tx) {
+			int x0 = tx * TILE_SIZE;
+			int y0 = ty * TILE_SIZE;
+			int rowBytes = (std::min(x0 + TILE_SIZE, width) - x0) * 4;
+			int y1 = std::min(y0 + TILE_SIZE, height);
+
+			bool changed = keyframe;
+			for (int y = y0; y < y1 && !changed; ++y) {
+				changed = memcmp(frame.scanLine(y) + x0 * 4, reference.scanLine(y) + x0 * 4, rowBytes) != 0;
+			}
+			if (changed) {
+				tiles.push_back(ty * tilesX + tx);
+				numBytes += rowBytes * (y1 - y0);
+			}
+		}
+	}
+
+	// 変わったタイルの参照フレームとのXORを並べ、参照フレームを更新する
+	std::vector<uchar> deltas(std::max(numBytes, 1));
+	uchar* delta = &deltas[0];
+	for (int i = 0; i < (int)tiles.size(); ++i) {
+		int x0 = (tiles[i] % tilesX) * TILE_SIZE;
+		int y0 = (tiles[i] / tilesX) * TILE_SIZE;
+		int rowBytes = (std::min(x0 + TILE_SIZE, width) - x0) * 4;
+		int y1 = std::min(y0 + TILE_SIZE, height);
+		for (int y = y0; y < y1; ++y) {
+			const uchar* src = frame.scanLine(y) + x0 * 4;
+			uchar* ref = reference.scanLine(y) + x0 * 4;
+			for (int k = 0; k < rowBytes; ++k) {
+				delta[k] = src[k] ^ ref[k];
+			}
+			memcpy(ref, src, rowBytes);
+			delta += rowBytes;
+		}
+	}
+
+	data.clear();
+	QDataStream out(&data, QIODevice::WriteOnly);
+	out << (quint16)width << (quint16)height << (quint8)(keyframe ? 1 : 0) << (quint32)tiles.size();
+	for (int i = 0; i < (int)tiles.size(); ++i) {
+		out << tiles[i];
+	}
+	out << qCompress(&deltas[0], numBytes, COMPRESSION_LEVEL);
+
+	return tiles.size();
+}
+
+/**
+ * encodeで符号化したデータを、直前に復元したフレームに適用する。
+ * キーフレームでない場合、frameはencodeの参照フレームと同じ（前回復元した）フレームでなければならない。
+ *
+ * @param data				符号化したデータ
+ * @param frame [IN/OUT]	直前に復元したフレーム
+ * @return					復元できた場合はtrue
+ */
+bool TileCodec::decode(const QByteArray& data, QImage& frame) {
+	QDataStream in(data);
+	quint16 width, height;
+	quint8 keyframe;
+	quint32 numTiles;
+	in >> width >> height >> keyframe >> numTiles;
+	if (in.status() != QDataStream::Ok) return false;
+
+	int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+	int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+	if (numTiles > (quint32)(tilesX * tilesY)) return false;
+
+	std::vector<quint32> tiles(numTiles);
+	for (quint32 i = 0; i < numTiles; ++i) {
+		in >> tiles[i];
+	}
+	QByteArray compressed;
+	in >> compressed;
+	if (in.status() != QDataStream::Ok) return false;
+
+	if (keyframe) {
+		frame = QImage(width, height, QImage::Format_RGB32);
+		frame.fill(0);
+	} else if (frame.width() != width || frame.height() != height) {
+		// 参照するフレームが無いので、次のキーフレームを待つ
+		return false;
+	}
+
+	QByteArray deltas = qUncompress(compressed);
+	const uchar* delta = (const uchar*)deltas.constData();
+	const uchar* end = delta + deltas.size();
+	for (quint32 i = 0; i < numTiles; ++i) {
+		if (tiles[i] >= (quint32)(tilesX * tilesY)) return false;
+
+		int x0 = (tiles[i] % tilesX) * TILE_SIZE;
+		int y0 = (tiles[i] / tilesX) * TILE_SIZE;
+		int rowBytes = (std::min(x0 + TILE_SIZE, (int)width) - x0) * 4;
+		int y1 = std::min(y0 + TILE_SIZE, (int)height);
+		if (end - delta < rowBytes * (y1 - y0)) return false;
+
+		for (int y = y0; y < y1; ++y) {
+			uchar* dst = frame.scanLine(y) + x0 * 4;
+			for (int k = 0; k < rowBytes; ++k) {
+				dst[k] ^= delta[k];
+			}
+			delta += rowBytes;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <QImage>
+#include <QByteArray>
+
+class TileCodec {
+public:
+	static const int TILE_SIZE = 16;
+
+protected:
+	TileCodec() {}
+
+public:
+	static int encode(const QImage& frame, QImage& reference, bool keyframe, QByteArray& data);
+	static bool decode(const QByteArray& data, QImage& frame);
+};
+
@@ -1,34 +1,95 @@
 ﻿#include "Util.h"
-#include <fstream>
+#include <stdlib.h>
 #include <iostream>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+#include <emmintrin.h>
+#include <map>
+#include <QDir>
+#include <QFile>
+#include <QDesktopServices>
+#include "Profiler.h"
 
-int Util::LoadShader(char* filename, std::string& text) {
-    std::ifstream ifs;
-    ifs.open(filename, std::ios::in);
+// シェーダを埋め込まれたものより優先して読み込むフォルダを指定する環境変数
+#define SHADER_OVERRIDE_ENV	"VOLUME_RENDERING_SHADER_DIR"
 
-    std::string line;
-    while (ifs.good()) {
-        getline(ifs, line);
+// リンク済みのプログラムのバイナリを保存するフォルダ（ユーザ毎のキャッシュのフォルダからの相対パス）
+#define SHADER_CACHE_DIR	"VolumeRendering/shadercache"
 
-        text += line + "\n";
-    }
+// バイナリのファイルの先頭に書き込む識別子
+#define SHADER_CACHE_MAGIC	0x31424756
+
+/**
+ * シェーダのソースを読み込む。
+ * シェーダはビルド時にQtのリソース（MainWindow.qrc）として実行ファイルに埋め込まれているので、
+ * 通常はファイルを読まずに、カレントディレクトリに依存せずにロードできる。
+ * 開発中は、環境変数SHADER_OVERRIDE_ENVにフォルダを指定すると、そこにあるシェーダが優先される。
+ *
+ * @param key			シェーダ名（<key>.glsl）
+ * @param text [OUT]	読み込んだソース
+ * @return				読み込めた場合はtrue
+ */
+bool Util::LoadShader(const char* key, std::string& text) {
+	QString filename = QString(key) + ".glsl";
+
+	QFile file;
+	const char* overrideDir = getenv(SHADER_OVERRIDE_ENV);
+	if (overrideDir != NULL && QFile::exists(QDir(overrideDir).filePath(filename))) {
+		file.setFileName(QDir(overrideDir).filePath(filename));
+	} else {
+		file.setFileName(":/shader/" + filename);
+	}
 
-    return 0;
+	if (!file.open(QIODevice::ReadOnly)) return false;
+
+	QByteArray source = file.readAll();
+	text.assign(source.constData(), source.size());
+
+	return true;
 }
 
-GLuint Util::LoadProgram(const char* vsfile, const char* fsfile) {
+/**
+ * シェーダをロードしてプログラムを生成する。
+ * definesは、各シェーダの#versionの直後に挿入されるので、#defineでシェーダのバリアントを指定できる。
+ * 生成したプログラムは、シェーダとdefinesの組み合わせ毎にキャッシュするので、同じバリアントを
+ * 何度要求してもコンパイルは一度だけである。
+ * また、GL_ARB_get_program_binaryが使える場合は、リンク済みのバイナリをユーザ毎のキャッシュのフォルダに保存し、
+ * 次回の起動時はコンパイルせずにそれをロードする。
+ *
+ * @param vsKey		頂点シェーダ名（<vsKey>.glsl）
+ * @param fsKey		フラグメントシェーダ名（<fsKey>.glsl）
+ * @param defines	シェーダに挿入する#defineの並び
+ * @return			生成したプログラム
+ */
+GLuint Util::LoadProgram(const char* vsKey, const char* fsKey, const std::string& defines) {
+	static std::map<std::string, GLuint> programs;
+
+	std::string key = std::string(vsKey) + "|" + fsKey + "|" + defines;
+	std::map<std::string, GLuint>::iterator it = programs.find(key);
+	if (it != programs.end()) return it->second;
+
     //load vertex shader
-    std::string vsPath = "shader/"+std::string(vsfile)+".glsl";
 	std::string vsSourceStr;
-    LoadShader((char*)vsPath.c_str(), vsSourceStr);
+    if (!LoadShader(vsKey, vsSourceStr)) std::cout<<"Can't load vertex shader "<<vsKey<<std::endl;
 
     //load fragment shader
-    std::string fsPath = "shader/"+std::string(fsfile)+".glsl";
     std::string fsSourceStr;
-    LoadShader((char*)fsPath.c_str(), fsSourceStr);
-
-    if (vsSourceStr.empty()) std::cout<<"Can't load vertex shader "<<vsfile<<std::endl;
-    if (fsfile!="" && fsSourceStr.empty()) std::cout<<"Can't load fragment shader "<<fsfile<<std::endl;
+    if (!LoadShader(fsKey, fsSourceStr)) std::cout<<"Can't load fragment shader "<<fsKey<<std::endl;
+
+	InsertDefines(vsSourceStr, defines);
+	InsertDefines(fsSourceStr, defines);
+
+	// ソースとGPUドライバが同じなら、前回リンクしたバイナリをそのまま使う
+	std::string binaryPath;
+	if (GLEW_ARB_get_program_binary) {
+		binaryPath = GetProgramBinaryPath(vsSourceStr + fsSourceStr);
+		GLuint programHandle = LoadProgramBinary(binaryPath);
+		if (programHandle > 0) {
+			programs[key] = programHandle;
+			return programHandle;
+		}
+	}
 
     //convert to const char
     const char* vsSource = vsSourceStr.c_str();
@@ -45,26 +106,27 @@ GLuint Util::LoadProgram(const char* vsfile, const char* fsfile) {
     glGetShaderiv(vsShader, GL_COMPILE_STATUS, &compileSuccess);
     if(compileSuccess == GL_FALSE){
         glGetShaderInfoLog(vsShader, sizeof(errorLog), 0, errorLog);
-        std::cout<<"Can't compile vertex shader "<<vsfile<<std::endl;
+        std::cout<<"Can't compile vertex shader "<<vsKey<<std::endl;
         std::cout<<errorLog<<std::endl;
     }
     glAttachShader(programHandle, vsShader);
 
-    if(fsfile!=""){
-        GLuint fsShader = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fsShader, 1, &fsSource, NULL);
-        glCompileShader(fsShader);
-        glGetShaderiv(fsShader, GL_COMPILE_STATUS, &compileSuccess);
-        if(compileSuccess == GL_FALSE){
-            glGetShaderInfoLog(fsShader, sizeof(errorLog), 0, errorLog);
-            std::cout<<"Can't compile fragment shader "<<fsfile<<std::endl;
-            std::cout<<errorLog<<std::endl;
-        }
-        glAttachShader(programHandle, fsShader);
+    GLuint fsShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fsShader, 1, &fsSource, NULL);
+    glCompileShader(fsShader);
+    glGetShaderiv(fsShader, GL_COMPILE_STATUS, &compileSuccess);
+    if(compileSuccess == GL_FALSE){
+        glGetShaderInfoLog(fsShader, sizeof(errorLog), 0, errorLog);
+        std::cout<<"Can't compile fragment shader "<<fsKey<<" "<<defines<<std::endl;
+        std::cout<<errorLog<<std::endl;
     }
+    glAttachShader(programHandle, fsShader);
 
     glBindAttribLocation(programHandle, 0, "glVertex");
 	glBindAttribLocation(programHandle, 1, "glTexCoord");
+	if (GLEW_ARB_get_program_binary) {
+		glProgramParameteri(programHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
     glLinkProgram(programHandle);
 
     GLint linkSuccess;
@@ -72,15 +134,150 @@ GLuint Util::LoadProgram(const char* vsfile, const char* fsfile) {
 
     if (!linkSuccess) {
         glGetProgramInfoLog(programHandle, sizeof(errorLog), 0, errorLog);
-        std::cout<<"Link error.\n"<<"vs: "<<vsfile<<"fs: "<<fsfile<<std::endl;
+        std::cout<<"Link error.\n"<<"vs: "<<vsKey<<"fs: "<<fsKey<<std::endl;
         std::cout<<errorLog<<std::endl;
-    }
+    } else if (!binaryPath.empty()) {
+		SaveProgramBinary(binaryPath, programHandle);
+	}
+
+	// リンクが終わったシェーダは、プログラムが参照を持っているので削除してよい
+	glDeleteShader(vsShader);
+	glDeleteShader(fsShader);
 
+	programs[key] = programHandle;
     return programHandle;
+}
 
+/**
+ * シェーダのソースの#versionの行の直後に、definesを挿入する。
+ * #versionはシェーダの先頭になければいけないので、その前には挿入できない。
+ *
+ * @param source [IN/OUT]	シェーダのソース
+ * @param defines			挿入する#defineの並び
+ */
+void Util::InsertDefines(std::string& source, const std::string& defines) {
+	if (defines.empty()) return;
+
+	size_t pos = 0;
+	size_t version = source.find("#version");
+	if (version != std::string::npos) {
+		pos = source.find('\n', version);
+		pos = pos == std::string::npos ? source.size() : pos + 1;
+	}
+	source.insert(pos, defines + (defines[defines.size() - 1] == '\n' ? "" : "\n"));
+}
+
+/**
+ * プログラムのバイナリを保存するファイルのパスを返却する。
+ * バイナリはGPUとドライバに依存するので、ソースと一緒にGL_RENDERERとGL_VERSIONもハッシュ値に含める。
+ *
+ * @param source	プログラムの全シェーダのソース（definesを挿入した後のもの）
+ * @return			バイナリのファイルパス
+ */
+std::string Util::GetProgramBinaryPath(const std::string& source) {
+	std::string text = source;
+	text += (const char*)glGetString(GL_RENDERER);
+	text += (const char*)glGetString(GL_VERSION);
+
+	// FNV-1a (64bit)
+	unsigned long long hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < text.size(); ++i) {
+		hash ^= (unsigned char)text[i];
+		hash *= 1099511628211ULL;
+	}
+
+	char filename[64];
+	sprintf(filename, "%08x%08x.bin", (unsigned int)(hash >> 32), (unsigned int)hash);
+	return GetProgramCacheDir() + "/" + filename;
+}
+
+/**
+ * プログラムのバイナリを保存するフォルダを返却する。
+ * カレントディレクトリに依存しないように、ユーザ毎のキャッシュのフォルダ（QDesktopServices::CacheLocation）の下に置く。
+ * キャッシュのフォルダが取得できない場合は、一時フォルダの下に置く。
+ *
+ * @return		フォルダのパス
+ */
+std::string Util::GetProgramCacheDir() {
+	QString base = QDesktopServices::storageLocation(QDesktopServices::CacheLocation);
+	if (base.isEmpty()) base = QDir::tempPath();
+
+	return QFile::encodeName(QDir(base).filePath(SHADER_CACHE_DIR)).constData();
 }
 
-GLuint Util::CreateBoxVao(int width, int height, int depth) {
+/**
+ * 保存したプログラムのバイナリをロードする。
+ * ファイルが無い場合や、ドライバが更新されてバイナリを受け付けない場合は、0を返却するので、
+ * 呼び出し側でソースからコンパイルし直すこと。
+ *
+ * @param path	バイナリのファイルパス
+ * @return		生成したプログラム（失敗した場合は0）
+ */
+GLuint Util::LoadProgramBinary(const std::string& path) {
+	FILE* fp = fopen(path.c_str(), "rb");
+	if (fp == NULL) return 0;
+
+	unsigned int header[3];
+	std::vector<char> binary;
+	bool valid = fread(header, sizeof(unsigned int), 3, fp) == 3 && header[0] == SHADER_CACHE_MAGIC && header[2] > 0;
+	if (valid) {
+		binary.resize(header[2]);
+		valid = fread(&binary[0], 1, binary.size(), fp) == binary.size();
+	}
+	fclose(fp);
+	if (!valid) return 0;
+
+	GLuint programHandle = glCreateProgram();
+	glProgramBinary(programHandle, (GLenum)header[1], &binary[0], (GLsizei)binary.size());
+
+	GLint linkSuccess;
+	glGetProgramiv(programHandle, GL_LINK_STATUS, &linkSuccess);
+	if (!linkSuccess) {
+		glDeleteProgram(programHandle);
+		return 0;
+	}
+
+	return programHandle;
+}
+
+/**
+ * リンク済みのプログラムのバイナリをファイルに保存する。
+ * 保存に失敗しても、次回の起動時にコンパイルし直すだけなので、エラーにはしない。
+ *
+ * @param path				バイナリのファイルパス
+ * @param programHandle		リンク済みのプログラム
+ */
+void Util::SaveProgramBinary(const std::string& path, GLuint programHandle) {
+	GLint length = 0;
+	glGetProgramiv(programHandle, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) return;
+
+	std::vector<char> binary(length);
+	GLenum format = 0;
+	glGetProgramBinary(programHandle, length, NULL, &format, &binary[0]);
+
+	QDir().mkpath(QFile::decodeName(GetProgramCacheDir().c_str()));
+	FILE* fp = fopen(path.c_str(), "wb");
+	if (fp == NULL) return;
+
+	unsigned int header[3] = { SHADER_CACHE_MAGIC, format, (unsigned int)length };
+	fwrite(header, sizeof(unsigned int), 3, fp);
+	fwrite(&binary[0], 1, binary.size(), fp);
+	fclose(fp);
+}
+
+/**
+ * 指定したサイズの3Dデータを囲むボックスのVAOを生成する。
+ * VAOが参照する２つのVBO（頂点座標、インデックス）はvbosに返却するので、
+ * 呼び出し側でVAOと一緒にglDeleteBuffersすること。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @param vbos [OUT]	生成したVBO（２個）
+ * @return			生成したVAO
+ */
+GLuint Util::CreateBoxVao(int width, int height, int depth, GLuint* vbos) {
     float positions[] = {
 		-width * 0.5, -height * 0.5, -depth * 0.5, 
 		-width * 0.5, -height * 0.5,  depth * 0.5, 
@@ -108,19 +305,17 @@ GLuint Util::CreateBoxVao(int width, int height, int depth) {
 
     // Create the VBO for positions:
     {
-        GLuint vbo;
         GLsizeiptr size = sizeof(positions);
-        glGenBuffers(1, &vbo);
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glGenBuffers(1, &vbos[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, vbos[0]);
         glBufferData(GL_ARRAY_BUFFER, size, positions, GL_STATIC_DRAW);
     }
 
     // Create the VBO for indices:
     {
-        GLuint vbo;
         GLsizeiptr size = sizeof(indices);
-        glGenBuffers(1, &vbo);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbo);
+        glGenBuffers(1, &vbos[1]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbos[1]);
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, indices, GL_STATIC_DRAW);
     }
 
@@ -133,7 +328,7 @@ GLuint Util::CreateBoxVao(int width, int height, int depth) {
 }
 
 //create cubic information
-GLuint Util::CreateCubeVao() {
+GLuint Util::CreateCubeVao(GLuint* vbos) {
     float positions[] = { 
 		-1.0f, -1.0f, -1.0f, 
 		-1.0f, -1.0f,  1.0f, 
@@ -161,19 +356,17 @@ GLuint Util::CreateCubeVao() {
 
     // Create the VBO for positions:
     {
-        GLuint vbo;
         GLsizeiptr size = sizeof(positions);
-        glGenBuffers(1, &vbo);
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glGenBuffers(1, &vbos[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, vbos[0]);
         glBufferData(GL_ARRAY_BUFFER, size, positions, GL_STATIC_DRAW);
     }
 
     // Create the VBO for indices:
     {
-        GLuint vbo;
         GLsizeiptr size = sizeof(indices);
-        glGenBuffers(1, &vbo);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbo);
+        glGenBuffers(1, &vbos[1]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbos[1]);
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, indices, GL_STATIC_DRAW);
     }
 
@@ -185,7 +378,7 @@ GLuint Util::CreateCubeVao() {
     return vao;
 }
 
-GLuint Util::CreateQuadVao() {
+GLuint Util::CreateQuadVao(GLuint* vbo) {
     short positions[] = {
         -1, -1,
          1, -1,
@@ -199,10 +392,9 @@ GLuint Util::CreateQuadVao() {
     glBindVertexArray(vao);
 
     // Create the VBO:
-    GLuint vbo;
     GLsizeiptr size = sizeof(positions);
-    glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glGenBuffers(1, vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, *vbo);
     glBufferData(GL_ARRAY_BUFFER, size, positions, GL_STATIC_DRAW);
 
     // Set up the vertex layout:
@@ -213,20 +405,73 @@ GLuint Util::CreateQuadVao() {
     return vao;
 }
 
+/**
+ * 三角形メッシュのVAOを生成する。頂点は、座標と法線をfloatで3つずつ交互に並べたもので、
+ * 座標をattribute 0、法線をattribute 1とする。
+ * VAOが参照する２つのVBO（頂点、インデックス）はvbosに返却するので、
+ * 呼び出し側でVAOと一緒にglDeleteBuffersすること。
+ *
+ * @param vertices		頂点（座標、法線）
+ * @param numVertices	頂点数
+ * @param indices		三角形の頂点のインデックス
+ * @param numIndices	インデックス数
+ * @param vbos [OUT]	生成したVBO（２個）
+ * @return				生成したVAO
+ */
+GLuint Util::CreateMeshVao(const float* vertices, int numVertices, const unsigned int* indices, int numIndices, GLuint* vbos) {
+    // Create the VAO:
+    GLuint vao;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+
+    // Create the VBO for positions and normals:
+    {
+        GLsizeiptr size = numVertices * 6 * sizeof(float);
+        glGenBuffers(1, &vbos[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, vbos[0]);
+        glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+    }
+
+    // Create the VBO for indices:
+    {
+        GLsizeiptr size = numIndices * sizeof(unsigned int);
+        glGenBuffers(1, &vbos[1]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbos[1]);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, indices, GL_STATIC_DRAW);
+    }
+
+    // Set up the vertex layout:
+    GLsizeiptr stride = 6 * sizeof(float);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, 0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (GLvoid*)(3 * sizeof(float)));
+
+    glBindVertexArray(0);
+
+    return vao;
+}
+
 /**
  * VTKファイルフォーマットの3Dデータを読み込む。
  * ただし、STRUCTURED_POINTSで、unsigned shortしか対応していない。
  * 読み込み失敗すると、falseを返却する。
+ * データは一度にまとめて読み込み、バイトオーダーの変換とfloatへの変換はSSE2で8個ずつ、全コアで並列に行う。
+ * histogramを指定した場合は、元のunsigned shortの値のヒストグラムも作成する。
  *
  * @param filename		VTKファイル名
  * @param width	[OUT]	3Dデータの幅
  * @param height [OUT]	3Dデータの高さ
  * @param depth [OUT]	3Dデータの奥行き
  * @param data			3Dデータ
+ * @param histogram [OUT]	値のヒストグラム。NULL可
  * @return				読み込み成功ならtrueを返却する
  */
-bool Util::loadVTK(char* filename, int& width, int& height, int& depth, float** data) {
+bool Util::loadVTK(char* filename, int& width, int& height, int& depth, float** data, VolumeHistogram* histogram) {
+	PROFILE_SCOPE("loadVTK");
+
 	FILE* fp = fopen(filename, "rb");
+	if (fp == NULL) return false;
 
 	char buff[256];
 	bool binary_file = false;
@@ -289,19 +534,44 @@ bool Util::loadVTK(char* filename, int& width, int& height, int& depth, float**
 		}
 	}
 
-	unsigned short max_val = 0;
-	unsigned short min_val = 99999;
-	*data = new float[width * height * depth];
-	for (int i = 0; i < width * height * depth; ++i) {
-		unsigned char raw_val[2];
-		fread(&raw_val, sizeof(unsigned char), 2, fp);
-
-		unsigned short val = raw_val[0] * 256 + raw_val[1];
+	int num = width * height * depth;
+	std::vector<unsigned short> raw(num);
+	int numRead;
+	{
+		PROFILE_SCOPE("loadVTK.read");
+		numRead = fread(&raw[0], sizeof(unsigned short), num, fp);
+		fclose(fp);
+	}
+	if (numRead < num) {
+		return false;
+	}
 
-		(*data)[i] = (float)val / 65536.0f;
+	// ビッグエンディアンから変換し、[0, 1)に正規化する
+	{
+		PROFILE_SCOPE("loadVTK.convert");
+		*data = new float[num];
+		int numVectors = num / 8;
+		#pragma omp parallel for
+		for (int i = 0; i < numVectors; ++i) {
+			__m128i v = _mm_loadu_si128((__m128i*)&raw[i * 8]);
+			v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+			_mm_storeu_si128((__m128i*)&raw[i * 8], v);
+
+			__m128 scale = _mm_set1_ps(1.0f / 65536.0f);
+			__m128i zero = _mm_setzero_si128();
+			_mm_storeu_ps(*data + i * 8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), scale));
+			_mm_storeu_ps(*data + i * 8 + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), scale));
+		}
+		for (int i = numVectors * 8; i < num; ++i) {
+			raw[i] = (unsigned short)((raw[i] << 8) | (raw[i] >> 8));
+			(*data)[i] = (float)raw[i] / 65536.0f;
+		}
 	}
 
-	fclose(fp);
+	if (histogram != NULL) {
+		PROFILE_SCOPE("loadVTK.histogram");
+		histogram->build(num, &raw[0]);
+	}
 
 	return true;
 }
@@ -2,18 +2,27 @@
 
 #include <GL/glew.h>
 #include <string>
+#include "VolumeHistogram.h"
 
 class Util {
 protected:
 	Util() {}
 
 public:
-	static int LoadShader(char* filename, std::string& text);
-	static GLuint LoadProgram(const char* vsKey, const char* fsKey);
+	static bool LoadShader(const char* key, std::string& text);
+	static GLuint LoadProgram(const char* vsKey, const char* fsKey, const std::string& defines = "");
 
-	static GLuint CreateBoxVao(int width, int height, int depth);
-	static GLuint CreateCubeVao();
-	static GLuint CreateQuadVao();
+	static GLuint CreateBoxVao(int width, int height, int depth, GLuint* vbos);
+	static GLuint CreateCubeVao(GLuint* vbos);
+	static GLuint CreateQuadVao(GLuint* vbo);
+	static GLuint CreateMeshVao(const float* vertices, int numVertices, const unsigned int* indices, int numIndices, GLuint* vbos);
 
-	static bool loadVTK(char* filename, int& width, int& height, int& depth, float** data);
+	static bool loadVTK(char* filename, int& width, int& height, int& depth, float** data, VolumeHistogram* histogram = NULL);
+
+private:
+	static void InsertDefines(std::string& source, const std::string& defines);
+	static std::string GetProgramCacheDir();
+	static std::string GetProgramBinaryPath(const std::string& source);
+	static GLuint LoadProgramBinary(const std::string& path);
+	static void SaveProgramBinary(const std::string& path, GLuint programHandle);
 };
@@ -0,0 +1,106 @@
+﻿#include "VolumeHistogram.h"
+#include <omp.h>
+
+// 自動で設定する窓の下限と上限のパーセンタイル
+// 下限は外れ値だけを除くように低く取る（中央値にすると、半分のボクセルが0になって構造が消える）
+#define AUTO_WINDOW_LOW		0.01f
+#define AUTO_WINDOW_HIGH	0.999f
+
+VolumeHistogram::VolumeHistogram() {
+	bins.assign(NUM_BINS, 0);
+	total = 0;
+	minBin = 0;
+	maxBin = 0;
+}
+
+/**
+ * unsigned shortの値のヒストグラムを作成する。値毎に1ビンなので、最小値、最大値、パーセンタイルは正確に求まる。
+ * スレッド毎に別々のヒストグラムに数えて、最後に合計するので、スレッド間の競合は起きない。
+ *
+ * @param num		値の数
+ * @param values	値
+ */
+void VolumeHistogram::build(int num, const unsigned short* values) {
+	int numThreads = omp_get_max_threads();
+	std::vector<int> threadBins((size_t)numThreads * NUM_BINS, 0);
+
+	#pragma omp parallel
+	{
+		int* local = &threadBins[(size_t)omp_get_thread_num() * NUM_BINS];
+
+		#pragma omp for
+		for (int i = 0; i < num; ++i) {
+			local[values[i]]++;
+		}
+	}
+
+	// スレッド毎のヒストグラムを、ビン毎に並列に合計する
+	#pragma omp parallel for
+	for (int b = 0; b < NUM_BINS; ++b) {
+		long long count = 0;
+		for (int t = 0; t < numThreads; ++t) {
+			count += threadBins[(size_t)t * NUM_BINS + b];
+		}
+		bins[b] = count;
+	}
+
+	total = num;
+	minBin = 0;
+	while (minBin < NUM_BINS - 1 && bins[minBin] == 0) minBin++;
+	maxBin = NUM_BINS - 1;
+	while (maxBin > 0 && bins[maxBin] == 0) maxBin--;
+}
+
+/**
+ * 最小値を、loadVTKと同じく[0, 1)に正規化した密度で返却する。
+ *
+ * @return		最小値
+ */
+float VolumeHistogram::getMin() const {
+	return toDensity(minBin);
+}
+
+/**
+ * 最大値を、loadVTKと同じく[0, 1)に正規化した密度で返却する。
+ *
+ * @return		最大値
+ */
+float VolumeHistogram::getMax() const {
+	return toDensity(maxBin);
+}
+
+/**
+ * 値の小さい方から、全体のpの割合を含む値を、[0, 1)に正規化した密度で返却する。
+ *
+ * @param p		割合 [0, 1]
+ * @return		パーセンタイル値
+ */
+float VolumeHistogram::percentile(float p) const {
+	if (total == 0) return 0.0f;
+
+	long long target = (long long)(p * total);
+	if (target >= total) target = total - 1;
+
+	long long count = 0;
+	for (int b = 0; b < NUM_BINS; ++b) {
+		count += bins[b];
+		if (count > target) return toDensity(b);
+	}
+	return toDensity(maxBin);
+}
+
+/**
+ * パーセンタイルから、コントラストの低いデータでも調整せずに見える窓を求める。
+ * 分布が狭すぎて窓が潰れる場合は、最小値から最大値までとする。
+ *
+ * @param windowMin [OUT]	窓の下限
+ * @param windowMax [OUT]	窓の上限
+ */
+void VolumeHistogram::getAutoWindow(float& windowMin, float& windowMax) const {
+	windowMin = percentile(AUTO_WINDOW_LOW);
+	windowMax = percentile(AUTO_WINDOW_HIGH);
+	if (windowMax <= windowMin) {
+		windowMin = getMin();
+		windowMax = getMax();
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+class VolumeHistogram {
+public:
+	static const int NUM_BINS = 65536;
+
+private:
+	std::vector<long long> bins;
+	long long total;
+	int minBin;
+	int maxBin;
+
+public:
+	VolumeHistogram();
+
+	void build(int num, const unsigned short* values);
+	long long getCount(int bin) const { return bins[bin]; }
+	long long getTotal() const { return total; }
+	float getMin() const;
+	float getMax() const;
+	float percentile(float p) const;
+	void getAutoWindow(float& windowMin, float& windowMax) const;
+
+private:
+	static float toDensity(int bin) { return (float)bin / 65536.0f; }
+};
@@ -1,25 +1,189 @@
 ﻿#include "VolumeRendering.h"
 #include <iostream>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
 #include "Util.h"
+#include "BC4Encoder.h"
+#include "Profiler.h"
+#include "BlueNoise.h"
+
+// raycastfs.glslの光源へのレイマーチングと同じ減衰になるように、absorbRate * stepSize / lightStepSizeとする
+#define LIGHT_ABSORPTION	5.0f
+
+// 等値面のメッシュをキャッシュする数
+#define MAX_CACHED_MESHES	8
+
+// 光源へのレイマーチングの最大サンプル数
+#define LIGHT_SAMPLES		128
+
+// レイのサンプル間隔（テクスチャ座標）
+// 段階的に描画する場合は、開始位置をずらしたフレームを平均するので、間隔を広げても縞模様にならない
+#define STEP_SIZE				0.005f
+#define PROGRESSIVE_STEP_SIZE	0.01f
+
+// 段階的に描画する場合に、カメラが止まってから平均するフレーム数
+#define MAX_ACCUMULATED_FRAMES	16
+
+// レイの開始位置をずらすブルーノイズのタイルのサイズ
+#define BLUE_NOISE_SIZE		64
+
+// 前のフレームから再投影したピクセルを、レイを飛ばさずに使い回す最大のフレーム数
+#define MAX_REPROJECTED_FRAMES	8
+
+// 粗い遮蔽のパスで、１本のレイが受け持つピクセル数（縦横それぞれ）
+#define OCCLUSION_TILE_SIZE		8
 
 VolumeRendering::VolumeRendering() {
     program = Util::LoadProgram("raycastvs", "raycastfs");
+    meshProgram = Util::LoadProgram("meshvs", "meshfs");
+    heatmapProgram = Util::LoadProgram("quadvs", "heatmapfs");
+    accumulateProgram = Util::LoadProgram("quadvs", "accumulatefs");
+    reprojectProgram = Util::LoadProgram("reprojectvs", "reprojectfs");
 
 	glDisable(GL_DEPTH_TEST);
     glEnableVertexAttribArray(0);
 
+	gridWidth = 0;
+	gridHeight = 0;
+	gridDepth = 0;
+
 	texture = 0;
+	backTexture = 0;
 	boxVao = 0;
+	boxVbos[0] = 0;
+	boxVbos[1] = 0;
+
+	pendingDelta = NULL;
+
+	compressed = false;
+	densityRange = 1.0f;
+
+	sparse = false;
+	brickTableTexture = 0;
+	atlasSize[0] = 0;
+	atlasSize[1] = 0;
+	atlasSize[2] = 0;
+
+	windowMin = 0.0f;
+	windowMax = 1.0f;
+
+	shading = false;
+	gradientTexture = 0;
+
+	lightPos = QVector3D(1.0f, 1.0f, 2.0f);
+	precomputedLight = false;
+	lightTexture = 0;
+
+	ambientOcclusion = false;
+	occlusionTexture = 0;
+
+	renderMode = RENDER_VOLUME;
+	isoValue = 0.5f;
+	minMaxTexture = 0;
+
+	statistics = false;
+	statsFbo = 0;
+	statsTexture = 0;
+	statsSize[0] = 0;
+	statsSize[1] = 0;
+	quadVao = 0;
+	quadVbo = 0;
+	memset(&rayStatistics, 0, sizeof(rayStatistics));
+
+	progressive = false;
+	blueNoiseTexture = 0;
+	frameFbo = 0;
+	frameTexture = 0;
+	accumFbo = 0;
+	accumTexture = 0;
+	accumSize[0] = 0;
+	accumSize[1] = 0;
+	accumulatedFrames = 0;
+
+	reprojection = false;
+	historyFbos[0] = 0;
+	historyFbos[1] = 0;
+	memset(historyTextures, 0, sizeof(historyTextures));
+	reprojFbo = 0;
+	reprojTextures[0] = 0;
+	reprojTextures[1] = 0;
+	reprojDepth = 0;
+	pointVao = 0;
+	historySize[0] = 0;
+	historySize[1] = 0;
+	currentHistory = 0;
+	historyValid = false;
+
+	targetFbo = 0;
+
+	terminationThreshold = 0.99f;
+	occlusionCulling = false;
+	occlusionFbo = 0;
+	occlusionTilesTexture = 0;
+	occlusionSize[0] = 0;
+	occlusionSize[1] = 0;
 }
 
 VolumeRendering::~VolumeRendering() {
 	if (texture > 0) {
 		glDeleteTextures(1, &texture);
 	}
+	if (backTexture > 0) {
+		glDeleteTextures(1, &backTexture);
+	}
+	if (brickTableTexture > 0) {
+		glDeleteTextures(1, &brickTableTexture);
+	}
+	if (gradientTexture > 0) {
+		glDeleteTextures(1, &gradientTexture);
+	}
+	if (lightTexture > 0) {
+		glDeleteTextures(1, &lightTexture);
+	}
+	if (occlusionTexture > 0) {
+		glDeleteTextures(1, &occlusionTexture);
+	}
 
-	if (boxVao > 0) {
-		glDeleteVertexArrays(1, &boxVao);
+	if (minMaxTexture > 0) {
+		glDeleteTextures(1, &minMaxTexture);
+	}
+	if (statsTexture > 0) {
+		glDeleteTextures(1, &statsTexture);
+		glDeleteFramebuffers(1, &statsFbo);
+	}
+	if (quadVao > 0) {
+		glDeleteVertexArrays(1, &quadVao);
+		glDeleteBuffers(1, &quadVbo);
+	}
+	if (blueNoiseTexture > 0) {
+		glDeleteTextures(1, &blueNoiseTexture);
 	}
+	if (frameTexture > 0) {
+		glDeleteTextures(1, &frameTexture);
+		glDeleteFramebuffers(1, &frameFbo);
+		glDeleteTextures(1, &accumTexture);
+		glDeleteFramebuffers(1, &accumFbo);
+	}
+	if (reprojFbo > 0) {
+		glDeleteTextures(4, &historyTextures[0][0]);
+		glDeleteFramebuffers(2, historyFbos);
+		glDeleteTextures(2, reprojTextures);
+		glDeleteRenderbuffers(1, &reprojDepth);
+		glDeleteFramebuffers(1, &reprojFbo);
+	}
+	if (pointVao > 0) {
+		glDeleteVertexArrays(1, &pointVao);
+	}
+	if (occlusionTilesTexture > 0) {
+		glDeleteTextures(1, &occlusionTilesTexture);
+		glDeleteFramebuffers(1, &occlusionFbo);
+	}
+
+	clearMeshCache();
+	deleteBox();
+
+	delete pendingDelta;
 }
 
 /**
@@ -31,38 +195,351 @@ VolumeRendering::~VolumeRendering() {
  * @param data		3Dデータ
  */
 void VolumeRendering::setVolumeData(GLsizei width, GLsizei height, GLsizei depth, float* data) {
-	gridWidth = width;
-	gridHeight = height;
-	gridDepth = depth;
+	PROFILE_SCOPE("setVolumeData");
+	PROFILE_GPU_SCOPE("setVolumeData");
 
-	if (texture > 0) {
-		glDeleteTextures(1, &texture);
+	// 前回と同じサイズなら、既存のテクスチャにそのまま上書きする
+	if (texture == 0 || compressed || sparse || !isSameSize(width, height, depth)) {
+		resetVolume(width, height, depth);
+		texture = createVolumeTexture(width, height, depth);
 	}
-	if (boxVao > 0) {
-		glDeleteVertexArrays(1, &boxVao);
+
+	glBindTexture(GL_TEXTURE_3D, texture);
+	glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, width, height, depth, GL_RED, GL_FLOAT, data);
+
+	volumeData.assign(data, data + width * height * depth);
+	updateDerivedVolumes();
+}
+
+/**
+ * 指定した3Dデータをスライス毎にBC4(RGTC1)で圧縮し、2Dテクスチャ配列としてセットする。
+ * GPUメモリはGL_R16Fの1/4になる。圧縮誤差（PSNR）をコンソールに出力するので、
+ * データセット毎に圧縮するかどうかを判断できる。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @param data		3Dデータ
+ */
+void VolumeRendering::setCompressedVolumeData(GLsizei width, GLsizei height, GLsizei depth, float* data) {
+	PROFILE_SCOPE("setCompressedVolumeData");
+	PROFILE_GPU_SCOPE("setCompressedVolumeData");
+
+	bool reuse = texture > 0 && compressed && isSameSize(width, height, depth);
+	if (!reuse) {
+		resetVolume(width, height, depth);
 	}
 
-	// 3Dデータを囲むボックスを生成
-	boxVao = Util::CreateBoxVao(width, height, depth);
+	// BC4の端点は8bitなので、最大値で[0, 1]に正規化してから圧縮する
+	int num = width * height * depth;
+	float maxVal = 0.0f;
+	for (int i = 0; i < num; ++i) {
+		if (data[i] > maxVal) maxVal = data[i];
+	}
+	densityRange = maxVal > 0.0f ? maxVal : 1.0f;
 
-	// 3Dテクスチャを生成
-	glGenTextures(1, &this->texture);
+	std::vector<unsigned char> blocks;
+	BC4Encoder::encode(width, height, depth, data, 1.0f / densityRange, blocks);
 
-	// 生成した3Dテクスチャのパラメータを設定する
-	glBindTexture(GL_TEXTURE_3D, this->texture);
-    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	// 展開して、元のデータとの誤差を計算する
+	{
+		std::vector<float> decoded(num);
+		BC4Encoder::decode(width, height, depth, blocks, 1.0f / densityRange, &decoded[0]);
+		double psnr = BC4Encoder::computePSNR(width, height, depth, data, &decoded[0], densityRange);
+		printf("BC4: %.1f MB -> %.1f MB, PSNR: %.2f dB\n", num * 2 / 1048576.0f, blocks.size() / 1048576.0f, psnr);
+	}
 
-	// 3Dテクスチャ用のメモリを確保する
-    glTexImage3D(GL_TEXTURE_3D, 0, GL_R16F, width, height, depth, 0, GL_RED, GL_FLOAT, data);
-    if (GL_NO_ERROR != glGetError()) {
-		std::cout << "Unable to create 3D texture"<< std::endl;
+	// RGTCは3Dテクスチャに使えないので、スライスを2Dテクスチャ配列のレイヤとして格納する
+	if (!reuse) {
+		glGenTextures(1, &this->texture);
+		glBindTexture(GL_TEXTURE_2D_ARRAY, this->texture);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+		if (GLEW_ARB_texture_storage) {
+			glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_COMPRESSED_RED_RGTC1, width, height, depth);
+		} else {
+			glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_COMPRESSED_RED_RGTC1, width, height, depth, 0, blocks.size(), NULL);
+		}
+		if (GL_NO_ERROR != glGetError()) {
+			std::cout << "Unable to create compressed texture"<< std::endl;
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_2D_ARRAY, this->texture);
+	glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, width, height, depth, GL_COMPRESSED_RED_RGTC1, blocks.size(), &blocks[0]);
+
+	compressed = true;
+
+	volumeData.assign(data, data + num);
+	updateDerivedVolumes();
+}
+
+/**
+ * 指定した3Dデータを、thresholdより大きい値を含むブリックだけからなる疎な表現に変換してセットする。
+ * 占有されたブリックを詰めたアトラス（3Dテクスチャ）と、ブリック毎のアトラス内の位置を表す
+ * インデックステーブル（3Dテクスチャ）を転送するので、GPUメモリと転送量は占有された領域に比例する。
+ * 勾配や透過率などの派生ボリュームはCPUで密な配列から計算するので、CPU側には密な3Dデータを残す。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @param data		3Dデータ
+ * @param threshold	空とみなす値の上限
+ */
+void VolumeRendering::setSparseVolumeData(GLsizei width, GLsizei height, GLsizei depth, float* data, float threshold) {
+	PROFILE_SCOPE("setSparseVolumeData");
+	PROFILE_GPU_SCOPE("setSparseVolumeData");
+
+	GLint maxTextureSize;
+	glGetIntegerv(GL_MAX_3D_TEXTURE_SIZE, &maxTextureSize);
+
+	SparseVolume volume;
+	volume.build(width, height, depth, data, threshold, maxTextureSize);
+
+	int numBricks = volume.getBricksX() * volume.getBricksY() * volume.getBricksZ();
+	int slotSize = SparseVolume::SLOT_SIZE * SparseVolume::SLOT_SIZE * SparseVolume::SLOT_SIZE;
+	printf("Sparse: %d / %d bricks occupied, %.1f MB (dense: %.1f MB)\n", volume.getNumOccupied(), numBricks, volume.getNumOccupied() * slotSize * 2 / 1048576.0f, (float)width * height * depth * 2 / 1048576.0f);
+
+	// アトラスのサイズが変わらなければ、既存のテクスチャに上書きする
+	bool reuse = texture > 0 && sparse && isSameSize(width, height, depth) && atlasSize[0] == volume.getAtlasWidth() && atlasSize[1] == volume.getAtlasHeight() && atlasSize[2] == volume.getAtlasDepth();
+	if (!reuse) {
+		resetVolume(width, height, depth);
+
+		atlasSize[0] = volume.getAtlasWidth();
+		atlasSize[1] = volume.getAtlasHeight();
+		atlasSize[2] = volume.getAtlasDepth();
+		texture = createVolumeTexture(atlasSize[0], atlasSize[1], atlasSize[2]);
+
+		// インデックステーブルは補間しない
+		glGenTextures(1, &brickTableTexture);
+		glBindTexture(GL_TEXTURE_3D, brickTableTexture);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		if (GLEW_ARB_texture_storage) {
+			glTexStorage3D(GL_TEXTURE_3D, 1, GL_RGBA16UI, volume.getBricksX(), volume.getBricksY(), volume.getBricksZ());
+		} else {
+			glTexImage3D(GL_TEXTURE_3D, 0, GL_RGBA16UI, volume.getBricksX(), volume.getBricksY(), volume.getBricksZ(), 0, GL_RGBA_INTEGER, GL_UNSIGNED_SHORT, NULL);
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_3D, texture);
+	glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, atlasSize[0], atlasSize[1], atlasSize[2], GL_RED, GL_FLOAT, volume.getAtlas());
+
+	std::vector<unsigned short> table;
+	volume.getIndirectionTable(table);
+	glBindTexture(GL_TEXTURE_3D, brickTableTexture);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+	glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, volume.getBricksX(), volume.getBricksY(), volume.getBricksZ(), GL_RGBA_INTEGER, GL_UNSIGNED_SHORT, &table[0]);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	sparse = true;
+
+	volumeData.assign(data, data + width * height * depth);
+	updateDerivedVolumes();
+}
+
+/**
+ * 時系列データの再生用に、指定したサイズの3Dテクスチャを２つ確保する。
+ * 一方を描画に使っている間に、もう一方へ次のフレームを転送する（ピンポンバッファ）ので、
+ * フレーム毎にテクスチャを生成し直す必要がない。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ */
+void VolumeRendering::setSequenceFormat(GLsizei width, GLsizei height, GLsizei depth) {
+	if (texture > 0 && backTexture > 0 && !compressed && !sparse && isSameSize(width, height, depth)) return;
+
+	resetVolume(width, height, depth);
+
+	texture = createVolumeTexture(width, height, depth);
+	backTexture = createVolumeTexture(width, height, depth);
+}
+
+/**
+ * 次のフレームの3Dデータを、描画に使っていない方のテクスチャへglTexSubImage3Dで転送し、
+ * 表と裏のテクスチャを入れ替える。事前にsetSequenceFormatを呼んでおくこと。
+ *
+ * @param data		3Dデータ（setSequenceFormatで指定したサイズ）
+ */
+void VolumeRendering::updateVolumeData(float* data) {
+	PROFILE_SCOPE("updateVolumeData");
+	PROFILE_GPU_SCOPE("updateVolumeData");
+
+	if (backTexture == 0) return;
+
+	glBindTexture(GL_TEXTURE_3D, backTexture);
+	glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, gridWidth, gridHeight, gridDepth, GL_RED, GL_FLOAT, data);
+
+	std::swap(texture, backTexture);
+
+	delete pendingDelta;
+	pendingDelta = NULL;
+
+	volumeData.assign(data, data + gridWidth * gridHeight * gridDepth);
+	updateDerivedVolumes();
+}
+
+/**
+ * 前のフレームからの差分のうち、変化したブリックだけを、描画に使っていない方のテクスチャへ
+ * glTexSubImage3Dで転送し、表と裏のテクスチャを入れ替える。
+ * 裏のテクスチャには前回の差分がまだ反映されていないので、前回と今回の差分を統合して転送する。
+ * 最初のフレームは、FrameDelta::compute(NULL, data)で作ったキーフレームを渡すこと。
+ * （全体を転送するupdateVolumeData(float*)と混在させることはできない。）
+ *
+ * @param delta		前のフレームからの差分
+ * @return			転送したバイト数
+ */
+int VolumeRendering::updateVolumeData(const FrameDelta& delta) {
+	PROFILE_SCOPE("updateVolumeData(delta)");
+	PROFILE_GPU_SCOPE("updateVolumeData(delta)");
+
+	if (backTexture == 0) return 0;
+
+	FrameDelta merged(gridWidth, gridHeight, gridDepth);
+	if (pendingDelta != NULL) {
+		merged = *pendingDelta;
+	}
+	merged.merge(delta);
+
+	glBindTexture(GL_TEXTURE_3D, backTexture);
+	for (int i = 0; i < merged.numBricks(); ++i) {
+		int x0, y0, z0, w, h, d;
+		merged.getBrickExtent(merged.getBrick(i), x0, y0, z0, w, h, d);
+		glTexSubImage3D(GL_TEXTURE_3D, 0, x0, y0, z0, w, h, d, GL_RED, GL_FLOAT, merged.getBrickData(i));
+	}
+
+	std::swap(texture, backTexture);
+
+	delete pendingDelta;
+	pendingDelta = new FrameDelta(delta);
+
+	// CPU側のコピーには、今回の差分だけを反映すればよい
+	volumeData.resize(gridWidth * gridHeight * gridDepth);
+	delta.apply(&volumeData[0]);
+	updateDerivedVolumes();
+
+	return merged.byteSize();
+}
+
+/**
+ * 密度のウィンドウを設定する。シェーダでは、windowMin以下の密度を0、windowMaxの密度を1として
+ * 線形に変換してから描画する（windowMaxを超える密度は1より大きくなる）。
+ * 事前に計算するボリュームも、変換後の密度から作り直す。
+ *
+ * @param windowMin		ウィンドウの下限
+ * @param windowMax		ウィンドウの上限
+ */
+void VolumeRendering::setWindow(float windowMin, float windowMax) {
+	if (windowMax <= windowMin) {
+		windowMax = windowMin + 1e-6f;
+	}
+	if (this->windowMin == windowMin && this->windowMax == windowMax) return;
+
+	this->windowMin = windowMin;
+	this->windowMax = windowMax;
+	updateDerivedVolumes();
+}
+
+/**
+ * 勾配ボリュームを使ったBlinn-Phongシェーディングを行うかどうかを設定する。
+ * 有効にすると、光源へのレイマーチングの代わりに、勾配ボリュームから1回のフェッチで
+ * 法線を取得して陰影を付ける。勾配ボリュームは、3Dデータが更新される度に作り直す。
+ *
+ * @param shading	シェーディングを行うならtrue
+ */
+void VolumeRendering::setShading(bool shading) {
+	if (this->shading == shading) return;
+
+	this->shading = shading;
+	if (shading) {
+		updateGradientTexture();
+	} else if (gradientTexture > 0) {
+		glDeleteTextures(1, &gradientTexture);
+		gradientTexture = 0;
+	}
+}
+
+/**
+ * 光源の位置を設定する。座標は、3Dデータを[0, 1]の立方体とするテクスチャ座標で指定する。
+ * 事前計算した透過率ボリュームを使っている場合は、透過率ボリュームを作り直す。
+ * 作り直しはデータ全体を1回走査するだけなので、光源をインタラクティブに動かすことができる。
+ * アンビエントオクルージョンは光源に依存しないので、作り直さない。
+ *
+ * @param lightPos	光源の位置
+ */
+void VolumeRendering::setLightPosition(const QVector3D& lightPos) {
+	this->lightPos = lightPos;
+	if (precomputedLight) {
+		updateLightTexture();
 	}
 }
 
+/**
+ * 光源からの透過率を事前に計算したボリュームを使うかどうかを設定する。
+ * 有効にすると、サンプル毎に光源へのレイマーチングを行う代わりに、透過率ボリュームを1回フェッチする。
+ *
+ * @param precomputedLight	透過率ボリュームを使うならtrue
+ */
+void VolumeRendering::setPrecomputedLight(bool precomputedLight) {
+	if (this->precomputedLight == precomputedLight) return;
+
+	this->precomputedLight = precomputedLight;
+	if (precomputedLight) {
+		updateLightTexture();
+	} else if (lightTexture > 0) {
+		glDeleteTextures(1, &lightTexture);
+		lightTexture = 0;
+	}
+}
+
+/**
+ * 事前に計算したアンビエントオクルージョンを使うかどうかを設定する。
+ * 有効にすると、周囲の密度が高いほど暗くなり、密なデータでも形状が分かりやすくなる。
+ *
+ * @param ambientOcclusion	アンビエントオクルージョンを使うならtrue
+ */
+void VolumeRendering::setAmbientOcclusion(bool ambientOcclusion) {
+	if (this->ambientOcclusion == ambientOcclusion) return;
+
+	this->ambientOcclusion = ambientOcclusion;
+	if (ambientOcclusion) {
+		updateOcclusionTexture();
+	} else if (occlusionTexture > 0) {
+		glDeleteTextures(1, &occlusionTexture);
+		occlusionTexture = 0;
+	}
+}
+
+/**
+ * 描画モードを設定する。
+ * RENDER_VOLUMEはレイキャスティングによるボリュームレンダリング、
+ * RENDER_ISOSURFACEはMarching Cubesで抽出した等値面のメッシュの描画、
+ * RENDER_ISORAYCASTはレイが最初に等値面と交差する点だけを求めて陰影を付けるレイキャスティング、
+ * RENDER_MIP、RENDER_MINIP、RENDER_AVERAGEは、レイ上の密度の最大値、最小値、平均値の投影である。
+ *
+ * @param renderMode	描画モード
+ */
+void VolumeRendering::setRenderMode(int renderMode) {
+	this->renderMode = renderMode;
+}
+
+/**
+ * 等値面の値を設定する。値は、ウィンドウを適用した後の密度で指定する。
+ * 同じ値のメッシュは、3Dデータが変わるまでキャッシュするので、元の値に戻すのはすぐにできる。
+ *
+ * @param isoValue	等値面の値
+ */
+void VolumeRendering::setIsoValue(float isoValue) {
+	this->isoValue = isoValue;
+}
+
 /**
  * 画面のピクセルに対応する、キューブの前面／背面の交点を計算し、
  * destに括りついた２つの2Dテクスチャにそれぞれ格納する。
@@ -70,29 +547,94 @@ void VolumeRendering::setVolumeData(GLsizei width, GLsizei height, GLsizei depth
  * @param cameraPos		カメラの位置
  */
 void VolumeRendering::render(const QVector3D& cameraPos) {
+	PROFILE_SCOPE("render");
+	PROFILE_GPU_SCOPE("render");
+
 	if (boxVao == 0) return;
 
-	// キューブの前面／背面の交点を計算するGPUシェーダを選択
+	if (renderMode == RENDER_ISOSURFACE) {
+		// メッシュの描画にはレイが無いので、統計は空にする
+		memset(&rayStatistics, 0, sizeof(rayStatistics));
+		renderIsosurface(cameraPos);
+		return;
+	}
+
+	// 投影は、ブリック毎の最小値と最大値を使って、結果が変わらないブリックを読み飛ばす
+	// 粗い遮蔽のパスも、タイルのレイが通る範囲のブリックが空かどうかを調べるのに使う
+	if ((useEmptySkipping() || (occlusionCulling && renderMode == RENDER_VOLUME)) && minMaxTexture == 0) {
+		updateMinMaxTexture();
+	}
+
+	// 描画モードや有効な機能に応じたシェーダのバリアントを選択する
+	// 使わない分岐はコンパイル時に取り除かれるので、フラグメント毎に分岐を評価せずに済む
+	program = Util::LoadProgram("raycastvs", "raycastfs", getShaderDefines());
+
+	// 段階的に描画する場合は、視点などが変わるまで、開始位置をずらしたフレームを平均していく
+	// 十分な数を平均した後は、平均した画像を表示するだけでよい
+	bool accumulate = progressive && !statistics;
+	if (accumulate) {
+		updateAccumulation(cameraPos);
+		if (accumulatedFrames >= MAX_ACCUMULATED_FRAMES) {
+			accumulateFrame();
+			return;
+		}
+	}
+
+	// 再投影する場合は、前のフレームの各ピクセルを、最初に有意なサンプルの位置を使って今の視点に移し、
+	// 移せなかったピクセルだけレイを飛ばす
+	bool reproject = !accumulate && useReprojection();
+	if (reproject) {
+		updateHistory();
+		reprojectHistory();
+	}
+
+	// 粗い遮蔽のパスで、タイル毎にレイのうち寄与し得る範囲を求めておく
+	if (useOcclusionCulling()) {
+		renderOcclusionTiles(cameraPos);
+	}
+
 	glUseProgram(program);
     
-	// GPUシェーダに、パラメータを渡す
-	// シミュレーションをしているキューブが、ワールド座標系の原点を中心として、
-	// (-1,-1,-1) - (1,1,1)のサイズである。
-	// これに対して、カメラが移動しているので、このキューブを回転、移動しなければいけない。
-	// なので、modelviewMatrixとprojectionMatrixをカメラの位置などに基づいて計算し、
-	// シェーダに渡している。
-	glUniformMatrix4fv(glGetUniformLocation(program, "modelviewMatrix"), 1, 0, (float*)&modelviewMatrix);
-	glUniformMatrix4fv(glGetUniformLocation(program, "projectionMatrix"), 1, 0, (float*)&projectionMatrix);
-	glUniform3f(glGetUniformLocation(program, "gridSize"), gridWidth, gridHeight, gridDepth);
-	glUniform3f(glGetUniformLocation(program, "cameraPos"), cameraPos.x(), cameraPos.y(), cameraPos.z());
-    glUniform1i(glGetUniformLocation(program, "density"), 0);
+	setRaycastUniforms(program, cameraPos);
+    glUniform1i(glGetUniformLocation(program, "reprojectedColor"), 9);
+    glUniform1i(glGetUniformLocation(program, "reprojectedPosition"), 10);
+    glUniform1i(glGetUniformLocation(program, "occlusionTiles"), 11);
+	if (useOcclusionCulling()) {
+		GLint viewport[4];
+		glGetIntegerv(GL_VIEWPORT, viewport);
+		glUniform2f(glGetUniformLocation(program, "occlusionScale"), (float)occlusionSize[0] / viewport[2], (float)occlusionSize[1] / viewport[3]);
+	}
 
-	// フレームバッファとして０をバインドすることで、
+	// 描画先のフレームバッファ（通常は０）をバインドすることで、
 	// これ以降の描画は、実際のスクリーンに対して行われる。
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	// オフスクリーンで描画する場合は、OffscreenContextのフレームバッファに対して行われる。
+	// レイの統計を取る場合は、画面と同じサイズのテクスチャに統計を書き込み、後でヒートマップとして表示する
+	if (statistics) {
+		GLint viewport[4];
+		glGetIntegerv(GL_VIEWPORT, viewport);
+		updateStatisticsTarget(viewport[2], viewport[3]);
+		glBindFramebuffer(GL_FRAMEBUFFER, statsFbo);
+	} else if (accumulate) {
+		glBindFramebuffer(GL_FRAMEBUFFER, frameFbo);
+	} else if (reproject) {
+		glBindFramebuffer(GL_FRAMEBUFFER, historyFbos[currentHistory]);
+	} else {
+		glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+	}
 
-	// 密度データを格納した3Dテクスチャを、テクスチャ２として使用する
-	glActiveTexture(GL_TEXTURE0); glBindTexture(GL_TEXTURE_3D, texture);
+	bindVolumeTextures();
+
+	// 再投影した色と位置は、テクスチャ９と１０として使用する
+	if (reproject) {
+		glActiveTexture(GL_TEXTURE9); glBindTexture(GL_TEXTURE_2D, reprojTextures[0]);
+		glActiveTexture(GL_TEXTURE10); glBindTexture(GL_TEXTURE_2D, reprojTextures[1]);
+	}
+
+	// 粗い遮蔽のパスの結果は、テクスチャ１１として使用する
+	if (useOcclusionCulling()) {
+		glActiveTexture(GL_TEXTURE11); glBindTexture(GL_TEXTURE_2D, occlusionTilesTexture);
+	}
+	glActiveTexture(GL_TEXTURE0);
 
 	// rayと交差する２つの三角形のうち、カメラから遠いほうは、表面ではなく、背面から
 	// rayが当たるため、GL_CULL_FACEしちゃうと、rayが当たってないとして無視されちゃうので、
@@ -102,8 +644,15 @@ void VolumeRendering::render(const QVector3D& cameraPos) {
 	// GL_ONE、GL_ONEを指定してBLENDすることで、画面の各ピクセルに対応する２つの三角形の
 	// ワールド座標系での座標を、ORを使って、両方ともうまいこと記録できる。
 	// （詳細は、rayboxintersectfs.glslを参照のこと）
+	// シェーダは不透明度を乗じた色を出力するので、GL_ONEでブレンドする
     glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+	// 統計は回数なので、ブレンドせずにそのまま書き込む
+	// 再投影する場合も、位置をそのまま書き込むので、ブレンドはシェーダで行う
+	if (statistics || reproject) {
+		glDisable(GL_BLEND);
+	}
 
 	// クリアする色(0,0,0,0)を指定し、全画面をクリアする。
 	// これにより、画面の各ピクセルに対応する、キューブとの交点は0に初期化された
@@ -122,6 +671,995 @@ void VolumeRendering::render(const QVector3D& cameraPos) {
     glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, 0); // 頂点をindexで指定するので、glDrawElementsを使う
 	                                                        // また、index数は36個あるので、引数は36。
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+
+	if (statistics) {
+		collectStatistics();
+		renderHeatmap();
+	} else if (accumulate) {
+		accumulateFrame();
+	} else if (reproject) {
+		showHistory();
+	}
     glDisable(GL_BLEND);
 }
+
+/**
+ * 既存のテクスチャを削除し、サイズが変わった場合は、3Dデータを囲むボックスを生成し直す。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ */
+void VolumeRendering::resetVolume(GLsizei width, GLsizei height, GLsizei depth) {
+	if (texture > 0) {
+		glDeleteTextures(1, &texture);
+		texture = 0;
+	}
+	if (backTexture > 0) {
+		glDeleteTextures(1, &backTexture);
+		backTexture = 0;
+	}
+
+	delete pendingDelta;
+	pendingDelta = NULL;
+
+	if (!isSameSize(width, height, depth)) {
+		deleteBox();
+
+		gridWidth = width;
+		gridHeight = height;
+		gridDepth = depth;
+
+		// 3Dデータを囲むボックスを生成
+		boxVao = Util::CreateBoxVao(width, height, depth, boxVbos);
+
+		// 勾配ボリューム、透過率ボリューム、アンビエントオクルージョンもサイズが変わるので、作り直す
+		if (gradientTexture > 0) {
+			glDeleteTextures(1, &gradientTexture);
+			gradientTexture = 0;
+		}
+		if (lightTexture > 0) {
+			glDeleteTextures(1, &lightTexture);
+			lightTexture = 0;
+		}
+		if (occlusionTexture > 0) {
+			glDeleteTextures(1, &occlusionTexture);
+			occlusionTexture = 0;
+		}
+	}
+
+	if (brickTableTexture > 0) {
+		glDeleteTextures(1, &brickTableTexture);
+		brickTableTexture = 0;
+	}
+
+	compressed = false;
+	densityRange = 1.0f;
+	sparse = false;
+}
+
+/**
+ * 指定した幅、高さ、奥行きの3Dテクスチャを生成する。
+ * サイズが変わらない限り作り直さないので、可能ならglTexStorage3Dで不変のストレージを確保する。
+ * データはglTexSubImage3Dで転送すること。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @return			生成した3Dテクスチャ
+ */
+GLuint VolumeRendering::createVolumeTexture(GLsizei width, GLsizei height, GLsizei depth) {
+	// 3Dテクスチャを生成
+	GLuint tex;
+	glGenTextures(1, &tex);
+
+	// 生成した3Dテクスチャのパラメータを設定する
+	glBindTexture(GL_TEXTURE_3D, tex);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	// 3Dテクスチャ用のメモリを確保する
+	if (GLEW_ARB_texture_storage) {
+		glTexStorage3D(GL_TEXTURE_3D, 1, GL_R16F, width, height, depth);
+	} else {
+		glTexImage3D(GL_TEXTURE_3D, 0, GL_R16F, width, height, depth, 0, GL_RED, GL_FLOAT, NULL);
+	}
+    if (GL_NO_ERROR != glGetError()) {
+		std::cout << "Unable to create 3D texture"<< std::endl;
+	}
+
+	return tex;
+}
+
+/**
+ * 現在のボックスが、指定したサイズの3Dデータ用かどうかを返却する。
+ *
+ * @param width		幅
+ * @param height	高さ
+ * @param depth		奥行き
+ * @return			同じサイズならtrue
+ */
+bool VolumeRendering::isSameSize(GLsizei width, GLsizei height, GLsizei depth) {
+	return boxVao > 0 && gridWidth == width && gridHeight == height && gridDepth == depth;
+}
+
+/**
+ * 3Dデータを囲むボックスのVAOとVBOを削除する。
+ */
+void VolumeRendering::deleteBox() {
+	if (boxVao > 0) {
+		glDeleteVertexArrays(1, &boxVao);
+		boxVao = 0;
+	}
+	if (boxVbos[0] > 0) {
+		glDeleteBuffers(2, boxVbos);
+		boxVbos[0] = 0;
+		boxVbos[1] = 0;
+	}
+}
+
+/**
+ * CPU側に保持している3Dデータから計算する、補助的なボリュームを更新する。
+ * 3Dデータをセット、更新する度に呼び出す。
+ */
+void VolumeRendering::updateDerivedVolumes() {
+	PROFILE_SCOPE("updateDerivedVolumes");
+	PROFILE_GPU_SCOPE("updateDerivedVolumes");
+
+	windowedData.clear();
+	minMaxBricks.clear();
+	clearMeshCache();
+
+	// 平均していたフレームや、再投影する前のフレームは古いデータのものなので、やり直す
+	accumulatedFrames = 0;
+	historyValid = false;
+	if (minMaxTexture > 0) {
+		glDeleteTextures(1, &minMaxTexture);
+		minMaxTexture = 0;
+	}
+
+	if (shading) {
+		updateGradientTexture();
+	}
+	if (precomputedLight) {
+		updateLightTexture();
+	}
+	if (ambientOcclusion) {
+		updateOcclusionTexture();
+	}
+}
+
+/**
+ * CPU側に保持している3Dデータに、シェーダと同じウィンドウを適用する。
+ * 結果は、3Dデータが更新されるまで、事前に計算する各ボリュームで共有する。
+ */
+void VolumeRendering::applyWindow() {
+	int num = volumeData.size();
+	windowedData.resize(num);
+
+	float scale = 1.0f / (windowMax - windowMin);
+	#pragma omp parallel for
+	for (int i = 0; i < num; ++i) {
+		float d = volumeData[i] - windowMin;
+		windowedData[i] = d > 0.0f ? d * scale : 0.0f;
+	}
+}
+
+/**
+ * ウィンドウを適用した3Dデータから勾配ボリュームを計算し、RGBA8の3Dテクスチャに転送する。
+ * サイズが変わらない限り、テクスチャは作り直さない。
+ */
+void VolumeRendering::updateGradientTexture() {
+	if (volumeData.empty()) return;
+	if (windowedData.empty()) applyWindow();
+
+	std::vector<unsigned char> gradients;
+	GradientVolume::compute(gridWidth, gridHeight, gridDepth, &windowedData[0], gradients);
+
+	if (gradientTexture == 0) {
+		glGenTextures(1, &gradientTexture);
+		glBindTexture(GL_TEXTURE_3D, gradientTexture);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		if (GLEW_ARB_texture_storage) {
+			glTexStorage3D(GL_TEXTURE_3D, 1, GL_RGBA8, gridWidth, gridHeight, gridDepth);
+		} else {
+			glTexImage3D(GL_TEXTURE_3D, 0, GL_RGBA8, gridWidth, gridHeight, gridDepth, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+		}
+		if (GL_NO_ERROR != glGetError()) {
+			std::cout << "Unable to create gradient texture"<< std::endl;
+		}
+	}
+
+	glBindTexture(GL_TEXTURE_3D, gradientTexture);
+	glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, gridWidth, gridHeight, gridDepth, GL_RGBA, GL_UNSIGNED_BYTE, &gradients[0]);
+}
+
+/**
+ * ウィンドウを適用した3Dデータと光源の位置から透過率ボリュームを計算し、3Dテクスチャに転送する。
+ * サイズが変わらない限り、テクスチャは作り直さない。
+ */
+void VolumeRendering::updateLightTexture() {
+	if (volumeData.empty()) return;
+	if (windowedData.empty()) applyWindow();
+
+	std::vector<float> transmittance;
+	LightVolume::compute(gridWidth, gridHeight, gridDepth, &windowedData[0], lightPos.x(), lightPos.y(), lightPos.z(), LIGHT_ABSORPTION, transmittance);
+
+	if (lightTexture == 0) {
+		lightTexture = createVolumeTexture(gridWidth, gridHeight, gridDepth);
+	}
+
+	glBindTexture(GL_TEXTURE_3D, lightTexture);
+	glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, gridWidth, gridHeight, gridDepth, GL_RED, GL_FLOAT, &transmittance[0]);
+}
+
+/**
+ * ウィンドウを適用した3Dデータからアンビエントオクルージョンを計算し、3Dテクスチャに転送する。
+ * サイズが変わらない限り、テクスチャは作り直さない。
+ */
+void VolumeRendering::updateOcclusionTexture() {
+	if (volumeData.empty()) return;
+	if (windowedData.empty()) applyWindow();
+
+	std::vector<float> visibility;
+	AmbientOcclusionVolume::compute(gridWidth, gridHeight, gridDepth, &windowedData[0], visibility);
+
+	if (occlusionTexture == 0) {
+		occlusionTexture = createVolumeTexture(gridWidth, gridHeight, gridDepth);
+	}
+
+	glBindTexture(GL_TEXTURE_3D, occlusionTexture);
+	glTexSubImage3D(GL_TEXTURE_3D, 0, 0, 0, 0, gridWidth, gridHeight, gridDepth, GL_RED, GL_FLOAT, &visibility[0]);
+}
+
+/**
+ * 現在の等値面の値のメッシュを、デプステストを有効にして描画する。
+ *
+ * @param cameraPos		カメラの位置
+ */
+void VolumeRendering::renderIsosurface(const QVector3D& cameraPos) {
+	const IsosurfaceMesh& mesh = getIsosurfaceMesh();
+
+	glUseProgram(meshProgram);
+	glUniformMatrix4fv(glGetUniformLocation(meshProgram, "modelviewMatrix"), 1, 0, (float*)&modelviewMatrix);
+	glUniformMatrix4fv(glGetUniformLocation(meshProgram, "projectionMatrix"), 1, 0, (float*)&projectionMatrix);
+	glUniform3f(glGetUniformLocation(meshProgram, "gridSize"), gridWidth, gridHeight, gridDepth);
+	glUniform3f(glGetUniformLocation(meshProgram, "cameraPos"), cameraPos.x(), cameraPos.y(), cameraPos.z());
+	glUniform3f(glGetUniformLocation(meshProgram, "lightPos"), lightPos.x(), lightPos.y(), lightPos.z());
+
+	glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+	glClearColor(0, 0, 0, 0);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	// 境界で切れた等値面の裏側も見えるので、カリングはしない
+	glEnable(GL_DEPTH_TEST);
+	glDisable(GL_CULL_FACE);
+
+	if (mesh.numIndices > 0) {
+		glBindVertexArray(mesh.vao);
+		glDrawElements(GL_TRIANGLES, mesh.numIndices, GL_UNSIGNED_INT, 0);
+		glBindVertexArray(0);
+	}
+
+	glDisable(GL_DEPTH_TEST);
+}
+
+/**
+ * 現在の等値面の値のメッシュを返却する。キャッシュに無ければ、Marching Cubesで抽出してVBOに転送し、
+ * キャッシュに追加する。キャッシュがいっぱいなら、最も古いメッシュを削除する。
+ *
+ * @return		等値面のメッシュ
+ */
+const VolumeRendering::IsosurfaceMesh& VolumeRendering::getIsosurfaceMesh() {
+	std::map<float, IsosurfaceMesh>::iterator it = meshCache.find(isoValue);
+	if (it != meshCache.end()) return it->second;
+
+	buildMinMaxBricks();
+
+	std::vector<MarchingCubes::Vertex> vertices;
+	std::vector<unsigned int> indices;
+	if (!windowedData.empty()) {
+		MarchingCubes::extract(gridWidth, gridHeight, gridDepth, &windowedData[0], minMaxBricks, isoValue, vertices, indices);
+	}
+	printf("Isosurface %.3f: %d vertices, %d triangles\n", isoValue, (int)vertices.size(), (int)indices.size() / 3);
+
+	if ((int)meshCacheOrder.size() >= MAX_CACHED_MESHES) {
+		IsosurfaceMesh& oldest = meshCache[meshCacheOrder[0]];
+		if (oldest.vao > 0) {
+			glDeleteVertexArrays(1, &oldest.vao);
+			glDeleteBuffers(2, oldest.vbos);
+		}
+		meshCache.erase(meshCacheOrder[0]);
+		meshCacheOrder.erase(meshCacheOrder.begin());
+	}
+
+	IsosurfaceMesh mesh;
+	mesh.vao = 0;
+	mesh.vbos[0] = 0;
+	mesh.vbos[1] = 0;
+	mesh.numIndices = indices.size();
+	if (!indices.empty()) {
+		mesh.vao = Util::CreateMeshVao((float*)&vertices[0], vertices.size(), &indices[0], indices.size(), mesh.vbos);
+	}
+
+	meshCacheOrder.push_back(isoValue);
+	return meshCache[isoValue] = mesh;
+}
+
+/**
+ * キャッシュしている等値面のメッシュを、すべて削除する。
+ */
+void VolumeRendering::clearMeshCache() {
+	for (std::map<float, IsosurfaceMesh>::iterator it = meshCache.begin(); it != meshCache.end(); ++it) {
+		if (it->second.vao > 0) {
+			glDeleteVertexArrays(1, &it->second.vao);
+			glDeleteBuffers(2, it->second.vbos);
+		}
+	}
+	meshCache.clear();
+	meshCacheOrder.clear();
+}
+
+/**
+ * ウィンドウを適用した3Dデータから、ブリック毎の最小値と最大値を求める。
+ * 3Dデータが更新されるまでは、作り直さない。
+ */
+void VolumeRendering::buildMinMaxBricks() {
+	if (!minMaxBricks.isEmpty() || volumeData.empty()) return;
+
+	if (windowedData.empty()) applyWindow();
+	minMaxBricks.build(gridWidth, gridHeight, gridDepth, &windowedData[0]);
+}
+
+/**
+ * ブリック毎の最小値と最大値を、RG32Fの3Dテクスチャに転送する。
+ * 補間すると値が変わってしまうので、GL_NEARESTでフェッチする。
+ */
+void VolumeRendering::updateMinMaxTexture() {
+	buildMinMaxBricks();
+	if (minMaxBricks.isEmpty()) return;
+
+	int bricksX = minMaxBricks.getBricksX();
+	int bricksY = minMaxBricks.getBricksY();
+	int bricksZ = minMaxBricks.getBricksZ();
+	std::vector<float> ranges(bricksX * bricksY * bricksZ * 2);
+	for (int bz = 0; bz < bricksZ; ++bz) {
+		for (int by = 0; by < bricksY; ++by) {
+			for (int bx = 0; bx < bricksX; ++bx) {
+				int i = (bz * bricksY + by) * bricksX + bx;
+				ranges[i * 2] = minMaxBricks.getMin(bx, by, bz);
+				ranges[i * 2 + 1] = minMaxBricks.getMax(bx, by, bz);
+			}
+		}
+	}
+
+	glGenTextures(1, &minMaxTexture);
+	glBindTexture(GL_TEXTURE_3D, minMaxTexture);
+	glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexImage3D(GL_TEXTURE_3D, 0, GL_RG32F, bricksX, bricksY, bricksZ, 0, GL_RG, GL_FLOAT, &ranges[0]);
+	if (GL_NO_ERROR != glGetError()) {
+		std::cout << "Unable to create min-max texture"<< std::endl;
+	}
+}
+
+/**
+ * ブリック毎の最小値と最大値を使って、空のブリックを読み飛ばすかどうかを返却する。
+ * 結果が変わらないブリックを判定できるのは、投影の場合だけである。
+ *
+ * @return		読み飛ばす場合はtrue
+ */
+bool VolumeRendering::useEmptySkipping() const {
+	return renderMode == RENDER_MIP || renderMode == RENDER_MINIP || renderMode == RENDER_AVERAGE;
+}
+
+/**
+ * 現在の描画モードや有効な機能から、raycastfs.glslのバリアントを指定する#defineの並びを生成する。
+ * 同じ並びに対しては、Util::LoadProgramがキャッシュしたプログラムを返却する。
+ *
+ * @param occlusionPass		粗い遮蔽のパスのバリアントの場合はtrue
+ * @return					シェーダに挿入する#defineの並び
+ */
+std::string VolumeRendering::getShaderDefines(bool occlusionPass) const {
+	int storage = 0;
+	if (compressed) {
+		storage = 1;
+	} else if (sparse) {
+		storage = 2;
+	}
+
+	char defines[1024];
+	sprintf(defines,
+		"#define RENDER_MODE %d\n"
+		"#define STORAGE %d\n"
+		"#define SHADING %d\n"
+		"#define PRECOMPUTED_LIGHT %d\n"
+		"#define AMBIENT_OCCLUSION %d\n"
+		"#define EMPTY_SKIPPING %d\n"
+		"#define LIGHT_SAMPLES %d\n"
+		"#define STATISTICS %d\n"
+		"#define STEP_SIZE (1.0 / %d.0)\n"
+		"#define JITTER %d\n"
+		"#define REPROJECTION %d\n"
+		"#define OCCLUSION_PASS %d\n"
+		"#define OCCLUSION_CULLING %d\n"
+		"#define OCCLUSION_TILE_SIZE %d\n",
+		renderMode,
+		storage,
+		shading && gradientTexture > 0 ? 1 : 0,
+		precomputedLight && lightTexture > 0 ? 1 : 0,
+		ambientOcclusion && occlusionTexture > 0 ? 1 : 0,
+		useEmptySkipping() && minMaxTexture > 0 ? 1 : 0,
+		LIGHT_SAMPLES,
+		statistics && !occlusionPass ? 1 : 0,
+		// %fはロケールによって小数点がカンマになり、シェーダがコンパイルできなくなるので、逆数の整数で渡す
+		(int)(1.0f / (progressive ? PROGRESSIVE_STEP_SIZE : STEP_SIZE) + 0.5f),
+		progressive && !occlusionPass ? 1 : 0,
+		useReprojection() && !occlusionPass ? 1 : 0,
+		occlusionPass ? 1 : 0,
+		useOcclusionCulling() && !occlusionPass ? 1 : 0,
+		OCCLUSION_TILE_SIZE);
+	return defines;
+}
+
+/**
+ * レイ毎の統計（ループの反復回数、密度のサンプル数、光源へのレイマーチングのステップ数、打ち切り）を
+ * 取るかどうかを設定する。
+ * 取る場合は、レイキャスティングの結果の代わりに、レイ毎のコストをヒートマップとして表示する。
+ * 統計は毎フレームGPUから読み戻すので、描画は遅くなる。
+ *
+ * @param statistics	統計を取る場合はtrue
+ */
+void VolumeRendering::setStatistics(bool statistics) {
+	this->statistics = statistics;
+	memset(&rayStatistics, 0, sizeof(rayStatistics));
+}
+
+/**
+ * レイの統計を書き込むフレームバッファを、画面のサイズで用意する。
+ * raycastfs.glslは、色をlocation 0、統計をlocation 1に出力するので、統計のテクスチャを
+ * GL_COLOR_ATTACHMENT1にアタッチし、色は捨てる。
+ *
+ * @param width		画面の幅
+ * @param height	画面の高さ
+ */
+void VolumeRendering::updateStatisticsTarget(int width, int height) {
+	if (statsTexture > 0 && statsSize[0] == width && statsSize[1] == height) return;
+
+	if (statsTexture == 0) {
+		glGenTextures(1, &statsTexture);
+		glGenFramebuffers(1, &statsFbo);
+	}
+	statsSize[0] = width;
+	statsSize[1] = height;
+
+	glBindTexture(GL_TEXTURE_2D, statsTexture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, statsFbo);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, statsTexture, 0);
+	GLenum drawBuffers[2] = { GL_NONE, GL_COLOR_ATTACHMENT1 };
+	glDrawBuffers(2, drawBuffers);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+		std::cout << "Ray statistics framebuffer is incomplete." << std::endl;
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+}
+
+/**
+ * レイの統計をGPUから読み戻し、フレーム全体で集計する。
+ * ヒートマップは、このフレームで最もコストが高いレイを基準に色付けする。
+ */
+void VolumeRendering::collectStatistics() {
+	int numPixels = statsSize[0] * statsSize[1];
+	std::vector<float> stats(numPixels * 4);
+	glBindTexture(GL_TEXTURE_2D, statsTexture);
+	glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_FLOAT, &stats[0]);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	memset(&rayStatistics, 0, sizeof(rayStatistics));
+	for (int i = 0; i < numPixels; ++i) {
+		const float* s = &stats[i * 4];
+
+		// 箱に当たらなかったピクセルは、レイが無いので数えない
+		if (s[0] == 0.0f) continue;
+
+		rayStatistics.rays++;
+		rayStatistics.iterations += s[0];
+		rayStatistics.samples += s[1];
+		rayStatistics.lightSteps += s[2];
+		if (s[3] > 0.5f) rayStatistics.terminated++;
+		rayStatistics.maxCost = std::max(rayStatistics.maxCost, s[1] + s[2]);
+	}
+}
+
+/**
+ * レイ毎のコスト（密度のサンプル数と光源へのレイマーチングのステップ数の和）を、
+ * 画面全体を覆う四角形にヒートマップとして描画する。
+ */
+void VolumeRendering::renderHeatmap() {
+	glUseProgram(heatmapProgram);
+	glUniform1i(glGetUniformLocation(heatmapProgram, "statistics"), 7);
+	glUniform1f(glGetUniformLocation(heatmapProgram, "maxCost"), rayStatistics.maxCost);
+
+	glActiveTexture(GL_TEXTURE7); glBindTexture(GL_TEXTURE_2D, statsTexture);
+	glActiveTexture(GL_TEXTURE0);
+
+	glDisable(GL_BLEND);
+	drawQuad();
+}
+
+/**
+ * 段階的な描画の有効／無効を設定する。
+ * 有効な場合は、サンプル間隔を広げ、レイの開始位置をブルーノイズでずらして描画し、
+ * カメラが止まっている間、フレームを平均して画質を上げていく。
+ *
+ * @param progressive	段階的に描画する場合はtrue
+ */
+void VolumeRendering::setProgressive(bool progressive) {
+	this->progressive = progressive;
+	accumulatedFrames = 0;
+}
+
+/**
+ * 段階的な描画で、まだ平均するフレームが残っているかどうかを返却する。
+ * trueの場合、呼び出し側は続けて描画すること。
+ *
+ * @return		続けて描画する必要がある場合はtrue
+ */
+bool VolumeRendering::needsRefinement() const {
+	if (!progressive || statistics || renderMode == RENDER_ISOSURFACE || boxVao == 0) return false;
+
+	return accumulatedFrames < MAX_ACCUMULATED_FRAMES;
+}
+
+/**
+ * 平均に使うフレームバッファを画面のサイズで用意し、視点やパラメータが前回から変わっていたら、
+ * 平均をやり直す。3Dデータや窓の変更は、updateDerivedVolumesでやり直しになる。
+ *
+ * @param cameraPos		カメラの位置
+ */
+void VolumeRendering::updateAccumulation(const QVector3D& cameraPos) {
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	if (frameTexture == 0 || accumSize[0] != viewport[2] || accumSize[1] != viewport[3]) {
+		createColorTarget(viewport[2], viewport[3], frameFbo, frameTexture);
+		createColorTarget(viewport[2], viewport[3], accumFbo, accumTexture);
+		accumSize[0] = viewport[2];
+		accumSize[1] = viewport[3];
+		accumulatedFrames = 0;
+	}
+
+	// 画像に影響するものを並べて、前回と比較する
+	std::vector<float> key(modelviewMatrix, modelviewMatrix + 16);
+	key.insert(key.end(), projectionMatrix, projectionMatrix + 16);
+	key.push_back(cameraPos.x());
+	key.push_back(cameraPos.y());
+	key.push_back(cameraPos.z());
+	key.push_back(lightPos.x());
+	key.push_back(lightPos.y());
+	key.push_back(lightPos.z());
+	key.push_back(isoValue);
+	key.push_back(windowMin);
+	key.push_back(windowMax);
+	key.push_back(terminationThreshold);
+	key.push_back((float)program);
+	if (key != accumulationKey) {
+		accumulationKey = key;
+		accumulatedFrames = 0;
+	}
+}
+
+/**
+ * 指定したサイズのRGBA32Fのテクスチャを色として持つフレームバッファを生成する。
+ * 既に生成されている場合は、テクスチャのサイズだけ変更する。
+ *
+ * @param width				幅
+ * @param height			高さ
+ * @param fbo [IN/OUT]		フレームバッファ
+ * @param texture [IN/OUT]	テクスチャ
+ */
+void VolumeRendering::createColorTarget(int width, int height, GLuint& fbo, GLuint& texture) {
+	if (texture == 0) {
+		glGenTextures(1, &texture);
+		glGenFramebuffers(1, &fbo);
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+	glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+		std::cout << "Color target framebuffer is incomplete." << std::endl;
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+}
+
+/**
+ * 描画したフレームを平均に加え、平均した画像を画面に表示する。
+ * n枚目のフレームを重み1/nでブレンドすると、それまでの平均が保たれる。
+ * 十分な数を平均した後は、表示だけを行う。
+ */
+void VolumeRendering::accumulateFrame() {
+	if (accumulatedFrames < MAX_ACCUMULATED_FRAMES) {
+		glBindFramebuffer(GL_FRAMEBUFFER, accumFbo);
+		glUseProgram(accumulateProgram);
+		glUniform1i(glGetUniformLocation(accumulateProgram, "frame"), 7);
+		glActiveTexture(GL_TEXTURE7); glBindTexture(GL_TEXTURE_2D, frameTexture);
+		glActiveTexture(GL_TEXTURE0);
+
+		glEnable(GL_BLEND);
+		glBlendColor(0.0f, 0.0f, 0.0f, 1.0f / (accumulatedFrames + 1));
+		glBlendFunc(GL_CONSTANT_ALPHA, GL_ONE_MINUS_CONSTANT_ALPHA);
+		drawQuad();
+		glDisable(GL_BLEND);
+
+		accumulatedFrames++;
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, accumFbo);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, targetFbo);
+	glBlitFramebuffer(0, 0, accumSize[0], accumSize[1], 0, 0, accumSize[0], accumSize[1], GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+}
+
+/**
+ * 画面全体を覆う四角形を描画する。
+ */
+void VolumeRendering::drawQuad() {
+	if (quadVao == 0) {
+		quadVao = Util::CreateQuadVao(&quadVbo);
+	}
+
+	glBindVertexArray(quadVao);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	glBindVertexArray(0);
+}
+
+/**
+ * 時間方向の再投影の有効／無効を設定する。
+ * 有効な場合は、カメラが動いている間、前のフレームを今の視点に再投影して使い回し、
+ * 見えるようになったピクセルや、再投影できなかったピクセルだけレイを飛ばす。
+ *
+ * @param reprojection	再投影する場合はtrue
+ */
+void VolumeRendering::setReprojection(bool reprojection) {
+	this->reprojection = reprojection;
+	historyValid = false;
+}
+
+/**
+ * 前のフレームを破棄し、次のフレームでは全てのピクセルにレイを飛ばす。
+ * カメラが止まった時などに呼び出すと、再投影による誤差の無い画像になる。
+ */
+void VolumeRendering::invalidateHistory() {
+	historyValid = false;
+}
+
+/**
+ * 再投影するかどうかを返却する。
+ * 最初に有意なサンプルの位置が決まるのは、ボリュームレンダリングと等値面のレイキャスティングだけである。
+ * 段階的な描画や統計とは組み合わせない。
+ *
+ * @return		再投影する場合はtrue
+ */
+bool VolumeRendering::useReprojection() const {
+	if (!reprojection || statistics || progressive) return false;
+
+	return renderMode == RENDER_VOLUME || renderMode == RENDER_ISORAYCAST;
+}
+
+/**
+ * 前のフレームと再投影先のフレームバッファを画面のサイズで用意し、
+ * 視点以外の画像に影響するものが前回から変わっていたら、前のフレームを破棄する。
+ * それぞれ、色をGL_COLOR_ATTACHMENT0、最初に有意なサンプルの位置をGL_COLOR_ATTACHMENT1に持つ。
+ */
+void VolumeRendering::updateHistory() {
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	if (reprojFbo == 0 || historySize[0] != viewport[2] || historySize[1] != viewport[3]) {
+		if (reprojFbo == 0) {
+			glGenFramebuffers(2, historyFbos);
+			glGenTextures(4, &historyTextures[0][0]);
+			glGenFramebuffers(1, &reprojFbo);
+			glGenTextures(2, reprojTextures);
+			glGenRenderbuffers(1, &reprojDepth);
+		}
+		historySize[0] = viewport[2];
+		historySize[1] = viewport[3];
+
+		GLuint fbos[3] = { historyFbos[0], historyFbos[1], reprojFbo };
+		GLuint* textures[3] = { historyTextures[0], historyTextures[1], reprojTextures };
+		for (int i = 0; i < 3; ++i) {
+			glBindFramebuffer(GL_FRAMEBUFFER, fbos[i]);
+			for (int j = 0; j < 2; ++j) {
+				glBindTexture(GL_TEXTURE_2D, textures[i][j]);
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, viewport[2], viewport[3], 0, GL_RGBA, GL_FLOAT, NULL);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+				glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + j, GL_TEXTURE_2D, textures[i][j], 0);
+			}
+			GLenum drawBuffers[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+			glDrawBuffers(2, drawBuffers);
+
+			// 再投影では、複数のピクセルが同じ位置に移った時に、手前のものを残す
+			if (fbos[i] == reprojFbo) {
+				glBindRenderbuffer(GL_RENDERBUFFER, reprojDepth);
+				glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, viewport[2], viewport[3]);
+				glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, reprojDepth);
+				glBindRenderbuffer(GL_RENDERBUFFER, 0);
+			}
+			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+				std::cout << "Reprojection framebuffer is incomplete." << std::endl;
+			}
+		}
+		glBindTexture(GL_TEXTURE_2D, 0);
+		glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+		historyValid = false;
+	}
+
+	// 視点は再投影で補うので、それ以外の画像に影響するものを並べて、前回と比較する
+	std::vector<float> key;
+	key.push_back(lightPos.x());
+	key.push_back(lightPos.y());
+	key.push_back(lightPos.z());
+	key.push_back(isoValue);
+	key.push_back(windowMin);
+	key.push_back(windowMax);
+	key.push_back(terminationThreshold);
+	key.push_back((float)program);
+	if (key != historyKey) {
+		historyKey = key;
+		historyValid = false;
+	}
+}
+
+/**
+ * 前のフレームの各ピクセルを点として、最初に有意なサンプルの位置に描画し、今の視点に再投影する。
+ * 点が描画されなかったピクセルは、位置のwが０のままになり、raycastfs.glslでレイを飛ばす。
+ * 使い回した回数がMAX_REPROJECTED_FRAMESに達したピクセルも、誤差が溜まらないように描画しない。
+ */
+void VolumeRendering::reprojectHistory() {
+	glBindFramebuffer(GL_FRAMEBUFFER, reprojFbo);
+	glClearColor(0, 0, 0, 0);
+	glClearDepth(1.0);
+	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+	if (historyValid) {
+		int previous = 1 - currentHistory;
+
+		glUseProgram(reprojectProgram);
+		glUniformMatrix4fv(glGetUniformLocation(reprojectProgram, "modelviewMatrix"), 1, 0, (float*)&modelviewMatrix);
+		glUniformMatrix4fv(glGetUniformLocation(reprojectProgram, "projectionMatrix"), 1, 0, (float*)&projectionMatrix);
+		glUniform3f(glGetUniformLocation(reprojectProgram, "gridSize"), gridWidth, gridHeight, gridDepth);
+		glUniform1i(glGetUniformLocation(reprojectProgram, "previousColor"), 9);
+		glUniform1i(glGetUniformLocation(reprojectProgram, "previousPosition"), 10);
+		glUniform1f(glGetUniformLocation(reprojectProgram, "maxAge"), MAX_REPROJECTED_FRAMES);
+
+		glActiveTexture(GL_TEXTURE9); glBindTexture(GL_TEXTURE_2D, historyTextures[previous][0]);
+		glActiveTexture(GL_TEXTURE10); glBindTexture(GL_TEXTURE_2D, historyTextures[previous][1]);
+		glActiveTexture(GL_TEXTURE0);
+
+		// 頂点属性は使わず、gl_VertexIDからピクセルを求める
+		if (pointVao == 0) {
+			glGenVertexArrays(1, &pointVao);
+		}
+		glDisable(GL_BLEND);
+		glEnable(GL_DEPTH_TEST);
+		glDepthFunc(GL_LESS);
+		glBindVertexArray(pointVao);
+		glDrawArrays(GL_POINTS, 0, historySize[0] * historySize[1]);
+		glBindVertexArray(0);
+		glDisable(GL_DEPTH_TEST);
+	}
+
+	glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+}
+
+/**
+ * レイキャスティングの結果を画面に表示し、次のフレームで再投影する前のフレームとする。
+ */
+void VolumeRendering::showHistory() {
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, historyFbos[currentHistory]);
+	glReadBuffer(GL_COLOR_ATTACHMENT0);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, targetFbo);
+	glBlitFramebuffer(0, 0, historySize[0], historySize[1], 0, 0, historySize[0], historySize[1], GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+
+	currentHistory = 1 - currentHistory;
+	historyValid = true;
+}
+
+/**
+ * レイキャスティングのシェーダに、視点やボリュームのパラメータと、テクスチャユニットを渡す。
+ * 粗い遮蔽のパスと、画面の解像度のパスで共通である。
+ *
+ * @param shader		raycastfs.glslのバリアント
+ * @param cameraPos		カメラの位置
+ */
+void VolumeRendering::setRaycastUniforms(GLuint shader, const QVector3D& cameraPos) {
+	// GPUシェーダに、パラメータを渡す
+	// シミュレーションをしているキューブが、ワールド座標系の原点を中心として、
+	// (-1,-1,-1) - (1,1,1)のサイズである。
+	// これに対して、カメラが移動しているので、このキューブを回転、移動しなければいけない。
+	// なので、modelviewMatrixとprojectionMatrixをカメラの位置などに基づいて計算し、
+	// シェーダに渡している。
+	glUniformMatrix4fv(glGetUniformLocation(shader, "modelviewMatrix"), 1, 0, (float*)&modelviewMatrix);
+	glUniformMatrix4fv(glGetUniformLocation(shader, "projectionMatrix"), 1, 0, (float*)&projectionMatrix);
+	glUniform3f(glGetUniformLocation(shader, "gridSize"), gridWidth, gridHeight, gridDepth);
+	glUniform3f(glGetUniformLocation(shader, "cameraPos"), cameraPos.x(), cameraPos.y(), cameraPos.z());
+    glUniform1i(glGetUniformLocation(shader, "density"), 0);
+    glUniform1i(glGetUniformLocation(shader, "compressedDensity"), 1);
+	glUniform1f(glGetUniformLocation(shader, "densityRange"), densityRange);
+    glUniform1i(glGetUniformLocation(shader, "brickTable"), 2);
+	glUniform3f(glGetUniformLocation(shader, "atlasSize"), atlasSize[0], atlasSize[1], atlasSize[2]);
+    glUniform1i(glGetUniformLocation(shader, "gradients"), 3);
+	glUniform1f(glGetUniformLocation(shader, "windowMin"), windowMin);
+	glUniform1f(glGetUniformLocation(shader, "windowMax"), windowMax);
+	glUniform3f(glGetUniformLocation(shader, "lightPos"), lightPos.x(), lightPos.y(), lightPos.z());
+    glUniform1i(glGetUniformLocation(shader, "lightVolume"), 4);
+    glUniform1i(glGetUniformLocation(shader, "occlusionVolume"), 5);
+	glUniform1f(glGetUniformLocation(shader, "isoValue"), isoValue);
+    glUniform1i(glGetUniformLocation(shader, "minMaxBricks"), 6);
+    glUniform1i(glGetUniformLocation(shader, "blueNoise"), 8);
+	glUniform1i(glGetUniformLocation(shader, "frameIndex"), accumulatedFrames);
+	glUniform1f(glGetUniformLocation(shader, "terminationThreshold"), terminationThreshold);
+}
+
+/**
+ * レイキャスティングで参照する3Dデータと、事前に計算したボリュームのテクスチャをバインドする。
+ */
+void VolumeRendering::bindVolumeTextures() {
+	// 密度データを格納した3Dテクスチャを、テクスチャ２として使用する
+	// BC4圧縮されている場合は、2Dテクスチャ配列をテクスチャ１として使用する
+	if (compressed) {
+		glActiveTexture(GL_TEXTURE1); glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+	} else {
+		glActiveTexture(GL_TEXTURE0); glBindTexture(GL_TEXTURE_3D, texture);
+	}
+
+	// 疎な表現の場合は、テクスチャ０がアトラスとなり、インデックステーブルをテクスチャ２として使用する
+	if (sparse) {
+		glActiveTexture(GL_TEXTURE2); glBindTexture(GL_TEXTURE_3D, brickTableTexture);
+	}
+
+	// 勾配ボリュームは、常に元の3Dデータと同じサイズの3Dテクスチャで、テクスチャ３として使用する
+	if (shading && gradientTexture > 0) {
+		glActiveTexture(GL_TEXTURE3); glBindTexture(GL_TEXTURE_3D, gradientTexture);
+	}
+
+	// 透過率ボリュームも元の3Dデータと同じサイズで、テクスチャ４として使用する
+	if (precomputedLight && lightTexture > 0) {
+		glActiveTexture(GL_TEXTURE4); glBindTexture(GL_TEXTURE_3D, lightTexture);
+	}
+
+	// アンビエントオクルージョンも元の3Dデータと同じサイズで、テクスチャ５として使用する
+	if (ambientOcclusion && occlusionTexture > 0) {
+		glActiveTexture(GL_TEXTURE5); glBindTexture(GL_TEXTURE_3D, occlusionTexture);
+	}
+
+	// ブリック毎の最小値と最大値は、テクスチャ６として使用する
+	if (useEmptySkipping() || useOcclusionCulling()) {
+		glActiveTexture(GL_TEXTURE6); glBindTexture(GL_TEXTURE_3D, minMaxTexture);
+	}
+
+	// レイの開始位置をずらすブルーノイズは、テクスチャ８として使用する
+	if (progressive) {
+		if (blueNoiseTexture == 0) {
+			std::vector<float> noise;
+			BlueNoise::generate(BLUE_NOISE_SIZE, noise);
+			glGenTextures(1, &blueNoiseTexture);
+			glBindTexture(GL_TEXTURE_2D, blueNoiseTexture);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, BLUE_NOISE_SIZE, BLUE_NOISE_SIZE, 0, GL_RED, GL_FLOAT, &noise[0]);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		}
+		glActiveTexture(GL_TEXTURE8); glBindTexture(GL_TEXTURE_2D, blueNoiseTexture);
+	}
+	glActiveTexture(GL_TEXTURE0);
+}
+
+/**
+ * レイを打ち切る不透明度を設定する。
+ * 小さくするほど早く打ち切るので速くなるが、奥のサンプルの寄与が失われる。
+ *
+ * @param terminationThreshold	打ち切る不透明度（0 - 1）
+ */
+void VolumeRendering::setTerminationThreshold(float terminationThreshold) {
+	this->terminationThreshold = std::min(std::max(terminationThreshold, 0.0f), 1.0f);
+}
+
+/**
+ * 粗い遮蔽のパスによるカリングの有効／無効を設定する。
+ * 有効な場合は、画面の解像度のレイを飛ばす前に、OCCLUSION_TILE_SIZE毎に１本のレイで、
+ * タイルの全てのレイが通る範囲のブリックが空である距離と、不透明になって打ち切るまでの距離を求める。
+ * 空の範囲はブリックの最小値と最大値から求めるので、点のサンプルの間にある細い構造も失われない。
+ * 画面の解像度のレイは、空の範囲を読み飛ばし、全て空のタイルではレイを飛ばさない。
+ * 奥は、近傍の粗いレイが全て不透明になった場合だけ打ち切る。
+ *
+ * @param occlusionCulling	カリングする場合はtrue
+ */
+void VolumeRendering::setOcclusionCulling(bool occlusionCulling) {
+	this->occlusionCulling = occlusionCulling;
+}
+
+/**
+ * 粗い遮蔽のパスを使うかどうかを返却する。
+ * 不透明度を積分するのは、ボリュームレンダリングだけである。また、空の範囲を求めるのにブリックの最小値と最大値を使う。
+ *
+ * @return		使う場合はtrue
+ */
+bool VolumeRendering::useOcclusionCulling() const {
+	return occlusionCulling && renderMode == RENDER_VOLUME && minMaxTexture > 0;
+}
+
+/**
+ * 画面の1/OCCLUSION_TILE_SIZEの解像度で、光源の計算を省いたレイキャスティングを行い、
+ * タイル毎に、タイルのレイが空のブリックだけを通る距離と、打ち切るまでの距離を書き込む。
+ *
+ * @param cameraPos		カメラの位置
+ */
+void VolumeRendering::renderOcclusionTiles(const QVector3D& cameraPos) {
+	PROFILE_GPU_SCOPE("occlusionTiles");
+
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	int width = (viewport[2] + OCCLUSION_TILE_SIZE - 1) / OCCLUSION_TILE_SIZE;
+	int height = (viewport[3] + OCCLUSION_TILE_SIZE - 1) / OCCLUSION_TILE_SIZE;
+	if (occlusionTilesTexture == 0 || occlusionSize[0] != width || occlusionSize[1] != height) {
+		createColorTarget(width, height, occlusionFbo, occlusionTilesTexture);
+		occlusionSize[0] = width;
+		occlusionSize[1] = height;
+	}
+
+	GLuint occlusionProgram = Util::LoadProgram("raycastvs", "raycastfs", getShaderDefines(true));
+	glUseProgram(occlusionProgram);
+	setRaycastUniforms(occlusionProgram, cameraPos);
+	bindVolumeTextures();
+
+	// 箱に当たらなかったタイルは、xが０のまま残る
+	glBindFramebuffer(GL_FRAMEBUFFER, occlusionFbo);
+	glViewport(0, 0, width, height);
+	glClearColor(0, 0, 0, 0);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glDisable(GL_BLEND);
+	glDisable(GL_CULL_FACE);
+
+	glBindVertexArray(boxVao);
+	glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, 0);
+
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+	glBindFramebuffer(GL_FRAMEBUFFER, targetFbo);
+	glUseProgram(program);
+}
+
+/**
+ * 最終的な画像を描画するフレームバッファを設定する。
+ * ウィンドウに描画する場合は０のままでよく、ウィンドウシステムが無い環境では、
+ * OffscreenContextのフレームバッファを指定する。
+ *
+ * @param targetFbo		描画先のフレームバッファ
+ */
+void VolumeRendering::setTargetFramebuffer(GLuint targetFbo) {
+	this->targetFbo = targetFbo;
+}
@@ -2,11 +2,38 @@
 
 #include <GL/glew.h>
 #include <vector>
+#include <string>
+#include <map>
 #include <QImage>
 #include <QVector3D>
+#include "FrameDelta.h"
+#include "SparseVolume.h"
+#include "GradientVolume.h"
+#include "LightVolume.h"
+#include "AmbientOcclusionVolume.h"
+#include "MinMaxBricks.h"
+#include "MarchingCubes.h"
 
 class VolumeRendering {
+public:
+	enum { RENDER_VOLUME = 0, RENDER_ISOSURFACE, RENDER_ISORAYCAST, RENDER_MIP, RENDER_MINIP, RENDER_AVERAGE };
+
+	struct RayStatistics {
+		int rays;
+		double iterations;
+		double samples;
+		double lightSteps;
+		int terminated;
+		float maxCost;
+	};
+
 private:
+	struct IsosurfaceMesh {
+		GLuint vao;
+		GLuint vbos[2];
+		int numIndices;
+	};
+
 	int gridWidth;
 	int gridHeight;
 	int gridDepth;
@@ -14,7 +41,81 @@ private:
 	GLuint program;
 
 	GLuint texture;
+	GLuint backTexture;
 	GLuint boxVao;
+	GLuint boxVbos[2];
+
+	FrameDelta* pendingDelta;
+
+	bool compressed;
+	float densityRange;
+
+	bool sparse;
+	GLuint brickTableTexture;
+	int atlasSize[3];
+
+	std::vector<float> volumeData;
+	std::vector<float> windowedData;
+	float windowMin;
+	float windowMax;
+	bool shading;
+	GLuint gradientTexture;
+
+	QVector3D lightPos;
+	bool precomputedLight;
+	GLuint lightTexture;
+
+	bool ambientOcclusion;
+	GLuint occlusionTexture;
+
+	int renderMode;
+	float isoValue;
+	GLuint meshProgram;
+	MinMaxBricks minMaxBricks;
+	GLuint minMaxTexture;
+	std::map<float, IsosurfaceMesh> meshCache;
+	std::vector<float> meshCacheOrder;
+
+	bool statistics;
+	GLuint heatmapProgram;
+	GLuint statsFbo;
+	GLuint statsTexture;
+	int statsSize[2];
+	GLuint quadVao;
+	GLuint quadVbo;
+	RayStatistics rayStatistics;
+
+	bool progressive;
+	GLuint accumulateProgram;
+	GLuint blueNoiseTexture;
+	GLuint frameFbo;
+	GLuint frameTexture;
+	GLuint accumFbo;
+	GLuint accumTexture;
+	int accumSize[2];
+	int accumulatedFrames;
+	std::vector<float> accumulationKey;
+
+	bool reprojection;
+	GLuint reprojectProgram;
+	GLuint historyFbos[2];
+	GLuint historyTextures[2][2];
+	GLuint reprojFbo;
+	GLuint reprojTextures[2];
+	GLuint reprojDepth;
+	GLuint pointVao;
+	int historySize[2];
+	int currentHistory;
+	bool historyValid;
+	std::vector<float> historyKey;
+
+	GLuint targetFbo;
+
+	float terminationThreshold;
+	bool occlusionCulling;
+	GLuint occlusionFbo;
+	GLuint occlusionTilesTexture;
+	int occlusionSize[2];
 
 public:
     GLfloat projectionMatrix[16]; 
@@ -25,6 +126,71 @@ public:
 	~VolumeRendering();
 
 	void setVolumeData(GLsizei width, GLsizei height, GLsizei depth, float* data);
+	void setCompressedVolumeData(GLsizei width, GLsizei height, GLsizei depth, float* data);
+	void setSparseVolumeData(GLsizei width, GLsizei height, GLsizei depth, float* data, float threshold = 0.0f);
+	void setSequenceFormat(GLsizei width, GLsizei height, GLsizei depth);
+	void updateVolumeData(float* data);
+	int updateVolumeData(const FrameDelta& delta);
+	void setWindow(float windowMin, float windowMax);
+	float getWindowMin() const { return windowMin; }
+	float getWindowMax() const { return windowMax; }
+	int getGridWidth() const { return gridWidth; }
+	int getGridHeight() const { return gridHeight; }
+	int getGridDepth() const { return gridDepth; }
+	const std::vector<float>& getVolumeData() const { return volumeData; }
+	void setShading(bool shading);
+	void setLightPosition(const QVector3D& lightPos);
+	const QVector3D& getLightPosition() const { return lightPos; }
+	void setPrecomputedLight(bool precomputedLight);
+	void setAmbientOcclusion(bool ambientOcclusion);
+	void setRenderMode(int renderMode);
+	int getRenderMode() const { return renderMode; }
+	void setIsoValue(float isoValue);
+	float getIsoValue() const { return isoValue; }
+	void setStatistics(bool statistics);
+	bool isStatistics() const { return statistics; }
+	const RayStatistics& getRayStatistics() const { return rayStatistics; }
+	void setProgressive(bool progressive);
+	bool needsRefinement() const;
+	void setReprojection(bool reprojection);
+	void invalidateHistory();
+	void setTargetFramebuffer(GLuint targetFbo);
+	void setTerminationThreshold(float terminationThreshold);
+	float getTerminationThreshold() const { return terminationThreshold; }
+	void setOcclusionCulling(bool occlusionCulling);
 	void render(const QVector3D& cameraPos);
+
+private:
+	void resetVolume(GLsizei width, GLsizei height, GLsizei depth);
+	GLuint createVolumeTexture(GLsizei width, GLsizei height, GLsizei depth);
+	bool isSameSize(GLsizei width, GLsizei height, GLsizei depth);
+	void deleteBox();
+	void updateDerivedVolumes();
+	void applyWindow();
+	void updateGradientTexture();
+	void updateLightTexture();
+	void updateOcclusionTexture();
+	void renderIsosurface(const QVector3D& cameraPos);
+	const IsosurfaceMesh& getIsosurfaceMesh();
+	void clearMeshCache();
+	void buildMinMaxBricks();
+	void updateMinMaxTexture();
+	bool useEmptySkipping() const;
+	std::string getShaderDefines(bool occlusionPass = false) const;
+	void updateStatisticsTarget(int width, int height);
+	void collectStatistics();
+	void renderHeatmap();
+	void updateAccumulation(const QVector3D& cameraPos);
+	void createColorTarget(int width, int height, GLuint& fbo, GLuint& texture);
+	void accumulateFrame();
+	void drawQuad();
+	bool useReprojection() const;
+	void updateHistory();
+	void reprojectHistory();
+	void showHistory();
+	void setRaycastUniforms(GLuint shader, const QVector3D& cameraPos);
+	void bindVolumeTextures();
+	bool useOcclusionCulling() const;
+	void renderOcclusionTiles(const QVector3D& cameraPos);
 };
 
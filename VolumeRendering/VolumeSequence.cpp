@@ -0,0 +1,212 @@
+﻿#include "VolumeSequence.h"
+#include <QRunnable>
+#include <QMutexLocker>
+#include <algorithm>
+#include "Util.h"
+
+/**
+ * ワーカースレッドで1フレーム分のVTKファイルを読み込むタスク。
+ */
+class VolumeSequenceLoader : public QRunnable {
+private:
+	VolumeSequence* sequence;
+	int position;
+
+public:
+	VolumeSequenceLoader(VolumeSequence* sequence, int position) : sequence(sequence), position(position) {}
+
+	void run() {
+		sequence->loadFrame(position);
+	}
+};
+
+/**
+ * 時系列の3Dデータを、指定したVTKファイルの列として扱う。
+ * 再生位置（position）は単調増加し、position % フレーム数 番目のファイルに対応するので、
+ * ループ再生しても先読みが途切れない。
+ * deltaEncodingを指定すると、各フレームを直前のフレームとの差分（FrameDelta）として保持する。
+ * この場合、差分の基準となるフレームが必要なので、フレームは１つのワーカースレッドで順番に読み込む。
+ *
+ * @param filenames			各フレームのVTKファイル名
+ * @param prefetchCount		先読みするフレーム数
+ * @param deltaEncoding		差分として保持するか
+ */
+VolumeSequence::VolumeSequence(const std::vector<std::string>& filenames, int prefetchCount, bool deltaEncoding) {
+	this->filenames = filenames;
+	this->prefetchCount = prefetchCount;
+	this->deltaEncoding = deltaEncoding;
+	reference = NULL;
+
+	if (deltaEncoding) {
+		pool.setMaxThreadCount(1);
+	}
+
+	width = 0;
+	height = 0;
+	depth = 0;
+	current = 0;
+}
+
+VolumeSequence::~VolumeSequence() {
+	// 読み込み中のタスクが終わるのを待ってから、先読みしたフレームを解放する
+	pool.waitForDone();
+
+	for (std::map<int, float*>::iterator it = frames.begin(); it != frames.end(); ++it) {
+		delete [] it->second;
+	}
+	for (std::map<int, FrameDelta*>::iterator it = deltas.begin(); it != deltas.end(); ++it) {
+		delete it->second;
+	}
+	delete [] reference;
+}
+
+/**
+ * 最初のフレームを同期的に読み込み、3Dデータのサイズを決定する。
+ * 以降のフレームは、ワーカースレッドで先読みを開始する。
+ * histogramを指定した場合は、最初のフレームの値のヒストグラムを作成する（窓の自動設定に使う）。
+ *
+ * @param data [OUT]		最初のフレームの3Dデータ（呼び出し側でdelete []すること）
+ * @param histogram [OUT]	最初のフレームの値のヒストグラム。NULL可
+ * @return					読み込み成功ならtrueを返却する
+ */
+bool VolumeSequence::open(float** data, VolumeHistogram* histogram) {
+	if (filenames.empty()) return false;
+
+	if (!Util::loadVTK((char*)filenames[0].c_str(), width, height, depth, data, histogram)) {
+		return false;
+	}
+
+	if (deltaEncoding) {
+		reference = new float[width * height * depth];
+		std::copy(*data, *data + width * height * depth, reference);
+	}
+
+	QMutexLocker locker(&mutex);
+	current = 0;
+	prefetch();
+
+	return true;
+}
+
+/**
+ * 指定した再生位置以前で、先読みが完了している最新のフレームを取り出す。
+ * それより前のフレームは表示されずに捨てられるので、呼び出し側でドロップとして数える。
+ *
+ * @param position		表示したい再生位置
+ * @param index [OUT]	取り出したフレームの再生位置
+ * @return				フレームの3Dデータ（呼び出し側でdelete []すること）。準備できていなければNULL
+ */
+float* VolumeSequence::takeLatestFrame(int position, int& index) {
+	QMutexLocker locker(&mutex);
+
+	float* data = NULL;
+	index = current;
+
+	std::map<int, float*>::iterator it = frames.begin();
+	while (it != frames.end() && it->first <= position) {
+		// 読み込みに失敗したフレームはNULLなので、飛ばす
+		if (it->second != NULL) {
+			delete [] data;
+			data = it->second;
+			index = it->first;
+		}
+
+		// 失敗したフレームも取り出したものとして再生位置を進めないと、先読みの範囲が進まずに再生が止まる
+		current = std::max(current, it->first);
+		frames.erase(it++);
+	}
+
+	prefetch();
+
+	return data;
+}
+
+/**
+ * 指定した再生位置以前で、先読みが完了している全ての差分を統合して取り出す。
+ * 差分は累積的なので、表示しないフレームの差分も捨てずに統合する。
+ *
+ * @param position		表示したい再生位置
+ * @param index [OUT]	取り出した差分を適用した後の再生位置
+ * @return				統合した差分（呼び出し側でdeleteすること）。準備できていなければNULL
+ */
+FrameDelta* VolumeSequence::takeDelta(int position, int& index) {
+	QMutexLocker locker(&mutex);
+
+	FrameDelta* delta = NULL;
+	index = current;
+
+	std::map<int, FrameDelta*>::iterator it = deltas.begin();
+	while (it != deltas.end() && it->first <= position) {
+		if (delta == NULL) {
+			delta = it->second;
+		} else {
+			delta->merge(*it->second);
+			delete it->second;
+		}
+		index = it->first;
+		deltas.erase(it++);
+	}
+
+	if (delta != NULL) {
+		current = index;
+		prefetch();
+	}
+
+	return delta;
+}
+
+/**
+ * 現在の再生位置の次から、prefetchCount個のフレームの読み込みを開始する。
+ * mutexをロックした状態で呼び出すこと。
+ */
+void VolumeSequence::prefetch() {
+	for (int position = current + 1; position <= current + prefetchCount; ++position) {
+		if (frames.find(position) != frames.end() || deltas.find(position) != deltas.end() || pending.find(position) != pending.end()) continue;
+
+		pending.insert(position);
+		pool.start(new VolumeSequenceLoader(this, position));
+	}
+}
+
+/**
+ * 指定した再生位置のフレームを読み込む。ワーカースレッドから呼ばれる。
+ * サイズが最初のフレームと異なる場合は、読み込み失敗として扱う。
+ *
+ * @param position		再生位置
+ */
+void VolumeSequence::loadFrame(int position) {
+	float* data = NULL;
+	int w, h, d;
+	if (Util::loadVTK((char*)filenames[position % filenames.size()].c_str(), w, h, d, &data)) {
+		if (w != width || h != height || d != depth) {
+			delete [] data;
+			data = NULL;
+		}
+	} else {
+		data = NULL;
+	}
+
+	if (deltaEncoding) {
+		// 直前のフレームとの差分を計算する。読み込みに失敗した場合は、変化なしとして扱う
+		FrameDelta* delta = new FrameDelta(width, height, depth);
+		if (data != NULL) {
+			delta->compute(reference, data);
+			delete [] reference;
+			reference = data;
+		}
+
+		QMutexLocker locker(&mutex);
+		pending.erase(position);
+		deltas[position] = delta;
+		return;
+	}
+
+	QMutexLocker locker(&mutex);
+	pending.erase(position);
+	if (position > current) {
+		frames[position] = data;
+	} else {
+		// 既に追い越された古いフレームは不要
+		delete [] data;
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+#include <map>
+#include <set>
+#include <string>
+#include <QMutex>
+#include <QThreadPool>
+#include "FrameDelta.h"
+#include "VolumeHistogram.h"
+
+class VolumeSequence {
+private:
+	std::vector<std::string> filenames;
+	int prefetchCount;
+	bool deltaEncoding;
+
+	int width;
+	int height;
+	int depth;
+
+	QThreadPool pool;
+	QMutex mutex;
+	std::map<int, float*> frames;
+	std::map<int, FrameDelta*> deltas;
+	float* reference;
+	std::set<int> pending;
+	int current;
+
+public:
+	VolumeSequence(const std::vector<std::string>& filenames, int prefetchCount = 4, bool deltaEncoding = false);
+	~VolumeSequence();
+
+	bool open(float** data, VolumeHistogram* histogram = NULL);
+	int numFrames() const { return filenames.size(); }
+	int getWidth() const { return width; }
+	int getHeight() const { return height; }
+	int getDepth() const { return depth; }
+
+	bool isDeltaEncoding() const { return deltaEncoding; }
+	float* takeLatestFrame(int position, int& index);
+	FrameDelta* takeDelta(int position, int& index);
+
+private:
+	void prefetch();
+	void loadFrame(int position);
+
+	friend class VolumeSequenceLoader;
+};
@@ -1,8 +1,145 @@
 #include "MainWindow.h"
+#include "OffscreenRenderer.h"
+#include "CpuRaycaster.h"
+#include "SequenceRenderer.h"
+#include "RenderServer.h"
+#include "RenderClient.h"
+#include "RemoteProtocol.h"
+#include "Util.h"
 #include <QtGui/QApplication>
+#include <QtCore/QCoreApplication>
+#include <iostream>
+#include <stdlib.h>
+#include <string.h>
+
+// length of the orbit rendered when no camera path is given [s]
+#define ORBIT_DURATION	8.0f
+
+/**
+ * Render a VTK file into a PNG without a window system, e.g. in batch jobs on a headless server:
+ *   VolumeRendering -offscreen <input.vtk> <output.png> [width height]
+ */
+static int renderOffscreen(int argc, char *argv[])
+{
+	if (argc < 4) {
+		std::cout << "Usage: " << argv[0] << " -offscreen <input.vtk> <output.png> [width height]" << std::endl;
+		return 1;
+	}
+	int width = argc >= 6 ? atoi(argv[4]) : 800;
+	int height = argc >= 6 ? atoi(argv[5]) : 600;
+
+	OffscreenRenderer renderer;
+	if (!renderer.create(width, height)) return 1;
+	if (!renderer.loadVTK(argv[2])) return 1;
+
+	QImage image;
+	renderer.render(image);
+	if (!image.save(argv[3])) {
+		std::cout << "Unable to save " << argv[3] << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
+
+/**
+ * Render a camera path of a VTK file on the CPU into a numbered PNG sequence, using all the cores:
+ *   VolumeRendering -sequence <input.vtk> <path.txt|orbit> <prefix> [width height fps]
+ */
+static int renderSequence(int argc, char *argv[])
+{
+	if (argc < 5) {
+		std::cout << "Usage: " << argv[0] << " -sequence <input.vtk> <path.txt|orbit> <prefix> [width height fps]" << std::endl;
+		return 1;
+	}
+	int width = argc >= 7 ? atoi(argv[5]) : 800;
+	int height = argc >= 7 ? atoi(argv[6]) : 600;
+	float fps = argc >= 8 ? (float)atof(argv[7]) : 30.0f;
+
+	CameraPath path;
+	if (strcmp(argv[3], "orbit") == 0) {
+		path = CameraPath::orbit(Camera(), ORBIT_DURATION);
+	} else if (!path.load(argv[3])) {
+		std::cout << "Unable to load " << argv[3] << std::endl;
+		return 1;
+	}
+
+	float* data;
+	int gridWidth, gridHeight, gridDepth;
+	VolumeHistogram histogram;
+	if (!Util::loadVTK(argv[2], gridWidth, gridHeight, gridDepth, &data, &histogram)) {
+		std::cout << "Unable to load " << argv[2] << std::endl;
+		return 1;
+	}
+
+	float windowMin, windowMax;
+	histogram.getAutoWindow(windowMin, windowMax);
+
+	CpuRaycaster raycaster(gridWidth, gridHeight, gridDepth, data);
+	raycaster.setWindow(windowMin, windowMax);
+	int frames = SequenceRenderer::render(raycaster, path, fps, width, height, argv[4]);
+
+	delete [] data;
+
+	return frames > 0 ? 0 : 1;
+}
+
+/**
+ * Serve the rendered frames of a VTK file to the clients on this machine:
+ *   VolumeRendering -server <input.vtk> [port [width height [gpu|cpu]]]
+ */
+static int runServer(int argc, char *argv[])
+{
+	if (argc < 3) {
+		std::cout << "Usage: " << argv[0] << " -server <input.vtk> [port [width height [gpu|cpu]]]" << std::endl;
+		return 1;
+	}
+	int port = argc >= 4 ? atoi(argv[3]) : RemoteProtocol::DEFAULT_PORT;
+	int width = argc >= 6 ? atoi(argv[4]) : 800;
+	int height = argc >= 6 ? atoi(argv[5]) : 600;
+	int backend = argc >= 7 && strcmp(argv[6], "cpu") == 0 ? RenderServer::BACKEND_CPU : RenderServer::BACKEND_GPU;
+
+	RenderServer server;
+	if (!server.create(argv[2], width, height, backend)) return 1;
+
+	return server.run(port) ? 0 : 1;
+}
+
+/**
+ * Orbit the camera of a render server and report the end-to-end latency:
+ *   VolumeRendering -client [host [port [seconds [last.png]]]]
+ */
+static int runClient(int argc, char *argv[])
+{
+	const char* host = argc >= 3 ? argv[2] : "localhost";
+	int port = argc >= 4 ? atoi(argv[3]) : RemoteProtocol::DEFAULT_PORT;
+	float seconds = argc >= 5 ? (float)atof(argv[4]) : 10.0f;
+	const char* output = argc >= 6 ? argv[5] : NULL;
+
+	return RenderClient::run(host, port, seconds, output) ? 0 : 1;
+}
 
 int main(int argc, char *argv[])
 {
+	if (argc >= 2 && strcmp(argv[1], "-server") == 0) {
+		QCoreApplication a(argc, argv);
+		return runServer(argc, argv);
+	}
+	if (argc >= 2 && strcmp(argv[1], "-client") == 0) {
+		QCoreApplication a(argc, argv);
+		return runClient(argc, argv);
+	}
+	if (argc >= 2 && strcmp(argv[1], "-sequence") == 0) {
+		// the CPU path needs neither the window system nor OpenGL
+		QCoreApplication a(argc, argv);
+		return renderSequence(argc, argv);
+	}
+	if (argc >= 2 && strcmp(argv[1], "-offscreen") == 0) {
+		// QCoreApplication does not connect to the window system
+		QCoreApplication a(argc, argv);
+		return renderOffscreen(argc, argv);
+	}
+
 	QApplication a(argc, argv);
 	MainWindow w;
 	w.show();
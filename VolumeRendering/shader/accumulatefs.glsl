@@ -0,0 +1,11 @@
+#version 330
+
+out vec4 glFragColor;
+
+// the frame that was just ray cast. it is blended into the accumulation buffer
+// with the weight 1 / (number of accumulated frames), which keeps the running average.
+uniform sampler2D frame;
+
+void main() {
+	glFragColor = texelFetch(frame, ivec2(gl_FragCoord.xy), 0);
+}
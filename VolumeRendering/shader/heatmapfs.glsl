@@ -0,0 +1,29 @@
+#version 330
+
+in vec2 vTexCoord;
+out vec4 glFragColor;
+
+// per-pixel ray statistics written by raycastfs.glsl:
+// main loop iterations, density samples, light march steps and early termination
+uniform sampler2D statistics;
+uniform float maxCost;
+
+// blue -> cyan -> green -> yellow -> red
+vec3 heat(float t) {
+	t = clamp(t, 0.0, 1.0) * 4.0;
+	return clamp(vec3(t - 2.0, t < 2.0 ? t : 4.0 - t, 2.0 - t), 0.0, 1.0);
+}
+
+void main() {
+	vec4 s = texture(statistics, vTexCoord);
+
+	// the pixels whose rays missed the volume stay black
+	if (s.x == 0.0) {
+		glFragColor = vec4(0, 0, 0, 1);
+		return;
+	}
+
+	// the cost of a ray is the number of density fetches, including the light march
+	float cost = s.y + s.z;
+	glFragColor = vec4(heat(cost / max(maxCost, 1.0)), 1.0);
+}
@@ -0,0 +1,31 @@
+#version 330
+
+in vec3 vPosition;
+in vec3 vNormal;
+out vec4 glFragColor;
+
+uniform vec3 gridSize;
+uniform vec3 cameraPos;
+uniform vec3 lightPos;
+
+const vec3 surfaceColor = vec3(0.9, 0.85, 0.75);
+const float ambient = 0.2;
+const float diffuse = 0.7;
+const float specular = 0.3;
+const float shininess = 32.0;
+
+void main() {
+	// lightPos is in the texture coordinates, so convert it to the same coordinates as the mesh
+	vec3 light = lightPos * gridSize - gridSize * 0.5;
+
+	vec3 n = normalize(vNormal);
+	vec3 l = normalize(light - vPosition);
+	vec3 v = normalize(cameraPos - vPosition);
+	vec3 h = normalize(l + v);
+
+	// the inside of the surface is visible through the clipped boundary, so light both sides
+	if (dot(n, v) < 0.0) n = -n;
+
+	float lit = ambient + diffuse * max(dot(n, l), 0.0);
+	glFragColor = vec4(surfaceColor * lit + vec3(specular * pow(max(dot(n, h), 0.0), shininess)), 1.0);
+}
@@ -0,0 +1,15 @@
+#version 330
+
+layout(location = 0) in vec3 glVertex;
+layout(location = 1) in vec3 glNormal;
+out vec3 vPosition;
+out vec3 vNormal;
+
+uniform mat4 modelviewMatrix;
+uniform mat4 projectionMatrix;
+
+void main() {
+	gl_Position = projectionMatrix * modelviewMatrix * vec4(glVertex, 1.0);
+	vPosition = glVertex;
+	vNormal = glNormal;
+}
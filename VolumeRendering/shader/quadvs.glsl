@@ -0,0 +1,10 @@
+#version 330
+
+in vec4 glVertex;
+out vec2 vTexCoord;
+
+void main() {
+	// the quad covers the whole viewport in the normalized device coordinates
+	gl_Position = vec4(glVertex.xy, 0.0, 1.0);
+	vTexCoord = glVertex.xy * 0.5 + 0.5;
+}
@@ -1,26 +1,327 @@
 #version 330
 
+// The variant is selected by the macros below, which VolumeRendering injects right after
+// the #version line (see Util::LoadProgram). The defaults compile the plain DVR variant.
+//   RENDER_MODE        RENDER_VOLUME, RENDER_ISORAYCAST, RENDER_MIP, RENDER_MINIP or RENDER_AVERAGE
+//   STORAGE            STORAGE_DENSE, STORAGE_COMPRESSED or STORAGE_SPARSE
+//   SHADING            1 to shade with the precomputed gradient volume
+//   PRECOMPUTED_LIGHT  1 to use the precomputed transmittance instead of the light march
+//   AMBIENT_OCCLUSION  1 to use the precomputed ambient occlusion volume
+//   EMPTY_SKIPPING     1 to skip the bricks that cannot change the projection
+//   LIGHT_SAMPLES      the maximum number of samples of the light march
+//   STATISTICS         1 to write the per-ray cost to the second render target
+//   STEP_SIZE          the distance between the samples along the ray in the texture coordinates
+//   JITTER             1 to offset the start of each ray by a blue noise value
+//   REPROJECTION       1 to reuse the reprojected previous frame and write the first significant sample
+//                      to the second render target (RENDER_VOLUME and RENDER_ISORAYCAST only)
+//   OCCLUSION_PASS     1 to trace the coarse occlusion pass, which writes the distance along the ray before which
+//                      the min-max bricks around all the rays of the tile are empty, and the distance to the
+//                      termination, instead of the color (RENDER_VOLUME only)
+//   OCCLUSION_CULLING  1 to skip the empty and occluded parts of the ray found by the coarse occlusion pass
+//   OCCLUSION_TILE_SIZE the number of pixels covered by one texel of the coarse occlusion pass in each direction
+
+// the values must match the enum in VolumeRendering
+#define RENDER_VOLUME 0
+#define RENDER_ISORAYCAST 2
+#define RENDER_MIP 3
+#define RENDER_MINIP 4
+#define RENDER_AVERAGE 5
+
+#define STORAGE_DENSE 0
+#define STORAGE_COMPRESSED 1
+#define STORAGE_SPARSE 2
+
+#ifndef RENDER_MODE
+#define RENDER_MODE RENDER_VOLUME
+#endif
+#ifndef STORAGE
+#define STORAGE STORAGE_DENSE
+#endif
+#ifndef SHADING
+#define SHADING 0
+#endif
+#ifndef PRECOMPUTED_LIGHT
+#define PRECOMPUTED_LIGHT 0
+#endif
+#ifndef AMBIENT_OCCLUSION
+#define AMBIENT_OCCLUSION 0
+#endif
+#ifndef EMPTY_SKIPPING
+#define EMPTY_SKIPPING 0
+#endif
+#ifndef LIGHT_SAMPLES
+#define LIGHT_SAMPLES 128
+#endif
+#ifndef STATISTICS
+#define STATISTICS 0
+#endif
+#ifndef STEP_SIZE
+#define STEP_SIZE 0.005
+#endif
+#ifndef JITTER
+#define JITTER 0
+#endif
+#ifndef REPROJECTION
+#define REPROJECTION 0
+#endif
+#ifndef OCCLUSION_PASS
+#define OCCLUSION_PASS 0
+#endif
+#ifndef OCCLUSION_CULLING
+#define OCCLUSION_CULLING 0
+#endif
+#ifndef OCCLUSION_TILE_SIZE
+#define OCCLUSION_TILE_SIZE 8
+#endif
+#if REPROJECTION && STATISTICS
+#error "REPROJECTION and STATISTICS both use the second render target"
+#endif
+#if (OCCLUSION_PASS || OCCLUSION_CULLING) && RENDER_MODE != RENDER_VOLUME
+#error "the occlusion pass is only defined for RENDER_VOLUME"
+#endif
+
+// STAT(x) compiles x only in the statistics variant, so that the counters cost nothing otherwise
+#if STATISTICS
+#define STAT(x) x
+#else
+#define STAT(x)
+#endif
+
 in vec3 vPosition;
-out vec4 glFragColor;
+layout(location = 0) out vec4 glFragColor;
+#if STATISTICS
+// main loop iterations, density samples, light march steps and whether the ray terminated early
+layout(location = 1) out vec4 glFragStats;
+int statIterations = 0;
+int statSamples = 0;
+int statLightSteps = 0;
+bool statTerminated = false;
+#endif
+#if REPROJECTION
+// the position of the first significant sample in the texture coordinates, and in w, the number of
+// frames the pixel has been reused plus one (0 if the ray did not hit anything significant)
+layout(location = 1) out vec4 glFragPosition;
+#endif
 
 uniform sampler3D density;
+uniform sampler2DArray compressedDensity;
+uniform float densityRange;
+uniform float windowMin = 0.0;
+uniform float windowMax = 1.0;
+uniform usampler3D brickTable;
+uniform vec3 atlasSize;
+uniform sampler3D gradients;
+uniform sampler3D lightVolume;
+uniform sampler3D occlusionVolume;
+uniform sampler3D minMaxBricks;
+uniform float isoValue;
 uniform vec3 gridSize;
 uniform vec3 cameraPos;
 
 uniform vec3 lightPos = vec3(1.0, 1.0, 2.0);
 
-const int lightsampleNum = 128;
-const float stepSize = 0.005;
+// the previous frame reprojected into the current view (see reprojectvs.glsl)
+uniform sampler2D reprojectedColor;
+uniform sampler2D reprojectedPosition;
+
+// the ray terminates once the accumulated opacity reaches this value
+uniform float terminationThreshold = 0.99;
+
+// the coarse occlusion pass: x is 1 if the box was hit, y is the distance along the ray before which all the
+// rays of the tile are empty (1e20 if they are empty all the way), and z is the distance to the termination
+// of the coarse ray (1e20 if it did not terminate)
+uniform sampler2D occlusionTiles;
+// the number of tiles per pixel in each direction
+uniform vec2 occlusionScale;
+
+// tileable blue noise in [0, 1) and the index of the accumulated frame
+uniform sampler2D blueNoise;
+uniform int frameIndex;
+
+const int lightsampleNum = LIGHT_SAMPLES;
+const float stepSize = STEP_SIZE;
 const float lightStepSize = 0.01;
+// the light march used to attenuate by absorbRate * 0.005 per step, which is kept
+// independent of STEP_SIZE (same as LIGHT_ABSORPTION in VolumeRendering)
+const float lightAbsorption = 5.0;
 const float densityScale = 10;
 const float absorbRate = 10.0;
+// the neighboring coarse rays do not see exactly the same samples, so keep this distance after their termination
+const float occlusionMargin = 0.02;
+// the footprint of a tile that covers more bricks than this is not tested and counts as non-empty
+const int maxFootprintBricks = 64;
+const float brickSize = 8.0;
+const int refineSteps = 6;
+const vec3 surfaceColor = vec3(0.9, 0.85, 0.75);
+const float ambient = 0.3;
+const float diffuse = 0.7;
+const float specular = 0.4;
+const float shininess = 32.0;
+
+float sampleRawDensity(vec3 pos) {
+#if STORAGE == STORAGE_COMPRESSED
+	// BC4 slices are stored as layers of a 2D texture array,
+	// so interpolate between the two nearest slices manually.
+	float z = clamp(pos.z * gridSize.z - 0.5, 0.0, gridSize.z - 1.0);
+	float z0 = floor(z);
+	float z1 = min(z0 + 1.0, gridSize.z - 1.0);
+	float d0 = texture(compressedDensity, vec3(pos.xy, z0)).x;
+	float d1 = texture(compressedDensity, vec3(pos.xy, z1)).x;
+	return mix(d0, d1, z - z0) * densityRange;
+#elif STORAGE == STORAGE_SPARSE
+	// look up the slot of the brick in the atlas; empty bricks are not stored.
+	// each slot has a one-voxel border, so trilinear filtering stays inside the slot.
+	vec3 voxel = pos * gridSize;
+	ivec3 brick = clamp(ivec3(floor(voxel / brickSize)), ivec3(0), textureSize(brickTable, 0) - 1);
+	uvec4 entry = texelFetch(brickTable, brick, 0);
+	if (entry.w == 0u) return 0.0;
+
+	vec3 local = voxel - vec3(brick) * brickSize;
+	vec3 atlasPos = vec3(entry.xyz) * (brickSize + 2.0) + 1.0 + local;
+	return texture(density, atlasPos / atlasSize).x;
+#else
+	return texture(density, pos).x;
+#endif
+}
+
+// map the density window to [0, 1], so that low-contrast data uses the whole range
+// and the densities below the window are skipped as empty.
+float sampleDensity(vec3 pos) {
+	return max(sampleRawDensity(pos) - windowMin, 0.0) / (windowMax - windowMin);
+}
+
+#if RENDER_MODE == RENDER_VOLUME
+// Blinn-Phong shading with the precomputed gradient volume.
+// rgb holds the normalized gradient and a holds its magnitude, so only one fetch is needed.
+// the shading fades out where the gradient is weak, since the normal is meaningless there.
+vec3 shade(vec3 pos, vec3 eye) {
+	vec4 g = texture(gradients, pos);
+	vec3 n = g.xyz * 2.0 - 1.0;
+	if (dot(n, n) < 1e-4) return vec3(ambient + diffuse);
+	n = normalize(n);
+
+	vec3 l = normalize(lightPos - pos);
+	vec3 v = normalize(eye - pos);
+	vec3 h = normalize(l + v);
+
+	// two sided lighting, since the gradient points inward or outward depending on the surface
+	float lit = ambient + diffuse * abs(dot(n, l)) + specular * pow(abs(dot(n, h)), shininess);
+	return vec3(mix(ambient + diffuse, lit, smoothstep(0.0, 0.1, g.a)));
+}
+#endif
+
+#if RENDER_MODE == RENDER_ISORAYCAST
+// refine the crossing between pos0 (below the iso value) and pos1 (above it).
+// each step takes the secant point and keeps the half that still contains the crossing.
+vec3 refineHit(vec3 pos0, float d0, vec3 pos1, float d1) {
+	for (int i = 0; i < refineSteps; ++i) {
+		float t = clamp((isoValue - d0) / max(d1 - d0, 1e-6), 0.0, 1.0);
+		vec3 pos = mix(pos0, pos1, t);
+		float d = sampleDensity(pos);
+		STAT(statSamples++;)
+		if (d < isoValue) {
+			pos0 = pos;
+			d0 = d;
+		} else {
+			pos1 = pos;
+			d1 = d;
+		}
+	}
+	return mix(pos0, pos1, clamp((isoValue - d0) / max(d1 - d0, 1e-6), 0.0, 1.0));
+}
+
+// normal from the central differences of the density, computed on the fly
+vec3 computeNormal(vec3 pos) {
+	vec3 h = 1.0 / gridSize;
+	vec3 g = vec3(
+		sampleDensity(pos + vec3(h.x, 0, 0)) - sampleDensity(pos - vec3(h.x, 0, 0)),
+		sampleDensity(pos + vec3(0, h.y, 0)) - sampleDensity(pos - vec3(0, h.y, 0)),
+		sampleDensity(pos + vec3(0, 0, h.z)) - sampleDensity(pos - vec3(0, 0, h.z)));
+	STAT(statSamples += 6;)
+	if (dot(g, g) < 1e-12) return vec3(0);
+
+	// the gradient points into the surface. since the lighting is done in the texture coordinates,
+	// the normal is scaled by the grid size.
+	return normalize(-g / h);
+}
+
+vec4 shadeHit(vec3 hit, vec3 eye) {
+	vec3 n = computeNormal(hit);
+	vec3 l = normalize(lightPos - hit);
+	vec3 v = normalize(eye - hit);
+	if (dot(n, n) == 0.0) n = v;
+	if (dot(n, v) < 0.0) n = -n;
+	vec3 h = normalize(l + v);
+
+	float lit = ambient + diffuse * max(dot(n, l), 0.0);
+	return vec4(surfaceColor * lit + vec3(specular * pow(max(dot(n, h), 0.0), shininess)), 1.0);
+}
+#endif
+
+#if EMPTY_SKIPPING
+// returns the number of steps needed to leave the min-max brick that contains pos.
+// the brick covers the cells [b * brickSize, (b + 1) * brickSize) in the voxel center coordinates.
+int stepsToLeaveBrick(vec3 pos, vec3 dir, vec3 brick) {
+	vec3 lower = (brick * brickSize + 0.5) / gridSize;
+	vec3 upper = ((brick + 1.0) * brickSize + 0.5) / gridSize;
+	vec3 t = max((lower - pos) / dir, (upper - pos) / dir);
+	float exit = min(min(t.x, t.y), t.z);
+	return max(int(ceil(exit / stepSize)), 1);
+}
+#endif
+
+#if OCCLUSION_PASS
+// returns true if all the min-max bricks that overlap the box [lower, upper] are empty.
+// the samples outside the volume are clamped to the edge, so the box is clamped in the same way.
+bool isEmptyRegion(vec3 lower, vec3 upper) {
+	ivec3 numBricks = textureSize(minMaxBricks, 0);
+	ivec3 b0 = clamp(ivec3(floor(clamp(lower * gridSize - 0.5, vec3(0.0), gridSize - 1.0) / brickSize)), ivec3(0), numBricks - 1);
+	ivec3 b1 = clamp(ivec3(floor(clamp(upper * gridSize - 0.5, vec3(0.0), gridSize - 1.0) / brickSize)), ivec3(0), numBricks - 1);
+	ivec3 n = b1 - b0 + 1;
+	if (n.x * n.y * n.z > maxFootprintBricks) return false;
+
+	for (int z = b0.z; z <= b1.z; ++z) {
+		for (int y = b0.y; y <= b1.y; ++y) {
+			for (int x = b0.x; x <= b1.x; ++x) {
+				if (texelFetch(minMaxBricks, ivec3(x, y, z), 0).y > 0.0) return false;
+			}
+		}
+	}
+	return true;
+}
+#endif
+
+#if STATISTICS
+void writeStatistics() {
+	glFragStats = vec4(float(statIterations), float(statSamples), float(statLightSteps), statTerminated ? 1.0 : 0.0);
+}
+#endif
 
 void main() {
+#if OCCLUSION_PASS
+	// how much the direction changes from this coarse ray to the next one. the derivatives are taken before
+	// any discard, so that the whole quad is still active.
+	vec3 coarseEye = (cameraPos + gridSize * 0.5) / gridSize;
+	vec3 coarseDir = normalize((vPosition + gridSize * 0.5) / gridSize - coarseEye);
+	vec3 spread = abs(dFdx(coarseDir)) + abs(dFdy(coarseDir));
+#endif
+
 	if (gl_FrontFacing) {
 		discard;
 		return;
 	}
 
+#if REPROJECTION
+	// reuse the pixel of the previous frame if it was reprojected here
+	vec4 reprojected = texelFetch(reprojectedPosition, ivec2(gl_FragCoord.xy), 0);
+	if (reprojected.w > 0.0) {
+		glFragColor = texelFetch(reprojectedColor, ivec2(gl_FragCoord.xy), 0);
+		glFragPosition = vec4(reprojected.xyz, reprojected.w + 1.0);
+		return;
+	}
+	glFragPosition = vec4(0);
+#endif
+
 	// conmpute the eye position in the texture coodinates
 	vec3 eye = (cameraPos + gridSize * 0.5) / gridSize;
 
@@ -33,12 +334,113 @@ void main() {
 	int numSteps = int(length(ray) / stepSize);
 
 	// ray step vector for each step
-	vec3 step = normalize(ray) * stepSize;
+	vec3 dir = normalize(ray);
+	vec3 step = dir * stepSize;
 
-	float alpha = 0.0; //init alpha from eye
-	vec3 color = vec3(0);
 	glFragColor = vec4(0);
 	vec3 pos = eye;
+	int firstStep = 0;
+
+#if OCCLUSION_CULLING
+	// the empty range at the start comes from the min-max bricks around all the rays of this tile, so it is safe
+	// to skip. if the coarse ray missed the box, nothing is known about this pixel, so trace the whole ray.
+	ivec2 numTiles = textureSize(occlusionTiles, 0);
+	ivec2 tile = min(ivec2(gl_FragCoord.xy * occlusionScale), numTiles - 1);
+	vec4 tileRange = texelFetch(occlusionTiles, tile, 0);
+	if (tileRange.x > 0.0) {
+		if (tileRange.y >= 1e20) {
+			discard;
+			return;
+		}
+
+		// one step earlier, since the jitter may move the start forward by up to one step
+		firstStep = max(int(tileRange.y / stepSize) - 1, 0);
+		pos += step * float(firstStep);
+	}
+
+	// the coarse rays are point samples, so the ray is only cut short where all of the coarse rays
+	// of this tile and its neighbors became opaque
+	bool opaque = true;
+	float lastDist = 0.0;
+	for (int y = -1; y <= 1; ++y) {
+		for (int x = -1; x <= 1; ++x) {
+			vec4 range = texelFetch(occlusionTiles, clamp(tile + ivec2(x, y), ivec2(0), numTiles - 1), 0);
+			opaque = opaque && range.x > 0.0 && range.z < 1e20;
+			lastDist = max(lastDist, range.z);
+		}
+	}
+	if (opaque) {
+		numSteps = min(numSteps, int((lastDist + occlusionMargin) / stepSize) + 1);
+	}
+#endif
+
+#if OCCLUSION_PASS
+	// march the footprint of the tile until it reaches a brick that is not empty. the footprint at the distance t
+	// is bounded by the spread to the neighboring coarse rays, which is twice as wide as the tile, and it also
+	// covers the steps before and after t. since the neighboring rays may be longer than this one, the march
+	// continues until the footprint has left the box.
+	float firstDist = 0.0;
+	for (int i = 0; i < 2 * numSteps + 64; ++i) {
+		float t = stepSize * float(i);
+		vec3 center = eye + dir * t;
+		vec3 extent = spread * (t + stepSize) + abs(dir) * stepSize;
+		vec3 lower = center - extent;
+		vec3 upper = center + extent;
+		if (any(greaterThan(lower, vec3(1.0))) || any(lessThan(upper, vec3(0.0)))) {
+			if (i >= numSteps) {
+				firstDist = 1e20;
+				break;
+			}
+			continue;
+		}
+		if (!isEmptyRegion(lower, upper)) {
+			firstDist = max(t - stepSize, 0.0);
+			break;
+		}
+	}
+
+	// the opacity of the coarse ray only needs to be traced from there
+	if (firstDist < 1e20) {
+		firstStep = int(firstDist / stepSize);
+		pos += step * float(firstStep);
+	} else {
+		numSteps = 0;
+	}
+#endif
+
+#if JITTER
+	// offset the ray by a fraction of a step, so that the fixed sample planes do not show up
+	// as wood grain. the golden ratio sequence gives each accumulated frame a different offset.
+	ivec2 noiseSize = textureSize(blueNoise, 0);
+	float offset = texelFetch(blueNoise, ivec2(gl_FragCoord.xy) % noiseSize, 0).x;
+	pos += step * fract(offset + float(frameIndex) * 0.618034);
+#endif
+
+#if RENDER_MODE == RENDER_VOLUME
+	float alpha = 0.0; //init alpha from eye
+	vec3 color = vec3(0);
+#if OCCLUSION_PASS
+	float lastDist = 1e20;
+#endif
+#if REPROJECTION
+	// the first sample where the ray becomes half opaque, or the first non-empty sample if it never does
+	vec3 firstSample = vec3(0);
+	bool hasFirstSample = false;
+#endif
+#elif RENDER_MODE == RENDER_ISORAYCAST
+	vec3 prevPos = eye;
+	float prevDens = 0.0;
+#else
+	float value = RENDER_MODE == RENDER_MINIP ? 1e20 : 0.0;
+	float total = 0.0;
+	int count = 0;
+#endif
+
+#if EMPTY_SKIPPING
+	// avoid the division by zero when computing the brick exit
+	dir = mix(dir, vec3(1e-6), equal(dir, vec3(0.0)));
+	ivec3 numBricks = textureSize(minMaxBricks, 0);
+#endif
 
 	// outside flag
 	// if this is false, the current position is outside the bounding box.
@@ -48,13 +450,23 @@ void main() {
 		outside = false;
 	}
 
-	for (int i = 0; i < numSteps && alpha < 0.99; ++i) {
+	for (int i = firstStep; i < numSteps; ++i) {
+		STAT(statIterations++;)
 		if (outside) {
 			if (pos.x < 0 || pos.x > 1 || pos.y < 0 || pos.y > 1 || pos.z < 0 || pos.z > 1) {
 				pos += step;
 				continue;
 			} else {
 				outside = false;
+#if RENDER_MODE == RENDER_ISORAYCAST
+				prevPos = pos;
+				prevDens = sampleDensity(pos);
+				STAT(statSamples++;)
+				if (prevDens >= isoValue) {
+					// the ray enters the volume inside the surface, so the hit is on the boundary
+					prevDens = 0.0;
+				}
+#endif
 			}
 		}
 
@@ -62,32 +474,145 @@ void main() {
 			break;
 		}
 
-		float sampleDens = texture(density, pos).x * densityScale;
+#if RENDER_MODE == RENDER_VOLUME
+		float sampleDens = sampleDensity(pos) * densityScale;
+		STAT(statSamples++;)
 		if (sampleDens > 1e-5) {
+			// opacity of the segment of the ray covered by this sample (Beer-Lambert), so that
+			// the accumulated opacity does not depend on the step size
+			float sampleAlpha = 1.0 - exp(-sampleDens * absorbRate * stepSize);
+#if OCCLUSION_PASS
+			// only the opacity is needed in the coarse pass
+			alpha += (1.0 - alpha) * sampleAlpha;
+			if (alpha >= terminationThreshold) {
+				lastDist = length(pos - eye);
+				break;
+			}
+#else
+			float lapha = 1.0;
+#if PRECOMPUTED_LIGHT
+			// transmittance from the light, precomputed by a plane sweep on the CPU
+			lapha = texture(lightVolume, pos).x;
+#elif !SHADING
 			//get lights color on the pixel
 			vec3 lightDir = normalize(lightPos-pos)*lightStepSize;
 			vec3 lpos = pos + lightDir;
 
 			//get alpha of how many light can reach the pixel
-			float lapha = 1.0;
 			for (int s=0; s < lightsampleNum; ++s) {
-				float ldens = texture(density, lpos).x;
-				lapha *= 1.0-absorbRate*stepSize*ldens; 
+				float ldens = sampleDensity(lpos);
+				STAT(statLightSteps++;)
+				lapha *= 1.0-lightAbsorption*lightStepSize*ldens; 
 				if (lapha <= 0.01) {
 					break;
 				}
 				lpos += lightDir;
 			}
+#endif
 			vec3 finallightColor = vec3(10.0) * lapha;
+#if SHADING
+			finallightColor *= shade(pos, eye);
+#endif
+#if AMBIENT_OCCLUSION
+			// fraction of the ambient light that is not blocked by the neighborhood
+			finallightColor *= texture(occlusionVolume, pos).x;
+#endif
 
-			// alpha blending
-			alpha += (1.0 - alpha) * sampleDens*stepSize*absorbRate;
-			color += (1.0 - alpha) * sampleDens*stepSize*finallightColor;
+			// front-to-back compositing with the color premultiplied by the opacity.
+			// the light is emitted in proportion to the density, and so to the absorption.
+			color += (1.0 - alpha) * sampleAlpha * finallightColor / absorbRate;
+			alpha += (1.0 - alpha) * sampleAlpha;
+#if REPROJECTION
+			if (!hasFirstSample) {
+				firstSample = pos;
+				hasFirstSample = true;
+			}
+			if (alpha >= 0.5 && glFragPosition.w == 0.0) {
+				glFragPosition = vec4(pos, 1.0);
+			}
+#endif
+			if (alpha >= terminationThreshold) {
+				STAT(statTerminated = true;)
+				break;
+			}
+#endif
+		}
+#elif RENDER_MODE == RENDER_ISORAYCAST
+		float dens = sampleDensity(pos);
+		STAT(statSamples++;)
+		if (dens >= isoValue) {
+			// first hit: refine it, shade it and stop without compositing
+			vec3 hit = prevPos == pos ? pos : refineHit(prevPos, prevDens, pos, dens);
+			glFragColor = shadeHit(hit, eye);
+#if REPROJECTION
+			glFragPosition = vec4(hit, 1.0);
+#endif
+			STAT(statTerminated = true;)
+			STAT(writeStatistics();)
+			return;
 		}
 
+		prevPos = pos;
+		prevDens = dens;
+#else
+#if EMPTY_SKIPPING
+		// skip the bricks that cannot change the result
+		vec3 brick = clamp(floor((pos * gridSize - 0.5) / brickSize), vec3(0), vec3(numBricks - 1));
+		vec2 range = texelFetch(minMaxBricks, ivec3(brick), 0).xy;
+#if RENDER_MODE == RENDER_MIP
+		bool skip = range.y <= value;
+#elif RENDER_MODE == RENDER_MINIP
+		bool skip = range.x >= value;
+#else
+		// empty bricks only add zeros to the average
+		bool skip = range.y <= 0.0;
+#endif
+		if (skip) {
+			int n = min(stepsToLeaveBrick(pos, dir, brick), numSteps - i);
+#if RENDER_MODE == RENDER_AVERAGE
+			count += n;
+#endif
+			pos += step * float(n);
+			i += n - 1;
+			continue;
+		}
+#endif
+
+		float dens = sampleDensity(pos);
+		STAT(statSamples++;)
+#if RENDER_MODE == RENDER_MIP
+		value = max(value, dens);
+#elif RENDER_MODE == RENDER_MINIP
+		value = min(value, dens);
+#else
+		total += dens;
+		count++;
+#endif
+#endif
+
 		pos += step;
 	}
 
+#if RENDER_MODE == RENDER_VOLUME
+#if OCCLUSION_PASS
+	glFragColor = vec4(1.0, firstDist, lastDist, 0.0);
+#else
+	// the color is premultiplied, so this is blended with GL_ONE, GL_ONE_MINUS_SRC_ALPHA
 	glFragColor.rgb = color;
 	glFragColor.a = alpha;
+#endif
+#if REPROJECTION
+	if (glFragPosition.w == 0.0 && hasFirstSample) {
+		glFragPosition = vec4(firstSample, 1.0);
+	}
+#endif
+#elif RENDER_MODE == RENDER_MIP || RENDER_MODE == RENDER_MINIP || RENDER_MODE == RENDER_AVERAGE
+#if RENDER_MODE == RENDER_AVERAGE
+	value = count > 0 ? total / float(count) : 0.0;
+#else
+	if (value >= 1e20) value = 0.0;
+#endif
+	glFragColor = vec4(vec3(clamp(value, 0.0, 1.0)), 1.0);
+#endif
+	STAT(writeStatistics();)
 }
@@ -2,7 +2,6 @@
 
 in vec4 glVertex;
 out vec3 vPosition; 
-out vec4 gl_Position;
 
 uniform mat4 modelviewMatrix;  
 uniform mat4 projectionMatrix;
@@ -0,0 +1,13 @@
+#version 330
+
+in vec4 vColor;
+in vec4 vPosition;
+
+layout(location = 0) out vec4 glFragColor;
+layout(location = 1) out vec4 glFragPosition;
+
+void main() {
+	// the nearest point wins by the depth test
+	glFragColor = vColor;
+	glFragPosition = vPosition;
+}
@@ -0,0 +1,31 @@
+#version 330
+
+// scatters each pixel of the previous frame to the position of its first significant sample
+// in the current view. one point is drawn per pixel, and the pixel is found from gl_VertexID.
+out vec4 vColor;
+out vec4 vPosition;
+
+uniform sampler2D previousColor;
+uniform sampler2D previousPosition;
+uniform mat4 modelviewMatrix;
+uniform mat4 projectionMatrix;
+uniform vec3 gridSize;
+
+// pixels that have been reused this many times are traced again, so that the errors do not pile up
+uniform float maxAge;
+
+void main() {
+	ivec2 size = textureSize(previousPosition, 0);
+	ivec2 pixel = ivec2(gl_VertexID % size.x, gl_VertexID / size.x);
+
+	vPosition = texelFetch(previousPosition, pixel, 0);
+	vColor = texelFetch(previousColor, pixel, 0);
+
+	if (vPosition.w == 0.0 || vPosition.w >= maxAge) {
+		// outside of the clip volume, so the point is not drawn
+		gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+	} else {
+		// the position is in the texture coordinates, so convert it to the same coordinates as the box
+		gl_Position = projectionMatrix * modelviewMatrix * vec4(vPosition.xyz * gridSize - gridSize * 0.5, 1.0);
+	}
+}